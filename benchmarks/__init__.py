@@ -0,0 +1,5 @@
+"""
+Benchmark scripts for the OpenCV Minecraft Controller.
+
+Run from the repository root, e.g. ``python -m benchmarks.benchmark_matrix``.
+"""
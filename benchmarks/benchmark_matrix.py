@@ -0,0 +1,282 @@
+"""
+Benchmark matrix for the OpenCV Minecraft Controller.
+
+Runs the replay benchmark over the grid of pose backend x model complexity x
+inference resolution x capture mode x threading mode, scores every cell against
+the Heavy model on the same frames, and writes a CSV, a static HTML summary and
+a JSON recommendation per hardware class that main.py shows in its usage text.
+
+Usage:
+    python -m benchmarks.benchmark_matrix clip.mp4 --output benchmark_report
+    python -m benchmarks.benchmark_matrix clip.mp4 --merge other_machine/results.csv
+"""
+
+import argparse
+import csv
+import html
+import itertools
+import logging
+import os
+from typing import Dict, List, Optional
+
+import numpy as np
+
+from src.controllers.replay_source import ReplaySource
+from src.utils.performance_report import hardware_class, write_summary
+from .replay_benchmark import (
+    POSE_BACKENDS, THREADING_MODES, BenchmarkConfig, parse_resolution, run_replay_benchmark
+)
+
+
+logger = logging.getLogger(__name__)
+
+
+CSV_COLUMNS = [
+    'hardware_class', 'backend', 'model_complexity', 'resolution', 'capture_mode',
+    'threading_mode', 'frames', 'fps', 'latency_p50_ms', 'latency_p99_ms', 'cpu_percent',
+    'rss_mb', 'inference_wall_ms', 'inference_cpu_ms', 'decision_cpu_ms', 'other_threads_cpu_ms',
+    'voluntary_ctx_switches', 'involuntary_ctx_switches', 'minor_page_faults', 'major_page_faults',
+    'detection_rate', 'angle_mae_deg', 'state_agreement'
+]
+REFERENCE_CONFIG = BenchmarkConfig(backend='mediapipe', model_complexity=2, resolution=None,
+                                   capture_mode='preload', threading_mode='sync')
+
+
+def score_against_reference(result: dict, reference: dict) -> Dict[str, float]:
+    """Compare per-frame angles and states with the reference run.
+
+    Args:
+        result: Output of run_replay_benchmark for the configuration under test
+        reference: Output of run_replay_benchmark for the Heavy reference
+
+    Returns:
+        dict: angle_mae_deg over frames where both detected an arm (NaN if none)
+              and state_agreement over all frames
+    """
+    count = min(len(result['angles']), len(reference['angles']))
+    if count == 0:
+        return {'angle_mae_deg': float('nan'), 'state_agreement': 0.0}
+
+    angles = result['angles'][:count]
+    reference_angles = reference['angles'][:count]
+    both = ~np.isnan(angles) & ~np.isnan(reference_angles)
+    mae = float(np.mean(np.abs(angles[both] - reference_angles[both]))) if both.any() else float('nan')
+    agreement = float(np.mean(result['states'][:count] == reference['states'][:count]))
+    return {'angle_mae_deg': mae, 'state_agreement': agreement}
+
+
+def recommend(rows: List[dict], max_angle_error: float, min_state_agreement: float) -> Dict[str, dict]:
+    """Pick the fastest acceptable configuration per hardware class.
+
+    Args:
+        rows: CSV rows (numeric fields may be strings when merged from files)
+        max_angle_error: Largest acceptable mean angle error in degrees
+        min_state_agreement: Smallest acceptable fraction of matching control states
+
+    Returns:
+        dict: Per hardware class, the recommended row and the best FPS per model complexity
+    """
+    summary = {}
+    for hw_class in sorted({row['hardware_class'] for row in rows}):
+        class_rows = [row for row in rows if row['hardware_class'] == hw_class]
+
+        fps_by_complexity = {}
+        for row in class_rows:
+            key = str(int(float(row['model_complexity'])))
+            fps_by_complexity[key] = max(fps_by_complexity.get(key, 0.0), float(row['fps']))
+
+        acceptable = [
+            row for row in class_rows
+            if float(row['state_agreement']) >= min_state_agreement
+            and not np.isnan(float(row['angle_mae_deg']))
+            and float(row['angle_mae_deg']) <= max_angle_error
+        ]
+        best = max(acceptable, key=lambda row: float(row['fps'])) if acceptable else None
+
+        summary[hw_class] = {
+            'fps_by_model_complexity': fps_by_complexity,
+            'recommended': None if best is None else {
+                'backend': best['backend'],
+                'model_complexity': int(float(best['model_complexity'])),
+                'resolution': best['resolution'],
+                'capture_mode': best['capture_mode'],
+                'threading_mode': best['threading_mode'],
+                'fps': float(best['fps']),
+                'latency_p99_ms': float(best['latency_p99_ms']),
+            },
+        }
+    return summary
+
+
+def write_csv(path: str, rows: List[dict]) -> None:
+    """Write benchmark rows to CSV."""
+    with open(path, 'w', newline='', encoding='utf-8') as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=CSV_COLUMNS, extrasaction='ignore')
+        writer.writeheader()
+        for row in rows:
+            writer.writerow(row)
+
+
+def read_csv(path: str) -> List[dict]:
+    """Read benchmark rows from a CSV written by write_csv()."""
+    with open(path, 'r', newline='', encoding='utf-8') as csv_file:
+        return list(csv.DictReader(csv_file))
+
+
+def _format_cell(value) -> str:
+    """Format a CSV value for the HTML table."""
+    try:
+        number = float(value)
+    except (TypeError, ValueError):
+        return html.escape(str(value))
+    if number.is_integer():
+        return str(int(number))
+    return f"{number:.2f}"
+
+
+def write_html(path: str, rows: List[dict], summary: Dict[str, dict]) -> None:
+    """Write a static HTML summary with recommendations and the full result table."""
+    parts = [
+        '<!DOCTYPE html>',
+        '<html><head><meta charset="utf-8"><title>Benchmark matrix</title>',
+        '<style>body{font-family:sans-serif}table{border-collapse:collapse}'
+        'td,th{border:1px solid #999;padding:4px 8px;text-align:right}'
+        'th{background:#eee}.best{background:#dfd}</style></head><body>',
+        '<h1>Benchmark matrix</h1>',
+        '<h2>Recommendations</h2>',
+        '<table><tr><th>Hardware class</th><th>Backend</th><th>Model</th><th>Resolution</th>'
+        '<th>Capture</th><th>Threading</th><th>FPS</th><th>p99 ms</th></tr>',
+    ]
+    for hw_class, entry in summary.items():
+        best = entry['recommended']
+        if best is None:
+            parts.append(f'<tr><td>{html.escape(hw_class)}</td><td colspan="7">no configuration met the accuracy bar</td></tr>')
+            continue
+        parts.append(
+            '<tr>' + ''.join(f'<td>{_format_cell(value)}</td>' for value in (
+                hw_class, best['backend'], best['model_complexity'], best['resolution'],
+                best['capture_mode'], best['threading_mode'], best['fps'], best['latency_p99_ms']
+            )) + '</tr>'
+        )
+    parts.append('</table>')
+
+    parts.append('<h2>All results</h2><table><tr>')
+    parts.extend(f'<th>{html.escape(column)}</th>' for column in CSV_COLUMNS)
+    parts.append('</tr>')
+    for row in rows:
+        best = summary.get(row['hardware_class'], {}).get('recommended')
+        is_best = best is not None and all(
+            str(row[key]) == str(best[key])
+            for key in ('backend', 'resolution', 'capture_mode', 'threading_mode')
+        ) and int(float(row['model_complexity'])) == best['model_complexity']
+        parts.append('<tr class="best">' if is_best else '<tr>')
+        parts.extend(f'<td>{_format_cell(row.get(column, ""))}</td>' for column in CSV_COLUMNS)
+        parts.append('</tr>')
+    parts.append('</table></body></html>')
+
+    with open(path, 'w', encoding='utf-8') as html_file:
+        html_file.write('\n'.join(parts))
+
+
+def run_matrix(
+    video_path: str,
+    backends: List[str],
+    complexities: List[int],
+    resolutions: List[Optional[tuple]],
+    capture_modes: List[str],
+    threading_modes: List[str],
+    max_frames: Optional[int] = None,
+    remote_address: Optional[str] = None,
+    cache_dir: Optional[str] = None
+) -> List[dict]:
+    """Run every grid cell and score it against the Heavy reference.
+
+    With a cache_dir, inference results are reused across cells and runs, so
+    only the decision metrics and the reference comparison are recomputed.
+
+    Returns:
+        List of CSV rows, one per configuration
+    """
+    logger.info("Running Heavy reference pass")
+    reference = run_replay_benchmark(video_path, REFERENCE_CONFIG, max_frames=max_frames, cache_dir=cache_dir)
+
+    rows = []
+    grid = itertools.product(backends, complexities, resolutions, capture_modes, threading_modes)
+    for backend, complexity, resolution, capture_mode, threading_mode in grid:
+        config = BenchmarkConfig(backend, complexity, resolution, capture_mode, threading_mode)
+        if config == REFERENCE_CONFIG:
+            result = reference
+        else:
+            result = run_replay_benchmark(video_path, config, max_frames=max_frames,
+                                          remote_address=remote_address, cache_dir=cache_dir)
+        row = {key: value for key, value in result.items() if key not in ('angles', 'states')}
+        row.update(score_against_reference(result, reference))
+        rows.append(row)
+        logger.info(
+            f"{backend} m{complexity} {config.resolution_label} {capture_mode}/{threading_mode}: "
+            f"{row['fps']:.1f} FPS, p99 {row['latency_p99_ms']:.1f} ms, "
+            f"MAE {row['angle_mae_deg']:.2f} deg"
+        )
+    return rows
+
+
+def main() -> int:
+    """Run the benchmark matrix from the command line."""
+    parser = argparse.ArgumentParser(description="Run the replay benchmark over the configuration grid")
+    parser.add_argument('video', help='Recorded clip to replay')
+    parser.add_argument('--output', default='benchmark_report', help='Output directory')
+    parser.add_argument('--backends', default='mediapipe', help=f"Comma list of {POSE_BACKENDS}")
+    parser.add_argument('--complexities', default='0,1,2', help='Comma list of model complexities')
+    parser.add_argument('--resolutions', default='native,480x360,320x240', help="Comma list of WIDTHxHEIGHT or 'native'")
+    parser.add_argument('--capture-modes', default=','.join(ReplaySource.CAPTURE_MODES))
+    parser.add_argument('--threading-modes', default=','.join(THREADING_MODES))
+    parser.add_argument('--max-frames', type=int, default=300)
+    parser.add_argument('--remote', metavar='HOST:PORT', default=None, help='Server for the remote backend')
+    parser.add_argument('--cache-dir', default=None,
+                        help='Reuse cached inference results; timings then reflect cache lookups, '
+                             'not inference, so summary.json is not updated')
+    parser.add_argument('--merge', action='append', default=[], help='Results CSV from another machine to include')
+    parser.add_argument('--max-angle-error', type=float, default=5.0, help='Accuracy bar in degrees')
+    parser.add_argument('--min-state-agreement', type=float, default=0.95, help='Accuracy bar for control states')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format='%(message)s')
+
+    rows = run_matrix(
+        args.video,
+        backends=args.backends.split(','),
+        complexities=[int(value) for value in args.complexities.split(',')],
+        resolutions=[parse_resolution(value) for value in args.resolutions.split(',')],
+        capture_modes=args.capture_modes.split(','),
+        threading_modes=args.threading_modes.split(','),
+        max_frames=args.max_frames,
+        remote_address=args.remote,
+        cache_dir=args.cache_dir
+    )
+    if args.cache_dir:
+        hits = sum(row['cache_hits'] for row in rows)
+        misses = sum(row['cache_misses'] for row in rows)
+        print(f"Inference cache: {hits} hits, {misses} misses")
+
+    os.makedirs(args.output, exist_ok=True)
+    write_csv(os.path.join(args.output, 'results.csv'), rows)
+
+    all_rows = [dict(row) for row in rows]
+    for merge_path in args.merge:
+        all_rows.extend(row for row in read_csv(merge_path) if row['hardware_class'] != hardware_class())
+
+    summary = recommend(all_rows, args.max_angle_error, args.min_state_agreement)
+    write_html(os.path.join(args.output, 'summary.html'), all_rows, summary)
+    if args.cache_dir:
+        # Cached timings measure lookups, not inference; keep them out of the
+        # summary main.py recommends settings from
+        print("Cached run: summary.json not updated")
+    else:
+        write_summary(os.path.join(args.output, 'summary.json'), summary)
+
+    print(f"Wrote {len(rows)} results to {args.output}/results.csv and summary.html")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
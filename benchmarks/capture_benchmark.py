@@ -0,0 +1,133 @@
+"""
+Capture backend benchmark for the OpenCV Minecraft Controller.
+
+Reads frames through CameraManager with each selected OpenCV backend and
+reports per-read latency (mean, p50, p99), frame interval jitter, achieved FPS
+and process CPU. Where no camera exists, use a video file (--source) or the
+GStreamer test pattern (--test-pattern); file reads are not paced, so their
+latency is the decode cost rather than sensor timing. Backends that cannot open
+the source are listed as unavailable.
+
+Usage:
+    python -m benchmarks.capture_benchmark --backends auto,v4l2,gstreamer,ffmpeg
+    python -m benchmarks.capture_benchmark --source clip.mp4 --backends ffmpeg,gstreamer
+    python -m benchmarks.capture_benchmark --test-pattern --backends gstreamer
+"""
+
+import argparse
+import logging
+import time
+from typing import Optional
+
+import numpy as np
+
+from src.controllers.camera_manager import CAPTURE_BACKENDS, CameraManager
+from src.utils.performance_report import ResourceSampler
+
+
+VIDEOTESTSRC_PIPELINE = (
+    "videotestsrc is-live=true ! video/x-raw,width={width},height={height},framerate=30/1 ! "
+    "videoconvert ! video/x-raw,format=BGR ! appsink drop=true max-buffers=1 sync=false"
+)
+
+
+def benchmark_backend(
+    backend: str,
+    camera_id: int = 0,
+    source: Optional[str] = None,
+    frames: int = 300,
+    width: int = 640,
+    height: int = 480
+) -> Optional[dict]:
+    """Capture frames with one backend and measure latency, jitter and CPU.
+
+    Args:
+        backend: Name from CAPTURE_BACKENDS
+        camera_id: Camera index used when source is None
+        source: Video file or GStreamer pipeline
+        frames: Number of frames to read
+        width: Requested width for cameras and the test pattern
+        height: Requested height for cameras and the test pattern
+
+    Returns:
+        dict of results, None if the backend could not open the source
+    """
+    camera = CameraManager(camera_id=camera_id, width=width, height=height, freeze_timeout=None,
+                           read_timeout=2.0, backend=backend, source=source)
+    if not camera.start_capture():
+        return None
+
+    read_ms = []
+    arrivals = []
+    sampler = ResourceSampler()
+    sampler.start()
+    try:
+        for _ in range(frames):
+            start = time.perf_counter()
+            frame = camera.get_frame()
+            end = time.perf_counter()
+            if frame is None:
+                break
+            read_ms.append((end - start) * 1000.0)
+            arrivals.append(end)
+        usage = sampler.stop()
+        actual_backend = camera.get_camera_info().get('backend', backend)
+    finally:
+        camera.release()
+
+    if len(read_ms) < 2:
+        return None
+
+    intervals_ms = np.diff(arrivals) * 1000.0
+    return {
+        'backend': backend,
+        'opened_with': actual_backend,
+        'frames': len(read_ms),
+        'fps': (len(arrivals) - 1) / (arrivals[-1] - arrivals[0]),
+        'read_mean_ms': float(np.mean(read_ms)),
+        'read_p50_ms': float(np.percentile(read_ms, 50)),
+        'read_p99_ms': float(np.percentile(read_ms, 99)),
+        'jitter_ms': float(np.std(intervals_ms)),
+        'cpu_percent': usage['cpu_percent'],
+    }
+
+
+def main() -> int:
+    """Run the capture backend benchmark."""
+    parser = argparse.ArgumentParser(description="Compare OpenCV capture backends")
+    parser.add_argument('--backends', default='auto,v4l2,gstreamer,ffmpeg',
+                        help=f"Comma list of {tuple(CAPTURE_BACKENDS)}")
+    parser.add_argument('--camera-id', type=int, default=0)
+    parser.add_argument('--source', default=None, help='Video file or GStreamer pipeline instead of the camera')
+    parser.add_argument('--test-pattern', action='store_true',
+                        help='Use the GStreamer videotestsrc pattern (gstreamer backend only)')
+    parser.add_argument('--frames', type=int, default=300)
+    parser.add_argument('--width', type=int, default=640)
+    parser.add_argument('--height', type=int, default=480)
+    args = parser.parse_args()
+
+    # CameraManager logs open failures; the table reports them
+    logging.basicConfig(level=logging.CRITICAL)
+
+    source = args.source
+    if args.test_pattern:
+        source = VIDEOTESTSRC_PIPELINE.format(width=args.width, height=args.height)
+
+    print(f"{'backend':<12} {'opened':<10} {'frames':>6} {'fps':>7} {'mean ms':>8} "
+          f"{'p50 ms':>7} {'p99 ms':>7} {'jitter':>7} {'cpu %':>6}")
+    for backend in args.backends.split(','):
+        if backend not in CAPTURE_BACKENDS:
+            print(f"{backend:<12} unknown backend")
+            continue
+        result = benchmark_backend(backend, args.camera_id, source, args.frames, args.width, args.height)
+        if result is None:
+            print(f"{backend:<12} unavailable")
+            continue
+        print(f"{backend:<12} {result['opened_with']:<10} {result['frames']:>6} {result['fps']:>7.1f} "
+              f"{result['read_mean_ms']:>8.2f} {result['read_p50_ms']:>7.2f} {result['read_p99_ms']:>7.2f} "
+              f"{result['jitter_ms']:>7.2f} {result['cpu_percent']:>6.1f}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,327 @@
+"""
+Fault and latency injection scenarios for the OpenCV Minecraft Controller.
+
+Runs the real ApplicationController loop (camera manager, angle calculator,
+control state handling) against a synthetic camera and a scripted user, then
+injects one fault scenario at a time with the wrappers in
+src/controllers/fault_injection.py: slow, failing or frozen camera reads,
+detector spikes and failures, and a blocking or failing mouse backend. Faults
+are drawn from a seeded schedule, so every run injects the same faults.
+
+The scripted user cycles through left click, neutral, right click and
+neutral; each synthetic frame encodes its capture time, so the scripted
+detector sees the pose the user held when the frame was taken (a frozen
+frame shows a stale pose). For each scenario the report gives:
+
+- dropped: camera frames never processed (skipped by slow reads, failed,
+  frozen or lost to detector errors)
+- stuck s: time a mouse button was held while the user was not asking for it
+- recovery s: time from the end of the fault window until the mouse last
+  disagreed with the user for longer than RECOVERY_TOLERANCE_S ('never' if
+  it did not follow the user for a full script cycle before the run ended)
+
+Scenarios run on a VirtualClock by default, so a 30 s scenario takes well
+under a second. --real-time runs on the SystemClock instead, which also
+exercises the camera read deadline.
+
+Usage:
+    python -m benchmarks.fault_benchmark
+    python -m benchmarks.fault_benchmark --scenarios slow_camera,frozen_camera --duration 60 --seed 3
+"""
+
+import argparse
+import logging
+import math
+from typing import Dict, List, Optional, Tuple
+
+import numpy as np
+
+from src.controllers.application_controller import ApplicationController
+from src.controllers.camera_manager import CameraManager
+from src.controllers.fault_injection import (
+    FaultSchedule, FaultSpec, FaultyCamera, FaultyMouseController, FaultyPoseDetector
+)
+from src.models.data_models import ArmKeypoints, Point
+from src.models.enums import ControlState
+from src.utils.angle_calculator import AngleCalculator
+from src.utils.clock import SystemClock, VirtualClock
+
+
+FPS = 30.0
+FAULT_WINDOW = (10.0, 20.0)
+RECOVERY_TOLERANCE_S = 0.1
+
+# Scripted user: (seconds into the cycle the segment ends, elbow angle, state asked for)
+USER_SCRIPT = [
+    (1.5, 150.0, ControlState.LEFT_CLICK),
+    (2.5, 75.0, ControlState.NEUTRAL),
+    (3.5, 30.0, ControlState.RIGHT_CLICK),
+    (4.0, 75.0, ControlState.NEUTRAL),
+]
+
+# name -> (component, fault spec); windows are FAULT_WINDOW unless the fault runs throughout
+SCENARIOS: Dict[str, Tuple[Optional[str], FaultSpec]] = {
+    'baseline': (None, FaultSpec()),
+    'slow_camera': ('camera', FaultSpec(delay_s=0.2, start_s=FAULT_WINDOW[0], end_s=FAULT_WINDOW[1])),
+    'failing_camera': ('camera', FaultSpec(failure_probability=0.3, start_s=FAULT_WINDOW[0], end_s=FAULT_WINDOW[1])),
+    'frozen_camera': ('camera', FaultSpec(freeze_probability=1.0, freeze_s=FAULT_WINDOW[1] - FAULT_WINDOW[0],
+                                          start_s=FAULT_WINDOW[0], end_s=FAULT_WINDOW[1])),
+    'process_spikes': ('detector', FaultSpec(delay_s=0.15, delay_probability=0.1)),
+    'failing_detector': ('detector', FaultSpec(failure_probability=0.2, start_s=FAULT_WINDOW[0],
+                                               end_s=FAULT_WINDOW[1])),
+    'blocking_mouse': ('mouse', FaultSpec(delay_s=0.3, delay_probability=0.5, start_s=FAULT_WINDOW[0],
+                                          end_s=FAULT_WINDOW[1])),
+    'failing_mouse': ('mouse', FaultSpec(failure_probability=0.5, start_s=FAULT_WINDOW[0], end_s=FAULT_WINDOW[1])),
+}
+
+
+def user_pose(seconds: float) -> Tuple[float, ControlState]:
+    """Return the elbow angle and control state the scripted user holds at a time."""
+    cycle = USER_SCRIPT[-1][0]
+    position = seconds % cycle
+    for end, angle, state in USER_SCRIPT:
+        if position < end:
+            return angle, state
+    return USER_SCRIPT[-1][1], USER_SCRIPT[-1][2]
+
+
+class SyntheticCapture:
+    """Capture producing FPS frames against the clock; each frame encodes its index."""
+
+    def __init__(self, clock, fps: float = FPS, shape=(48, 64, 3)):
+        self.clock = clock
+        self.fps = fps
+        self.shape = shape
+        self.origin = clock.now()
+        self._last_index = -1
+
+    def read(self):
+        """Wait for the next frame (or return the newest one when late)."""
+        elapsed = self.clock.now() - self.origin
+        index = max(self._last_index + 1, int(math.floor(elapsed * self.fps + 1e-9)))
+        self.clock.sleep(self.origin + index / self.fps - self.clock.now())
+        self._last_index = index
+        frame = np.empty(self.shape, dtype=np.uint8)
+        frame[..., 0] = index & 0xFF
+        frame[..., 1] = (index >> 8) & 0xFF
+        frame[..., 2] = (index >> 16) & 0xFF
+        return True, frame
+
+    def isOpened(self) -> bool:
+        return True
+
+    def set(self, prop, value) -> bool:
+        return False
+
+    def get(self, prop) -> float:
+        return 0.0
+
+    def getBackendName(self) -> str:
+        return 'SYNTHETIC'
+
+    def release(self) -> None:
+        pass
+
+
+def frame_index(frame: np.ndarray) -> int:
+    """Decode the index written by SyntheticCapture."""
+    b, g, r = (int(value) for value in frame[0, 0])
+    return b | (g << 8) | (r << 16)
+
+
+class SyntheticCamera(CameraManager):
+    """CameraManager reading the synthetic capture; reopening continues its timeline."""
+
+    def __init__(self, clock, **kwargs):
+        super().__init__(clock=clock, **kwargs)
+        self.capture = SyntheticCapture(clock)
+
+    def _open_capture(self):
+        return self.capture
+
+
+class ScriptedPoseDetector:
+    """Returns the scripted user's arm pose at the time a frame was captured."""
+
+    def __init__(self):
+        self.processed = set()
+
+    def detect_pose(self, frame):
+        index = frame_index(frame)
+        self.processed.add(index)
+        angle, _ = user_pose(index / FPS)
+        return ('scripted', angle)
+
+    def get_arm_keypoints(self, landmarks) -> ArmKeypoints:
+        angle = math.radians(landmarks[1])
+        elbow = Point(0.5, 0.5, 0.0)
+        shoulder = Point(0.5, 0.3, 0.0)
+        wrist = Point(0.5 + 0.2 * math.sin(angle), 0.5 - 0.2 * math.cos(angle), 0.0)
+        return ArmKeypoints(shoulder, elbow, wrist, 0.9)
+
+
+class RecordingMouse:
+    """Mouse backend recording when each button state started."""
+
+    def __init__(self, clock):
+        self.clock = clock
+        self.state = ControlState.NEUTRAL
+        self.events: List[Tuple[float, ControlState]] = [(clock.now(), ControlState.NEUTRAL)]
+
+    def set_state(self, state: ControlState) -> None:
+        if state != self.state:
+            self.state = state
+            self.events.append((self.clock.now(), state))
+
+    def release_all(self) -> None:
+        self.set_state(ControlState.NEUTRAL)
+
+    def get_current_state(self) -> ControlState:
+        return self.state
+
+    def is_healthy(self) -> bool:
+        return True
+
+
+class HeadlessDisplay:
+    """Display stand-in that stops the controller after the scenario duration."""
+
+    show_pose_overlay = False
+    show_angle_info = False
+
+    def __init__(self, clock, stop_at: float):
+        self.clock = clock
+        self.stop_at = stop_at
+
+    def draw_control_state_indicator(self, frame, state):
+        return frame
+
+    def show_frame(self, frame) -> None:
+        pass
+
+    def handle_key_input(self):
+        return 'q' if self.clock.now() >= self.stop_at else None
+
+
+def recovery_time(grid: np.ndarray, matches: np.ndarray, fault_end: float,
+                  tolerance: float = RECOVERY_TOLERANCE_S) -> float:
+    """Return how long after fault_end the mouse last disagreed with the user.
+
+    Disagreements shorter than tolerance (the normal reaction to a pose
+    change) are ignored. Recovery only counts once the mouse then follows the
+    user for a whole script cycle.
+
+    Returns:
+        Seconds after fault_end, 0.0 if it already agreed, inf if it had not
+        recovered by the end of the run
+    """
+    after = grid >= fault_end
+    mismatched = ~matches[after]
+    times = grid[after]
+    if not mismatched.any():
+        return 0.0
+    # Boundaries of mismatch runs: starts where mismatched turns on, ends where it turns off
+    edges = np.diff(np.concatenate(([0], mismatched.astype(np.int8), [0])))
+    starts, ends = np.nonzero(edges == 1)[0], np.nonzero(edges == -1)[0]
+    step = grid[1] - grid[0] if grid.size > 1 else 0.001
+    long_runs = [(start, end) for start, end in zip(starts, ends) if (end - start) * step > tolerance]
+    if not long_runs:
+        return 0.0
+    last_end = long_runs[-1][1]
+    if last_end >= len(times) or times[-1] - times[last_end] < USER_SCRIPT[-1][0]:
+        return math.inf
+    return float(times[last_end] - fault_end)
+
+
+def run_scenario(name: str, duration: float, seed: int, real_time: bool = False) -> dict:
+    """Run one scenario and measure its effect on the controller.
+
+    Returns:
+        dict with dropped frames, stuck-button and recovery times and fault counts
+    """
+    component, spec = SCENARIOS[name]
+    clock = SystemClock() if real_time else VirtualClock()
+    origin = clock.now()
+
+    camera = SyntheticCamera(clock, read_timeout=0.5 if real_time else None)
+    detector = ScriptedPoseDetector()
+    mouse = RecordingMouse(clock)
+    schedule = FaultSchedule(spec, seed=seed, clock=clock)
+
+    controller = ApplicationController(clock=clock)
+    controller.camera_manager = FaultyCamera(camera, schedule) if component == 'camera' else camera
+    controller.pose_detector = FaultyPoseDetector(detector, schedule) if component == 'detector' else detector
+    controller.mouse_controller = FaultyMouseController(mouse, schedule) if component == 'mouse' else mouse
+    controller.display_manager = HeadlessDisplay(clock, origin + duration)
+    controller.angle_calculator = AngleCalculator()
+
+    if not controller.camera_manager.start_capture():
+        raise RuntimeError("synthetic camera failed to start")
+    controller.run()
+    ended = clock.now() - origin
+    camera.release()
+
+    # Compare the mouse with the user on a 1 ms grid
+    grid = np.arange(0.0, ended, 0.001)
+    event_times = np.array([event_time - origin for event_time, _ in mouse.events])
+    event_states = np.array([state for _, state in mouse.events], dtype=object)
+    held = event_states[np.searchsorted(event_times, grid, side='right') - 1]
+    wanted = np.array([user_pose(t)[1] for t in grid], dtype=object)
+    matches = held == wanted
+    stuck = (held != ControlState.NEUTRAL) & ~matches
+
+    recovery = None
+    if spec.end_s is not None and component is not None:
+        recovery = recovery_time(grid, matches, spec.end_s)
+
+    expected = int(ended * FPS)
+    return {
+        'scenario': name,
+        'ran_s': ended,
+        'expected_frames': expected,
+        'dropped': max(0, expected - len(detector.processed)),
+        'stuck_s': float(stuck.sum()) * 0.001,
+        'recovery_s': recovery,
+        'faults': schedule.get_stats(),
+        'camera_frozen_events': camera.frozen_events,
+        'camera_read_timeouts': camera.read_timeouts,
+        'pose_control_enabled': controller.system_state.pose_control_enabled,
+    }
+
+
+def main() -> int:
+    """Run the fault scenarios and print the report."""
+    parser = argparse.ArgumentParser(description="Fault and latency injection scenarios")
+    parser.add_argument('--scenarios', default=','.join(SCENARIOS), help=f"Comma list of {tuple(SCENARIOS)}")
+    parser.add_argument('--duration', type=float, default=30.0, help='Seconds per scenario')
+    parser.add_argument('--seed', type=int, default=0, help='Fault schedule seed')
+    parser.add_argument('--real-time', action='store_true', help='Run on the system clock instead of virtual time')
+    args = parser.parse_args()
+
+    # The controller logs every injected fault; the report summarizes them
+    logging.basicConfig(level=logging.CRITICAL)
+
+    print(f"{'scenario':<17} {'frames':>6} {'dropped':>7} {'stuck s':>8} {'recovery s':>10} "
+          f"{'faults':>6} {'frozen':>6} {'timeouts':>8}  notes")
+    for name in args.scenarios.split(','):
+        if name not in SCENARIOS:
+            print(f"{name:<17} unknown scenario")
+            continue
+        result = run_scenario(name, args.duration, args.seed, args.real_time)
+        faults = result['faults']
+        injected = faults['delays'] + faults['failures'] + faults['freezes']
+        recovery = result['recovery_s']
+        recovery_text = '-' if recovery is None else 'never' if math.isinf(recovery) else f"{recovery:.3f}"
+        notes = []
+        if result['ran_s'] < args.duration - 1.0 / FPS:
+            notes.append(f"controller stopped at {result['ran_s']:.1f} s")
+        if not result['pose_control_enabled']:
+            notes.append("pose control disabled")
+        print(f"{name:<17} {result['expected_frames']:>6} {result['dropped']:>7} {result['stuck_s']:>8.3f} "
+              f"{recovery_text:>10} {injected:>6} {result['camera_frozen_events']:>6} "
+              f"{result['camera_read_timeouts']:>8}  {', '.join(notes)}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
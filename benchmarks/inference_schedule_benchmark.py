@@ -0,0 +1,171 @@
+"""
+Inference rate saved and decision latency added by adaptive inference.
+
+Generates a seeded elbow-angle trace at the camera frame rate: the arm holds a
+pose (resting neutral, held clicks, or hovering near a threshold) with sensor
+noise and tremor, then moves to the next pose at a random speed. Every frame
+runs through AngleCalculator as the controller does without scheduling; the
+same trace then runs through InferenceScheduler, which only measures the
+angle on the frames it schedules and keeps the last decision otherwise.
+
+For each scheduler setting the report gives:
+
+- infer %: frames that ran inference (the rest of the inference cost is saved)
+- latency ms: mean / p99 / max delay from a state change on the every-frame
+  path to the same change on the scheduled path
+- missed: state changes the scheduled path never made because the state had
+  already changed again (flicks shorter than the skip interval, or noise
+  crossing a threshold for a frame or two while hovering)
+- differ %: frames on which the two paths decided differently
+
+Usage:
+    python -m benchmarks.inference_schedule_benchmark
+    python -m benchmarks.inference_schedule_benchmark --duration 600 --max-speed 800 --seed 3
+"""
+
+import argparse
+from typing import List, Tuple
+
+import numpy as np
+
+from src.models.enums import ControlState
+from src.utils.angle_calculator import AngleCalculator
+from src.utils.inference_scheduler import InferenceScheduler
+from src.utils.performance_report import latency_percentiles
+
+
+# (name, max_interval s, safety_factor, idle_speed deg/s)
+SETTINGS = [
+    ('conservative', 0.1, 3.0, 240.0),
+    ('default', 0.2, 2.0, 120.0),
+    ('aggressive', 0.33, 1.5, 60.0),
+]
+
+# Pose targets in degrees: resting neutral, held clicks, and hovering near a threshold
+POSES = {
+    'neutral': (70.0, 80.0),
+    'left': (130.0, 170.0),
+    'right': (25.0, 45.0),
+    'hover': (84.0, 88.0),
+}
+
+
+def angle_trace(duration: float, fps: float, max_speed: float, seed: int) -> np.ndarray:
+    """Generate a per-frame elbow angle trace.
+
+    Args:
+        duration: Trace length in seconds
+        fps: Frame rate
+        max_speed: Fastest movement between poses in degrees per second
+        seed: Random seed
+
+    Returns:
+        Angles in degrees, one per frame
+    """
+    rng = np.random.default_rng(seed)
+    frames = int(duration * fps)
+    angles = np.empty(frames)
+    angle = 75.0
+    index = 0
+    names = list(POSES)
+    while index < frames:
+        # Hold a pose with slow tremor
+        hold = int(rng.uniform(0.5, 4.0) * fps)
+        tremor = np.cumsum(rng.normal(0.0, 0.15, hold))
+        angles[index:index + hold] = (angle + tremor)[:frames - index]
+        index += hold
+        angle = float(np.clip(angle + tremor[-1], 5.0, 175.0))
+
+        # Move to the next pose with a smooth (cosine) velocity profile
+        low, high = POSES[names[rng.integers(len(names))]]
+        target = rng.uniform(low, high)
+        speed = rng.uniform(60.0, max_speed)
+        steps = max(1, int(abs(target - angle) / speed * fps))
+        ramp = (1 - np.cos(np.linspace(0, np.pi, steps + 1)[1:])) / 2
+        angles[index:index + steps] = (angle + (target - angle) * ramp)[:frames - index]
+        index += steps
+        angle = target
+    # Landmark noise on every measurement
+    return np.clip(angles + rng.normal(0.0, 0.5, frames), 0.0, 180.0)
+
+
+def every_frame_states(angles: np.ndarray) -> List[ControlState]:
+    """Decide every frame, as the controller does without scheduling."""
+    calculator = AngleCalculator()
+    return [calculator.get_control_state(float(angle)) for angle in angles]
+
+
+def scheduled_states(angles: np.ndarray, fps: float, scheduler: InferenceScheduler) -> List[ControlState]:
+    """Decide only on the frames the scheduler asks for, keeping the last decision otherwise."""
+    calculator = AngleCalculator()
+    states = []
+    state = ControlState.NEUTRAL
+    for index, angle in enumerate(angles):
+        now = index / fps
+        if scheduler.should_infer(now):
+            angle = float(angle)
+            state = calculator.get_control_state(angle)
+            scheduler.record(now, angle, calculator.get_threshold_margin(angle))
+        states.append(state)
+    return states
+
+
+def transitions(states: List[ControlState]) -> List[Tuple[int, ControlState]]:
+    """Return (frame, new state) for each state change."""
+    return [(index, state) for index, state in enumerate(states) if index and state != states[index - 1]]
+
+
+def compare(reference: List[ControlState], scheduled: List[ControlState], fps: float) -> dict:
+    """Measure how late the scheduled decisions follow the every-frame decisions."""
+    changes = transitions(reference)
+    latencies_ms = []
+    missed = 0
+    for position, (frame, state) in enumerate(changes):
+        end = changes[position + 1][0] if position + 1 < len(changes) else len(scheduled)
+        caught = next((index for index in range(frame, end) if scheduled[index] == state), None)
+        if caught is None:
+            missed += 1
+        else:
+            latencies_ms.append((caught - frame) / fps * 1000.0)
+    differ = sum(a != b for a, b in zip(reference, scheduled))
+    latency = latency_percentiles(latencies_ms)
+    return {
+        'changes': len(changes),
+        'missed': missed,
+        'latency_mean_ms': latency['mean'],
+        'latency_p99_ms': latency['p99'],
+        'latency_max_ms': max(latencies_ms, default=0.0),
+        'differ_fraction': differ / len(reference) if reference else 0.0,
+    }
+
+
+def main() -> int:
+    """Run the inference scheduling benchmark."""
+    parser = argparse.ArgumentParser(description="Adaptive inference: rate saved and latency added")
+    parser.add_argument('--duration', type=float, default=300.0, help='Trace length in seconds')
+    parser.add_argument('--fps', type=float, default=30.0, help='Camera frame rate')
+    parser.add_argument('--max-speed', type=float, default=500.0, help='Fastest arm movement in deg/s')
+    parser.add_argument('--seed', type=int, default=0, help='Trace seed')
+    args = parser.parse_args()
+
+    angles = angle_trace(args.duration, args.fps, args.max_speed, args.seed)
+    reference = every_frame_states(angles)
+
+    print(f"{len(angles)} frames at {args.fps:.0f} fps, {len(transitions(reference))} state changes, "
+          f"moves up to {args.max_speed:.0f} deg/s")
+    print(f"{'setting':<13} {'interval':>8} {'infer %':>8} {'saved %':>8} {'latency ms':>20} "
+          f"{'missed':>7} {'differ %':>9}")
+    print(f"{'every frame':<13} {'':>8} {100.0:>8.1f} {0.0:>8.1f} {'0 / 0 / 0':>20} {0:>7} {0.0:>9.2f}")
+    for name, max_interval, safety_factor, idle_speed in SETTINGS:
+        scheduler = InferenceScheduler(max_interval=max_interval, safety_factor=safety_factor, idle_speed=idle_speed)
+        result = compare(reference, scheduled_states(angles, args.fps, scheduler), args.fps)
+        rate = scheduler.get_stats()['inference_rate'] * 100.0
+        latency = f"{result['latency_mean_ms']:.0f} / {result['latency_p99_ms']:.0f} / {result['latency_max_ms']:.0f}"
+        print(f"{name:<13} {max_interval:>7.2f}s {rate:>8.1f} {100.0 - rate:>8.1f} {latency:>20} "
+              f"{result['missed']:>7} {result['differ_fraction'] * 100.0:>9.2f}")
+    print("latency ms: mean / p99 / max delay of each state change versus deciding every frame")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,99 @@
+"""
+Offline labeling throughput against the number of worker processes.
+
+Writes a synthetic clip and labels it with OfflineLabeler at several worker
+counts, reporting labeled frames per second and the speedup over one worker.
+By default each frame runs a CPU-bound stand-in for pose inference (repeated
+blurs at the model input size) so the benchmark needs no MediaPipe model;
+--mediapipe uses the real PoseDetector instead. Speedup is bounded by the
+CPU cores available (shown in the header) and by the warm-up frames each
+extra chunk decodes and discards.
+
+Usage:
+    python -m benchmarks.labeling_benchmark
+    python -m benchmarks.labeling_benchmark --frames 1200 --workers 1,2,4,8 --warmup 30
+    python -m benchmarks.labeling_benchmark --video session.mp4 --mediapipe
+"""
+
+import argparse
+import functools
+import os
+import tempfile
+
+import cv2
+import numpy as np
+
+from src.controllers.offline_labeler import OfflineLabeler
+from src.controllers.pose_detector import LandmarkPoint, PoseDetector, PoseLandmarks
+
+
+class SyntheticDetector(PoseDetector):
+    """CPU-bound detector stand-in returning a fixed left arm pose."""
+
+    def __init__(self, passes: int = 8):
+        self.confidence_threshold = 0.5
+        self.passes = passes
+        self._last_detection_successful = False
+        landmarks = [LandmarkPoint(0.5, 0.5, 0.0, 0.9)] * 33
+        landmarks[11] = LandmarkPoint(0.2, 0.5, 0.0, 0.9)
+        landmarks[13] = LandmarkPoint(0.4, 0.5, 0.0, 0.9)
+        landmarks[15] = LandmarkPoint(0.4, 0.3, 0.0, 0.9)
+        self._landmarks = PoseLandmarks(landmarks=landmarks)
+
+    def detect_pose(self, frame):
+        image = cv2.resize(frame, (256, 256))
+        for _ in range(self.passes):
+            image = cv2.GaussianBlur(image, (9, 9), 0)
+        return self._landmarks
+
+    def __del__(self):
+        pass
+
+
+def write_clip(path: str, frames: int, width: int = 640, height: int = 480) -> None:
+    """Write a clip of moving noise."""
+    rng = np.random.default_rng(0)
+    base = rng.integers(0, 255, (height, width * 2, 3), dtype=np.uint8)
+    writer = cv2.VideoWriter(path, cv2.VideoWriter_fourcc(*'MJPG'), 30, (width, height))
+    for index in range(frames):
+        offset = index % width
+        writer.write(np.ascontiguousarray(base[:, offset:offset + width]))
+    writer.release()
+
+
+def main() -> int:
+    """Run the labeling benchmark."""
+    parser = argparse.ArgumentParser(description="Offline labeling fps by worker count")
+    parser.add_argument('--video', help='Video to label (default: a synthetic clip)')
+    parser.add_argument('--frames', type=int, default=600, help='Synthetic clip length')
+    parser.add_argument('--workers', default='1,2,4', help='Comma list of worker counts')
+    parser.add_argument('--warmup', type=int, default=30, help='Warm-up frames per chunk')
+    parser.add_argument('--mediapipe', action='store_true', help='Use the real PoseDetector')
+    args = parser.parse_args()
+
+    factory = functools.partial(PoseDetector, model_complexity=0) if args.mediapipe else SyntheticDetector
+    with tempfile.TemporaryDirectory() as temp_dir:
+        video = args.video
+        if video is None:
+            video = os.path.join(temp_dir, 'clip.avi')
+            write_clip(video, args.frames)
+        output = os.path.join(temp_dir, 'labels.klmr')
+
+        print(f"{os.cpu_count()} CPU cores, {'PoseDetector' if args.mediapipe else 'synthetic detector'}, "
+              f"{args.warmup} warm-up frames per chunk")
+        print(f"{'workers':>7} {'frames':>7} {'seconds':>8} {'fps':>8} {'speedup':>8} {'warm-up %':>9}")
+        baseline = None
+        for workers in (int(value) for value in args.workers.split(',')):
+            result = OfflineLabeler(video, output, workers=workers, warmup_frames=args.warmup,
+                                    detector_factory=factory).run()
+            if result is None:
+                return 1
+            baseline = baseline or result['fps']
+            warmup = sum(chunk['warmup_frames'] for chunk in result['chunk_results'])
+            print(f"{workers:>7} {result['frames']:>7} {result['seconds']:>8.2f} {result['fps']:>8.1f} "
+                  f"{result['fps'] / baseline:>7.2f}x {warmup / result['frames'] * 100.0:>9.1f}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,96 @@
+"""
+Throughput and accuracy benchmark for the landmark codec.
+
+Measures encode and decode frames per second for whole sequences and for the
+per-frame stream coder, and reports the compression ratio and elbow angle
+error. Uses a landmark log written by the replay benchmark (--landmark-log) or,
+without one, a synthetic random walk.
+
+Usage:
+    python -m benchmarks.landmark_codec_benchmark
+    python -m benchmarks.landmark_codec_benchmark --log run.klmd
+"""
+
+import argparse
+import time
+
+import numpy as np
+
+from src.models.landmark_codec import (
+    LandmarkStreamDecoder, LandmarkStreamEncoder, codec_report,
+    decode_landmark_sequence, encode_landmark_sequence
+)
+
+
+def synthetic_landmarks(frames: int, seed: int = 0) -> np.ndarray:
+    """Create a smooth random walk of (frames, 33, 4) landmarks."""
+    rng = np.random.default_rng(seed)
+    base = rng.random((33, 4), dtype=np.float32) * 0.6 + 0.2
+    steps = rng.normal(0.0, 0.002, (frames, 33, 4)).astype(np.float32)
+    return base + np.cumsum(steps, axis=0)
+
+
+def frames_per_second(function, frames: int, repeat: int = 5) -> float:
+    """Return the best frames per second over repeat runs of function()."""
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        function()
+        best = min(best, time.perf_counter() - start)
+    return frames / best
+
+
+def main() -> int:
+    """Run the landmark codec benchmark."""
+    parser = argparse.ArgumentParser(description="Landmark codec benchmark")
+    parser.add_argument('--log', default=None, help='Landmark log from the replay benchmark')
+    parser.add_argument('--frames', type=int, default=10000, help='Synthetic frames when no log is given')
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, 'rb') as log_file:
+            landmarks, present = decode_landmark_sequence(log_file.read())
+    else:
+        landmarks = synthetic_landmarks(args.frames)
+        present = np.ones(len(landmarks), dtype=bool)
+    frames = len(landmarks)
+    if frames == 0:
+        print("No frames to benchmark")
+        return 1
+
+    print(f"{'mode':24} {'encode fps':>12} {'decode fps':>12} {'ratio':>7} {'max err deg':>12}")
+    for compress in (False, True):
+        encoded = encode_landmark_sequence(landmarks, present, compress=compress)
+        report = codec_report(landmarks, present, compress=compress)
+        encode_fps = frames_per_second(lambda: encode_landmark_sequence(landmarks, present, compress=compress), frames)
+        decode_fps = frames_per_second(lambda: decode_landmark_sequence(encoded), frames)
+        name = 'sequence+zlib' if compress else 'sequence'
+        print(f"{name:24} {encode_fps:12.0f} {decode_fps:12.0f} "
+              f"{report['compression_ratio']:7.2f} {report['angle_error_max_deg']:12.4f}")
+
+    poses = [frame if has_pose else None for frame, has_pose in zip(landmarks, present)]
+    for compress in (False, True):
+        encoder = LandmarkStreamEncoder(compress=compress)
+        stream = [encoder.encode(pose) for pose in poses]
+
+        def encode_stream():
+            stream_encoder = LandmarkStreamEncoder(compress=compress)
+            for pose in poses:
+                stream_encoder.encode(pose)
+
+        def decode_stream():
+            decoder = LandmarkStreamDecoder()
+            for data in stream:
+                decoder.decode(data)
+
+        ratio = landmarks.nbytes / sum(len(data) for data in stream)
+        name = 'stream+zlib' if compress else 'stream'
+        print(f"{name:24} {frames_per_second(encode_stream, frames, 3):12.0f} "
+              f"{frames_per_second(decode_stream, frames, 3):12.0f} {ratio:7.2f} {'':>12}")
+
+    print(f"{frames} frames; ratio is against float32 landmarks (528 bytes per frame)")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
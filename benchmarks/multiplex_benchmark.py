@@ -0,0 +1,187 @@
+"""
+Multi-source capture benchmark: round-robin reads against the multiplexer.
+
+Reads several sources for a fixed duration with three strategies:
+
+- roundrobin: one loop calling get_frame() on each source in turn
+- threads: CaptureMultiplexer with one reader thread per source
+- waitany: CaptureMultiplexer on cv2.VideoCapture.waitAny (V4L2 cameras only)
+
+and reports, per source, the delivered frame rate and the p50/p99 latency from
+the moment a frame became available to the moment the consumer received it.
+
+By default the sources are synthetic cameras that produce frames at the
+given rates (like a driver with a one-frame buffer, a late reader gets the
+newest frame), so the availability time of every frame is known exactly.
+With --cameras, real cameras are opened on the V4L2 backend; their
+availability time is not observable, so only frame rate and arrival jitter are
+reported. --process-ms adds per-frame consumer work, e.g. pose detection.
+
+Usage:
+    python -m benchmarks.multiplex_benchmark --fps 30,15 --duration 5
+    python -m benchmarks.multiplex_benchmark --cameras 0,2 --modes roundrobin,waitany,threads
+"""
+
+import argparse
+import logging
+import struct
+import time
+from typing import List, Optional
+
+import numpy as np
+
+from src.controllers.camera_manager import CameraManager
+from src.controllers.capture_multiplexer import CaptureMultiplexer
+from src.utils.performance_report import ResourceSampler, latency_percentiles
+
+
+MODES = ('roundrobin', 'threads', 'waitany')
+
+
+class SyntheticCamera:
+    """Produces frames at a fixed rate; each frame carries its availability time."""
+
+    def __init__(self, fps: float, frame_shape=(480, 640, 3)):
+        self.interval = 1.0 / fps
+        self.frame_shape = frame_shape
+        self._start = time.perf_counter()
+        self._last_index = -1
+
+    def get_frame(self) -> np.ndarray:
+        """Block until the next frame is available and return the newest one."""
+        now = time.perf_counter()
+        newest = int((now - self._start) / self.interval)
+        index = max(self._last_index + 1, newest)
+        available_at = self._start + index * self.interval
+        if available_at > now:
+            time.sleep(available_at - now)
+        self._last_index = index
+        frame = np.zeros(self.frame_shape, dtype=np.uint8)
+        frame.reshape(-1)[:8] = np.frombuffer(struct.pack('<d', available_at), dtype=np.uint8)
+        return frame
+
+
+def available_at(frame: np.ndarray) -> float:
+    """Return the availability time stamped into a synthetic frame."""
+    return struct.unpack('<d', frame.reshape(-1)[:8].tobytes())[0]
+
+
+def busy_wait(milliseconds: float) -> None:
+    """Spin for the given time, standing in for per-frame processing."""
+    deadline = time.perf_counter() + milliseconds / 1000.0
+    while time.perf_counter() < deadline:
+        pass
+
+
+def run_mode(mode: str, sources: List, duration: float, process_ms: float, synthetic: bool) -> Optional[dict]:
+    """Consume all sources with one strategy for the given duration.
+
+    Returns:
+        dict of per-source results and CPU use, None if the mode is unsupported
+    """
+    latencies = [[] for _ in sources]
+    arrivals = [[] for _ in sources]
+
+    def consume(source_id: int, frame: np.ndarray) -> None:
+        received = time.perf_counter()
+        arrivals[source_id].append(received)
+        if synthetic:
+            latencies[source_id].append((received - available_at(frame)) * 1000.0)
+        busy_wait(process_ms)
+
+    sampler = ResourceSampler()
+    multiplexer = None
+    if mode != 'roundrobin':
+        multiplexer = CaptureMultiplexer(sources, mode=mode, queue_size=len(sources) * 2)
+        try:
+            multiplexer.start()
+        except RuntimeError:
+            return None
+
+    sampler.start()
+    deadline = time.perf_counter() + duration
+    try:
+        while time.perf_counter() < deadline:
+            if multiplexer is None:
+                for source_id, source in enumerate(sources):
+                    frame = source.get_frame()
+                    if frame is not None:
+                        consume(source_id, frame)
+            else:
+                item = multiplexer.get(timeout=0.5)
+                if item is not None:
+                    consume(item.source_id, item.frame)
+        usage = sampler.stop()
+    finally:
+        if multiplexer is not None:
+            multiplexer.close()
+
+    per_source = []
+    for source_id in range(len(sources)):
+        times = arrivals[source_id]
+        intervals_ms = np.diff(times) * 1000.0 if len(times) > 1 else np.zeros(1)
+        per_source.append({
+            'fps': len(times) / duration,
+            'latency': latency_percentiles(latencies[source_id]),
+            'jitter_ms': float(np.std(intervals_ms)),
+        })
+    return {
+        'sources': per_source,
+        'dropped': multiplexer.get_stats()['dropped'] if multiplexer is not None else 0,
+        'cpu_percent': usage['cpu_percent'],
+    }
+
+
+def main() -> int:
+    """Run the multiplexing benchmark."""
+    parser = argparse.ArgumentParser(description="Compare round-robin and multiplexed multi-source capture")
+    parser.add_argument('--fps', default='30,15', help='Comma list of synthetic source frame rates')
+    parser.add_argument('--cameras', default=None, help='Comma list of camera IDs to use instead (V4L2)')
+    parser.add_argument('--modes', default=','.join(MODES), help=f"Comma list of {MODES}")
+    parser.add_argument('--duration', type=float, default=5.0, help='Seconds per mode')
+    parser.add_argument('--process-ms', type=float, default=0.0, help='Simulated consumer work per frame')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.CRITICAL)
+
+    cameras = []
+    if args.cameras:
+        for camera_id in (int(value) for value in args.cameras.split(',')):
+            camera = CameraManager(camera_id=camera_id, freeze_timeout=None, backend='v4l2')
+            if not camera.start_capture():
+                print(f"Cannot open camera {camera_id}")
+                for opened in cameras:
+                    opened.release()
+                return 1
+            cameras.append(camera)
+        labels = [f"camera {camera.camera_id}" for camera in cameras]
+    else:
+        rates = [float(value) for value in args.fps.split(',')]
+        labels = [f"{rate:g} fps" for rate in rates]
+
+    print(f"{'mode':<11} {'source':<10} {'fps':>6} {'p50 ms':>7} {'p99 ms':>7} {'jitter':>7} "
+          f"{'dropped':>7} {'cpu %':>6}")
+    try:
+        for mode in args.modes.split(','):
+            if mode not in MODES:
+                print(f"{mode:<11} unknown mode")
+                continue
+            sources = cameras or [SyntheticCamera(rate) for rate in rates]
+            result = run_mode(mode, sources, args.duration, args.process_ms, synthetic=not cameras)
+            if result is None:
+                print(f"{mode:<11} unsupported by these sources")
+                continue
+            for label, source in zip(labels, result['sources']):
+                latency = source['latency']
+                p50 = f"{latency['p50']:>7.1f}" if not cameras else f"{'-':>7}"
+                p99 = f"{latency['p99']:>7.1f}" if not cameras else f"{'-':>7}"
+                print(f"{mode:<11} {label:<10} {source['fps']:>6.1f} {p50} {p99} {source['jitter_ms']:>7.2f} "
+                      f"{result['dropped']:>7} {result['cpu_percent']:>6.1f}")
+    finally:
+        for camera in cameras:
+            camera.release()
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,103 @@
+"""
+Wakeup latency and jitter of a thread with and without real-time priority.
+
+A measurement thread wakes at a fixed period (the camera frame interval by
+default) the way the capture and frame loop threads wait for their next
+frame, while busy-looping processes keep every CPU core loaded like a game
+would. Each priority mode runs in a fresh thread that applies it through
+ThreadPriority, so the 'level' column shows what was actually granted: a
+mode without the privileges it needs degrades to 'nice' or 'normal' and
+measures the same as 'off'.
+
+For each mode the report gives the delay from the intended wakeup time to
+the moment the thread ran (mean / p99 / max) and the jitter, the standard
+deviation of the interval between wakeups.
+
+Usage:
+    python -m benchmarks.priority_benchmark
+    python -m benchmarks.priority_benchmark --load 8 --seconds 5 --period 0.004
+    sudo python -m benchmarks.priority_benchmark --modes off,fifo
+"""
+
+import argparse
+import multiprocessing
+import os
+import threading
+import time
+
+import numpy as np
+
+from src.utils.performance_report import latency_percentiles
+from src.utils.thread_priority import PRIORITY_MODES, ROLE_CAPTURE, ThreadPriority
+
+
+def busy_loop(stop) -> None:
+    """Burn one CPU core until stop is set."""
+    while not stop.is_set():
+        for _ in range(10000):
+            pass
+
+
+def measure_wakeups(mode: str, period: float, seconds: float) -> dict:
+    """Wake every period on a thread running at the given priority mode."""
+    result = {}
+
+    def run():
+        result['level'] = ThreadPriority(mode).apply(ROLE_CAPTURE)
+        wakeups = []
+        deadline = time.perf_counter()
+        end = deadline + seconds
+        while deadline < end:
+            deadline += period
+            delay = deadline - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+            wakeups.append((deadline, time.perf_counter()))
+        result['wakeups'] = wakeups
+
+    # Each mode gets its own thread, so no priority carries over between modes
+    thread = threading.Thread(target=run, name=f'wakeup-{mode}')
+    thread.start()
+    thread.join()
+
+    deadlines, woke = (np.array(column) for column in zip(*result['wakeups']))
+    late_ms = (woke - deadlines) * 1000.0
+    percentiles = latency_percentiles(late_ms.tolist())
+    return {
+        'level': result['level'],
+        'late_mean_ms': percentiles['mean'],
+        'late_p99_ms': percentiles['p99'],
+        'late_max_ms': float(late_ms.max()),
+        'jitter_ms': float(np.std(np.diff(woke)) * 1000.0),
+    }
+
+
+def main() -> int:
+    """Run the wakeup latency benchmark."""
+    parser = argparse.ArgumentParser(description="Thread wakeup latency and jitter by priority mode")
+    parser.add_argument('--modes', default=','.join(PRIORITY_MODES), help=f"Comma list of {PRIORITY_MODES}")
+    parser.add_argument('--load', type=int, default=os.cpu_count() or 1, help='Busy-looping processes (0 for idle)')
+    parser.add_argument('--period', type=float, default=1 / 30, help='Wakeup period in seconds')
+    parser.add_argument('--seconds', type=float, default=3.0, help='Measurement time per mode')
+    args = parser.parse_args()
+
+    stop = multiprocessing.Event()
+    load = [multiprocessing.Process(target=busy_loop, args=(stop,), daemon=True) for _ in range(args.load)]
+    for process in load:
+        process.start()
+    try:
+        print(f"{os.cpu_count()} CPU cores, {args.load} busy processes, wakeup every {args.period * 1000:.1f} ms")
+        print(f"{'mode':<6} {'level':<9} {'late ms mean / p99 / max':>26} {'jitter ms':>10}")
+        for mode in args.modes.split(','):
+            result = measure_wakeups(mode, args.period, args.seconds)
+            late = f"{result['late_mean_ms']:.3f} / {result['late_p99_ms']:.3f} / {result['late_max_ms']:.3f}"
+            print(f"{mode:<6} {result['level']:<9} {late:>26} {result['jitter_ms']:>10.3f}")
+    finally:
+        stop.set()
+        for process in load:
+            process.join(timeout=1.0)
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
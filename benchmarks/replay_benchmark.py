@@ -0,0 +1,321 @@
+"""
+Replay benchmark for the OpenCV Minecraft Controller.
+
+Runs the detection and decision pipeline over a recorded clip for one
+configuration and reports throughput, latency, per-stage wall and thread CPU
+time, process CPU, memory, context switches, page faults and the per-frame
+elbow angles so different configurations can be compared frame by frame.
+
+Usage:
+    python -m benchmarks.replay_benchmark clip.mp4 --model-complexity 0 --resolution 320x240
+"""
+
+import argparse
+import json
+import queue
+import threading
+import time
+from dataclasses import dataclass
+from typing import Optional, Tuple
+
+import cv2
+import numpy as np
+
+from src.controllers.inference_cache import CachedPoseDetector, InferenceCache, model_cache_key
+from src.controllers.pose_detector import PoseDetector, PoseLandmarks, landmarks_from_array, landmarks_to_array
+from src.controllers.remote_pipeline import RemoteCaptureClient, parse_address
+from src.controllers.replay_source import ReplaySource
+from src.models.enums import ControlState
+from src.models.landmark_codec import codec_report, encode_landmark_sequence
+from src.models.landmark_record import NUM_POSE_LANDMARKS
+from src.utils.angle_calculator import AngleCalculator
+from src.utils.performance_report import (
+    USAGE_COUNTERS, ResourceSampler, StageProfiler, hardware_class, latency_percentiles
+)
+
+
+POSE_BACKENDS = ('mediapipe', 'remote')
+THREADING_MODES = ('sync', 'pipelined')
+STATE_CODES = {None: -1, ControlState.NEUTRAL: 0, ControlState.LEFT_CLICK: 1, ControlState.RIGHT_CLICK: 2}
+
+
+@dataclass(frozen=True)
+class BenchmarkConfig:
+    """One point in the benchmark grid."""
+    backend: str = 'mediapipe'
+    model_complexity: int = 1
+    resolution: Optional[Tuple[int, int]] = None
+    capture_mode: str = 'preload'
+    threading_mode: str = 'sync'
+
+    @property
+    def resolution_label(self) -> str:
+        """Return the inference resolution as WIDTHxHEIGHT or 'native'."""
+        return 'native' if self.resolution is None else f"{self.resolution[0]}x{self.resolution[1]}"
+
+
+def parse_resolution(text: str) -> Optional[Tuple[int, int]]:
+    """Parse WIDTHxHEIGHT (or 'native') into a size tuple."""
+    if text == 'native':
+        return None
+    width, sep, height = text.lower().partition('x')
+    if not sep or not width.isdigit() or not height.isdigit():
+        raise ValueError(f"resolution must be WIDTHxHEIGHT or 'native', got {text!r}")
+    return int(width), int(height)
+
+
+class SyncRemoteDetector(PoseDetector):
+    """Remote backend that waits for each frame's result, for frame-aligned comparison."""
+
+    def __init__(self, address: str, confidence_threshold: float = 0.5, timeout: float = 5.0):
+        """Connect to the server at HOST:PORT; raises RuntimeError if unreachable."""
+        host, port = parse_address(address)
+        self.client = RemoteCaptureClient(host, port, max_in_flight=1)
+        if not self.client.connect():
+            raise RuntimeError(f"Cannot connect to remote inference server {address}")
+        self.confidence_threshold = confidence_threshold
+        self.timeout = timeout
+        self._last_detection_successful = False
+
+    def detect_pose(self, frame: np.ndarray) -> Optional[PoseLandmarks]:
+        """Send a frame and block until its landmarks come back."""
+        result = self.client.wait_for_result(self.client.submit(frame), timeout=self.timeout)
+        self._last_detection_successful = result is not None and result.landmarks is not None
+        if not self._last_detection_successful:
+            return None
+        return landmarks_from_array(result.landmarks)
+
+    def close(self) -> None:
+        """Close the connection to the server."""
+        self.client.close()
+
+
+def create_detector(config: BenchmarkConfig, confidence: float, remote_address: Optional[str]) -> PoseDetector:
+    """Create the pose detector for a benchmark configuration.
+
+    Raises:
+        ValueError: If the backend is unknown or 'remote' is used without an address
+    """
+    if config.backend == 'mediapipe':
+        return PoseDetector(confidence_threshold=confidence, model_complexity=config.model_complexity)
+    if config.backend == 'remote':
+        if not remote_address:
+            raise ValueError("the remote backend requires --remote HOST:PORT")
+        return SyncRemoteDetector(remote_address, confidence_threshold=confidence)
+    raise ValueError(f"backend must be one of {POSE_BACKENDS}")
+
+
+def run_replay_benchmark(
+    video_path: str,
+    config: BenchmarkConfig,
+    max_frames: Optional[int] = None,
+    confidence: float = 0.5,
+    remote_address: Optional[str] = None,
+    detector: Optional[PoseDetector] = None,
+    cache_dir: Optional[str] = None,
+    landmark_log: Optional[str] = None
+) -> dict:
+    """Run one configuration over a clip.
+
+    Args:
+        video_path: Recorded clip to replay
+        config: Benchmark configuration
+        max_frames: Limit on frames processed (default: whole clip)
+        confidence: Pose detection confidence threshold
+        remote_address: HOST:PORT for the remote backend
+        detector: Pre-built detector to use instead of creating one
+        cache_dir: Inference cache directory; cached frames skip inference
+        landmark_log: Write the per-frame landmarks here with the landmark codec
+
+    Returns:
+        dict: Metrics plus 'angles' and 'states' arrays with one entry per frame
+              (NaN angle and state -1 where no arm was detected); with a
+              landmark_log, also the codec compression ratio and angle error
+
+    Raises:
+        RuntimeError: If the clip cannot be opened
+    """
+    if config.threading_mode not in THREADING_MODES:
+        raise ValueError(f"threading_mode must be one of {THREADING_MODES}")
+
+    source = ReplaySource(video_path, capture_mode=config.capture_mode, max_frames=max_frames)
+    if not source.start_capture():
+        raise RuntimeError(f"Cannot open replay clip {video_path}")
+
+    cache = None
+    owns_detector = detector is None
+    if detector is None and cache_dir is not None:
+        cache = InferenceCache(cache_dir, model_cache_key(config.backend, config.model_complexity, confidence))
+        detector = CachedPoseDetector(
+            cache,
+            lambda: create_detector(config, confidence, remote_address),
+            confidence_threshold=confidence
+        )
+    elif detector is None:
+        detector = create_detector(config, confidence, remote_address)
+    angle_calculator = AngleCalculator()
+    profiler = StageProfiler(('resize', 'inference', 'decision'))
+    logged_landmarks = []
+
+    def decide(landmarks: Optional[PoseLandmarks]) -> Tuple[float, int]:
+        if landmarks is None:
+            return float('nan'), STATE_CODES[None]
+        keypoints = detector.get_arm_keypoints(landmarks)
+        if keypoints is None:
+            return float('nan'), STATE_CODES[None]
+        try:
+            angle = angle_calculator.calculate_elbow_angle(keypoints.shoulder, keypoints.elbow, keypoints.wrist)
+        except ValueError:
+            return float('nan'), STATE_CODES[None]
+        return angle, STATE_CODES[angle_calculator.get_control_state(angle)]
+
+    def process(frame: np.ndarray) -> Tuple[float, int]:
+        if config.resolution is not None:
+            stage = profiler.begin()
+            frame = cv2.resize(frame, config.resolution, interpolation=cv2.INTER_AREA)
+            profiler.end('resize', stage)
+        stage = profiler.begin()
+        landmarks = detector.detect_pose(frame)
+        profiler.end('inference', stage)
+        if landmark_log is not None:
+            logged_landmarks.append(None if landmarks is None else landmarks_to_array(landmarks))
+        stage = profiler.begin()
+        result = decide(landmarks)
+        profiler.end('decision', stage)
+        return result
+
+    angles = []
+    states = []
+    latencies_ms = []
+    sampler = ResourceSampler()
+    sampler.start()
+    profiler.reset()
+
+    try:
+        if config.threading_mode == 'sync':
+            while True:
+                start = time.perf_counter()
+                frame = source.get_frame()
+                if frame is None:
+                    break
+                angle, state = process(frame)
+                latencies_ms.append((time.perf_counter() - start) * 1000.0)
+                angles.append(angle)
+                states.append(state)
+                if len(angles) % 30 == 0:
+                    sampler.sample()
+        else:
+            frames: queue.Queue = queue.Queue(maxsize=2)
+
+            def capture_loop():
+                while True:
+                    captured_at = time.perf_counter()
+                    frame = source.get_frame()
+                    frames.put((captured_at, frame))
+                    if frame is None:
+                        break
+
+            capture_thread = threading.Thread(target=capture_loop, name='bench-capture', daemon=True)
+            capture_thread.start()
+            while True:
+                captured_at, frame = frames.get()
+                if frame is None:
+                    break
+                angle, state = process(frame)
+                latencies_ms.append((time.perf_counter() - captured_at) * 1000.0)
+                angles.append(angle)
+                states.append(state)
+                if len(angles) % 30 == 0:
+                    sampler.sample()
+            capture_thread.join()
+    finally:
+        resources = sampler.stop()
+        source.release()
+        if cache is not None:
+            cache_stats = cache.get_stats()
+            cache.close()
+            detector = detector.detector
+        if owns_detector and hasattr(detector, 'close'):
+            detector.close()
+
+    frame_count = len(angles)
+    latency = latency_percentiles(latencies_ms)
+    stage_stats = profiler.get_stats()
+    inference_stats = stage_stats['stages']['inference']
+    decision_stats = stage_stats['stages']['decision']
+    angle_array = np.asarray(angles, dtype=np.float64)
+
+    codec_metrics = {}
+    if landmark_log is not None:
+        present = np.array([landmarks is not None for landmarks in logged_landmarks], dtype=bool)
+        landmark_array = np.zeros((len(logged_landmarks), NUM_POSE_LANDMARKS, 4), dtype=np.float32)
+        for index in np.flatnonzero(present):
+            landmark_array[index] = logged_landmarks[index]
+        with open(landmark_log, 'wb') as log_file:
+            log_file.write(encode_landmark_sequence(landmark_array, present))
+        report = codec_report(landmark_array, present)
+        codec_metrics = {
+            'codec_compression_ratio': report['compression_ratio'],
+            'codec_angle_error_max_deg': report['angle_error_max_deg'],
+        }
+
+    return {
+        'hardware_class': hardware_class(),
+        'backend': config.backend,
+        'model_complexity': config.model_complexity,
+        'resolution': config.resolution_label,
+        'capture_mode': config.capture_mode,
+        'threading_mode': config.threading_mode,
+        'frames': frame_count,
+        'fps': frame_count / resources['wall_s'] if resources['wall_s'] > 0 else 0.0,
+        'latency_p50_ms': latency['p50'],
+        'latency_p99_ms': latency['p99'],
+        'cpu_percent': resources['cpu_percent'],
+        'rss_mb': resources['rss_mb'],
+        'inference_wall_ms': inference_stats['wall_ms_mean'],
+        'inference_cpu_ms': inference_stats['cpu_ms_mean'],
+        'decision_cpu_ms': decision_stats['cpu_ms_mean'],
+        'other_threads_cpu_ms': stage_stats['other_threads_cpu_ms'] / frame_count if frame_count else 0.0,
+        **{counter: resources[counter] for counter in USAGE_COUNTERS if counter in resources},
+        'detection_rate': float(np.mean(~np.isnan(angle_array))) if frame_count else 0.0,
+        'cache_hits': cache_stats['hits'] if cache is not None else 0,
+        'cache_misses': cache_stats['misses'] if cache is not None else 0,
+        'angles': angle_array,
+        'states': np.asarray(states, dtype=np.int8),
+        **codec_metrics,
+    }
+
+
+def main() -> int:
+    """Run a single replay benchmark from the command line."""
+    parser = argparse.ArgumentParser(description="Replay a clip through the pose pipeline")
+    parser.add_argument('video', help='Recorded clip to replay')
+    parser.add_argument('--backend', choices=POSE_BACKENDS, default='mediapipe')
+    parser.add_argument('--model-complexity', type=int, choices=[0, 1, 2], default=1)
+    parser.add_argument('--resolution', default='native', help="WIDTHxHEIGHT or 'native'")
+    parser.add_argument('--capture-mode', choices=ReplaySource.CAPTURE_MODES, default='preload')
+    parser.add_argument('--threading-mode', choices=THREADING_MODES, default='sync')
+    parser.add_argument('--max-frames', type=int, default=None)
+    parser.add_argument('--remote', metavar='HOST:PORT', default=None)
+    parser.add_argument('--cache-dir', default=None, help='Reuse inference results cached in this directory')
+    parser.add_argument('--landmark-log', default=None, help='Write delta-coded landmarks of the run to this file')
+    args = parser.parse_args()
+
+    config = BenchmarkConfig(
+        backend=args.backend,
+        model_complexity=args.model_complexity,
+        resolution=parse_resolution(args.resolution),
+        capture_mode=args.capture_mode,
+        threading_mode=args.threading_mode
+    )
+    result = run_replay_benchmark(args.video, config, max_frames=args.max_frames,
+                                  remote_address=args.remote, cache_dir=args.cache_dir,
+                                  landmark_log=args.landmark_log)
+    result.pop('angles')
+    result.pop('states')
+    print(json.dumps(result, indent=2))
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
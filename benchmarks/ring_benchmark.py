@@ -0,0 +1,182 @@
+"""
+Per-item handoff overhead: SPSCRing against queue.Queue and collections.deque.
+
+Two measurements per payload (a 640x480 BGR frame and a 33x4 landmark array):
+
+- same thread: put then get on one thread, i.e. the bare cost of one handoff
+- cross thread: a producer thread hands items to a consumer thread; reports
+  throughput and the p50/p99 time from put to get
+
+queue.Queue and deque pass references, so a producer reusing its buffer
+must hand over a copy; the '+copy' rows include that allocation and copy.
+SPSCRing.put() copies into its preallocated slots; the 'ring in-place' row
+has the producer write straight into a claimed slot (as cv2 can when reading
+a frame), so it measures the handoff alone and compares with the 'queue' row. The queue and deque are
+lossless (unbounded or blocking); 'ring latest' skips items by design, so
+compare its received count and latency rather than its throughput. The deque
+consumer has no way to wait, so it polls with sleep(0).
+
+Usage:
+    python -m benchmarks.ring_benchmark
+    python -m benchmarks.ring_benchmark --items 20000 --payloads landmarks
+"""
+
+import argparse
+import collections
+import queue
+import threading
+import time
+from typing import Callable, Dict, Tuple
+
+import numpy as np
+
+from src.utils.performance_report import latency_percentiles
+from src.utils.spsc_ring import SPSCRing
+
+
+PAYLOADS = {
+    'frame': ((480, 640, 3), np.uint8),
+    'landmarks': ((33, 4), np.float32),
+}
+META_DTYPE = np.dtype([('put_at', '<f8')])
+
+
+def make_handoffs(shape, dtype) -> Dict[str, Tuple[Callable, Callable]]:
+    """Return name -> (put(item, stamp), get() -> (item, stamp) or None) for each handoff."""
+    handoffs = {}
+
+    def queue_pair(copy: bool):
+        handoff = queue.Queue(maxsize=8)
+
+        def put(item, stamp):
+            handoff.put((item.copy() if copy else item, stamp))
+
+        def get():
+            try:
+                return handoff.get(timeout=0.05)
+            except queue.Empty:
+                return None
+        return put, get
+
+    def deque_pair(copy: bool):
+        handoff = collections.deque()
+
+        def put(item, stamp):
+            handoff.append((item.copy() if copy else item, stamp))
+
+        def get():
+            deadline = time.perf_counter() + 0.05
+            while True:
+                try:
+                    return handoff.popleft()
+                except IndexError:
+                    if time.perf_counter() > deadline:
+                        return None
+                    time.sleep(0)
+        return put, get
+
+    def ring_pair(mode: str):
+        ring = SPSCRing(shape, dtype, capacity=8, mode=mode, meta_dtype=META_DTYPE)
+
+        def put(item, stamp):
+            ring.put(item, meta=(stamp,), timeout=None)
+
+        def get():
+            item = ring.get(timeout=0.05)
+            return None if item is None else (item, float(ring.meta['put_at']))
+        return put, get
+
+    handoffs['queue'] = queue_pair(False)
+    handoffs['queue+copy'] = queue_pair(True)
+    handoffs['deque'] = deque_pair(False)
+    handoffs['deque+copy'] = deque_pair(True)
+    def ring_in_place_pair():
+        ring = SPSCRing(shape, dtype, capacity=8, mode='lossless', meta_dtype=META_DTYPE)
+
+        def put(item, stamp):
+            slot = ring.claim(timeout=None)
+            slot.flat[0] = item.flat[0]
+            ring.commit((stamp,))
+
+        def get():
+            item = ring.get(timeout=0.05)
+            return None if item is None else (item, float(ring.meta['put_at']))
+        return put, get
+
+    handoffs['ring lossless'] = ring_pair('lossless')
+    handoffs['ring latest'] = ring_pair('latest')
+    handoffs['ring in-place'] = ring_in_place_pair()
+    return handoffs
+
+
+def same_thread_ns(put: Callable, get: Callable, item: np.ndarray, items: int) -> float:
+    """Return nanoseconds per put+get pair on one thread."""
+    for _ in range(100):
+        put(item, 0.0)
+        get()
+    start = time.perf_counter_ns()
+    for _ in range(items):
+        put(item, 0.0)
+        get()
+    return (time.perf_counter_ns() - start) / items
+
+
+def cross_thread(put: Callable, get: Callable, item: np.ndarray, items: int) -> dict:
+    """Hand items from a producer thread to this thread and measure throughput and latency."""
+    latencies_ms = []
+    received = 0
+    last_received = start = time.perf_counter()
+
+    def produce():
+        buffer = item.copy()
+        for index in range(items):
+            buffer.flat[0] = index & 0x7F
+            put(buffer, time.perf_counter())
+
+    producer = threading.Thread(target=produce)
+    producer.start()
+    while received < items:
+        result = get()
+        if result is None:
+            # Latest-wins handoffs skip items, so stop once the producer is done
+            if not producer.is_alive():
+                break
+            continue
+        last_received = time.perf_counter()
+        received += 1
+        latencies_ms.append((last_received - result[1]) * 1000.0)
+    producer.join()
+    elapsed = last_received - start
+
+    percentiles = latency_percentiles(latencies_ms)
+    return {
+        'received': received,
+        'items_per_s': received / elapsed if elapsed > 0 else 0.0,
+        'p50_ms': percentiles['p50'],
+        'p99_ms': percentiles['p99'],
+    }
+
+
+def main() -> int:
+    """Run the handoff benchmark."""
+    parser = argparse.ArgumentParser(description="SPSC ring vs queue.Queue and deque")
+    parser.add_argument('--items', type=int, default=5000, help='Items per measurement')
+    parser.add_argument('--payloads', default=','.join(PAYLOADS), help=f"Comma list of {tuple(PAYLOADS)}")
+    args = parser.parse_args()
+
+    print(f"{'payload':<10} {'handoff':<14} {'same-thread ns':>14} {'x-thread items/s':>16} "
+          f"{'p50 ms':>7} {'p99 ms':>7} {'received':>8}")
+    for payload in args.payloads.split(','):
+        shape, dtype = PAYLOADS[payload]
+        item = np.ones(shape, dtype=dtype)
+        for name in make_handoffs(shape, dtype):
+            # Fresh handoffs per measurement so no state carries over
+            same_ns = same_thread_ns(*make_handoffs(shape, dtype)[name], item, args.items)
+            result = cross_thread(*make_handoffs(shape, dtype)[name], item, args.items)
+            print(f"{payload:<10} {name:<14} {same_ns:>14.0f} {result['items_per_s']:>16.0f} "
+                  f"{result['p50_ms']:>7.3f} {result['p99_ms']:>7.3f} {result['received']:>8}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,177 @@
+"""
+Multi-stream scaling benchmark for the pre-fork detector worker pool.
+
+Drives N frame streams, each from its own thread at an optional target frame
+rate, through a DetectorWorkerPool, for every combination of stream count,
+worker count and CPU core limit. Reports aggregate throughput, the worst
+per-stream p99 latency and the memory of each worker (RSS and PSS; PSS
+divides the copy-on-write model pages among the workers that share them).
+
+Streams replay a recorded clip (each stream starting at a different offset)
+or synthetic noise frames. --simulate-ms swaps MediaPipe for a CPU-bound
+stand-in, to check the harness on machines without the model.
+
+Workers build their own detector after the fork. --share-detector builds it
+once in the parent instead, to measure the copy-on-write memory savings; it
+needs a fork-safe detector, so it is only accepted with --simulate-ms
+(MediaPipe's graph threads do not survive the fork).
+
+Usage:
+    python -m benchmarks.scaling_benchmark --streams 1,2,4,8 --workers 1,2,4
+    python -m benchmarks.scaling_benchmark clip.mp4 --streams 4,8 --workers 4 --cores 2,4 --fps 30
+"""
+
+import argparse
+import functools
+import os
+import threading
+import time
+from typing import List, Optional
+
+import cv2
+import numpy as np
+
+from src.controllers.detector_pool import DetectorWorkerPool
+from src.controllers.pose_detector import PoseDetector
+from src.utils.performance_report import latency_percentiles
+
+
+class SimulatedDetector:
+    """CPU-bound stand-in that spins for a fixed time per frame and finds no pose."""
+
+    def __init__(self, busy_ms: float):
+        self.busy_ms = busy_ms
+
+    def detect_pose(self, frame):
+        deadline = time.perf_counter() + self.busy_ms / 1000.0
+        while time.perf_counter() < deadline:
+            pass
+        return None
+
+
+def load_frames(video_path: Optional[str], frame_shape, count: int = 120) -> List[np.ndarray]:
+    """Read up to count frames resized to frame_shape, or create noise frames without a clip."""
+    height, width = frame_shape[:2]
+    frames = []
+    if video_path:
+        capture = cv2.VideoCapture(video_path)
+        while len(frames) < count:
+            ok, frame = capture.read()
+            if not ok:
+                break
+            frames.append(cv2.resize(frame, (width, height)))
+        capture.release()
+    if not frames:
+        rng = np.random.default_rng(0)
+        frames = [rng.integers(0, 256, frame_shape, dtype=np.uint8) for _ in range(min(count, 30))]
+    return frames
+
+
+def run_configuration(
+    detector_factory,
+    frames: List[np.ndarray],
+    streams: int,
+    workers: int,
+    frames_per_stream: int,
+    fps: float,
+    share_detector: bool = False
+) -> dict:
+    """Run one streams x workers configuration and collect its metrics."""
+    latencies = [[] for _ in range(streams)]
+    failures = [0] * streams
+
+    with DetectorWorkerPool(detector_factory, workers=workers, streams=streams,
+                            frame_shape=frames[0].shape, share_detector=share_detector) as pool:
+        def drive(stream_id: int) -> None:
+            interval = 1.0 / fps if fps > 0 else 0.0
+            next_time = time.perf_counter()
+            for index in range(frames_per_stream):
+                frame = frames[(index + stream_id * 7) % len(frames)]
+                result = pool.detect(stream_id, frame)
+                if result is None:
+                    failures[stream_id] += 1
+                else:
+                    latencies[stream_id].append(result['latency_ms'])
+                if interval:
+                    next_time += interval
+                    time.sleep(max(0.0, next_time - time.perf_counter()))
+
+        threads = [threading.Thread(target=drive, args=(stream,)) for stream in range(streams)]
+        start = time.perf_counter()
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        elapsed = time.perf_counter() - start
+        memory = pool.worker_memory()
+        load_ms = pool.load_ms
+        actual_workers = pool.workers
+
+    completed = sum(len(values) for values in latencies)
+    return {
+        'streams': streams,
+        'workers': actual_workers,
+        'throughput_fps': completed / elapsed if elapsed > 0 else 0.0,
+        'worst_stream_p99_ms': max(latency_percentiles(values)['p99'] for values in latencies),
+        'failures': sum(failures),
+        'load_ms': load_ms,
+        'worker_rss_mb': [entry.get('rss_mb', 0.0) for entry in memory],
+        'worker_pss_mb': [entry.get('pss_mb', 0.0) for entry in memory],
+    }
+
+
+def main() -> int:
+    """Run the scaling benchmark."""
+    parser = argparse.ArgumentParser(description="Detector worker pool scaling benchmark")
+    parser.add_argument('video', nargs='?', default=None, help='Recorded clip (default: synthetic frames)')
+    parser.add_argument('--streams', default='1,2,4', help='Comma list of stream counts')
+    parser.add_argument('--workers', default=','.join(str(n) for n in (1, 2, os.cpu_count() or 1)),
+                        help='Comma list of worker counts')
+    parser.add_argument('--cores', default=None,
+                        help='Comma list of CPU core limits applied with sched_setaffinity (Linux)')
+    parser.add_argument('--frames', type=int, default=100, help='Frames per stream')
+    parser.add_argument('--fps', type=float, default=0.0, help='Per-stream frame rate, 0 for as fast as possible')
+    parser.add_argument('--resolution', default='640x480', help='Stream frame size WIDTHxHEIGHT')
+    parser.add_argument('--model-complexity', type=int, default=1, choices=[0, 1, 2])
+    parser.add_argument('--simulate-ms', type=float, default=None,
+                        help='Use a CPU-bound stand-in taking this many ms per frame instead of MediaPipe')
+    parser.add_argument('--share-detector', action='store_true',
+                        help='Build the detector once before forking and share it copy-on-write '
+                             '(requires --simulate-ms)')
+    args = parser.parse_args()
+    if args.share_detector and args.simulate_ms is None:
+        parser.error("--share-detector requires --simulate-ms: MediaPipe's graph threads do not survive fork")
+
+    width, height = (int(value) for value in args.resolution.lower().split('x'))
+    frames = load_frames(args.video, (height, width, 3))
+    if args.simulate_ms is not None:
+        detector_factory = functools.partial(SimulatedDetector, args.simulate_ms)
+    else:
+        detector_factory = functools.partial(PoseDetector, model_complexity=args.model_complexity)
+
+    all_cores = sorted(os.sched_getaffinity(0)) if hasattr(os, 'sched_getaffinity') else []
+    core_limits = [int(value) for value in args.cores.split(',')] if args.cores else [len(all_cores) or None]
+
+    print(f"{'cores':>5} {'streams':>7} {'workers':>7} {'fps total':>9} {'worst p99 ms':>12} "
+          f"{'fail':>4} {'rss MB/worker':>14} {'pss MB/worker':>14}")
+    for cores in core_limits:
+        if cores and all_cores:
+            # Workers inherit the parent's affinity when forked
+            os.sched_setaffinity(0, all_cores[:cores])
+        for streams in (int(value) for value in args.streams.split(',')):
+            for workers in (int(value) for value in args.workers.split(',')):
+                if workers > streams:
+                    continue
+                result = run_configuration(detector_factory, frames, streams, workers, args.frames, args.fps,
+                                           share_detector=args.share_detector)
+                rss = np.mean(result['worker_rss_mb']) if result['worker_rss_mb'] else 0.0
+                pss = np.mean(result['worker_pss_mb']) if result['worker_pss_mb'] else 0.0
+                print(f"{cores or '-':>5} {streams:>7} {result['workers']:>7} {result['throughput_fps']:>9.1f} "
+                      f"{result['worst_stream_p99_ms']:>12.1f} {result['failures']:>4} {rss:>14.1f} {pss:>14.1f}")
+    if all_cores:
+        os.sched_setaffinity(0, all_cores)
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
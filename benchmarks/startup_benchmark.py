@@ -0,0 +1,116 @@
+"""
+Time-to-first-action benchmark: cold launch versus the warm session daemon.
+
+The cold path runs a fresh interpreter that imports the controller, builds the
+pose detector and runs the first inference, which is what every main.py launch
+pays before the camera opens. The warm path asks a running daemon
+('python main.py --daemon') to start a session and reads back the time from the
+command to the first processed frame, then stops the session again.
+
+Usage:
+    python -m benchmarks.startup_benchmark --cold-runs 3
+    python -m benchmarks.startup_benchmark --warm-runs 5 --socket /run/user/1000/minecraft-controller.sock
+"""
+
+import argparse
+import json
+import statistics
+import subprocess
+import sys
+import time
+from typing import List
+
+from controller_client import default_socket_path, send_command
+
+
+COLD_START_SCRIPT = """
+import json, time
+start = time.perf_counter()
+import numpy as np
+from src.controllers.pose_detector import PoseDetector
+imported = time.perf_counter()
+detector = PoseDetector(model_complexity={model_complexity})
+built = time.perf_counter()
+detector.detect_pose(np.zeros((480, 640, 3), dtype=np.uint8))
+done = time.perf_counter()
+print(json.dumps({{'import_ms': (imported - start) * 1000.0, 'build_ms': (built - imported) * 1000.0,
+                   'first_inference_ms': (done - built) * 1000.0}}))
+"""
+
+
+def run_cold_start(model_complexity: int) -> dict:
+    """Launch a fresh interpreter and time imports, detector construction and first inference.
+
+    Returns:
+        dict: import_ms, build_ms, first_inference_ms and total_ms including interpreter start
+    """
+    start = time.perf_counter()
+    output = subprocess.run(
+        [sys.executable, '-c', COLD_START_SCRIPT.format(model_complexity=model_complexity)],
+        check=True, capture_output=True, text=True
+    ).stdout
+    total_ms = (time.perf_counter() - start) * 1000.0
+    result = json.loads(output.strip().splitlines()[-1])
+    result['total_ms'] = total_ms
+    return result
+
+
+def run_warm_start(socket_path: str, camera_id: int) -> dict:
+    """Start and stop one daemon session and return its start timing.
+
+    Raises:
+        RuntimeError: If the daemon rejects the start command
+    """
+    sent_at = time.perf_counter()
+    reply = send_command(socket_path, {'command': 'start', 'options': {'camera_id': camera_id}})
+    round_trip_ms = (time.perf_counter() - sent_at) * 1000.0
+    if not reply.get('ok'):
+        raise RuntimeError(reply.get('error', 'daemon refused to start a session'))
+
+    send_command(socket_path, {'command': 'stop'})
+    # Wait until the session has released the camera before the next run
+    while send_command(socket_path, {'command': 'status'}).get('session_active'):
+        time.sleep(0.05)
+
+    return {
+        'initialize_ms': reply['initialize_ms'],
+        'time_to_first_frame_ms': reply['time_to_first_frame_ms'],
+        'round_trip_ms': round_trip_ms,
+    }
+
+
+def summarize(label: str, values: List[float]) -> str:
+    """Format the median and range of a list of milliseconds."""
+    return f"{label}: median {statistics.median(values):.0f} ms (min {min(values):.0f}, max {max(values):.0f})"
+
+
+def main() -> int:
+    """Run the startup benchmark."""
+    parser = argparse.ArgumentParser(description="Cold launch versus warm daemon time to first frame")
+    parser.add_argument('--cold-runs', type=int, default=3, help='Fresh interpreter launches to time')
+    parser.add_argument('--warm-runs', type=int, default=0, help='Daemon session starts to time (needs a running daemon)')
+    parser.add_argument('--model-complexity', type=int, default=1, choices=[0, 1, 2])
+    parser.add_argument('--camera-id', type=int, default=0)
+    parser.add_argument('--socket', default=default_socket_path(), help='Daemon socket path')
+    args = parser.parse_args()
+
+    if args.cold_runs > 0:
+        cold = [run_cold_start(args.model_complexity) for _ in range(args.cold_runs)]
+        print(f"Cold start ({args.cold_runs} runs, camera not included):")
+        for key in ('import_ms', 'build_ms', 'first_inference_ms', 'total_ms'):
+            print("  " + summarize(key, [run[key] for run in cold]))
+
+    if args.warm_runs > 0:
+        try:
+            warm = [run_warm_start(args.socket, args.camera_id) for _ in range(args.warm_runs)]
+        except (OSError, ValueError, RuntimeError) as e:
+            print(f"Warm start failed: {e}", file=sys.stderr)
+            return 1
+        print(f"Warm daemon start ({args.warm_runs} runs, camera included):")
+        for key in ('initialize_ms', 'time_to_first_frame_ms', 'round_trip_ms'):
+            print("  " + summarize(key, [run[key] for run in warm]))
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
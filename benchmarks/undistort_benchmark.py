@@ -0,0 +1,97 @@
+"""
+Lens correction benchmark: full-frame remap versus keypoint undistortion.
+
+Times, per frame, cv2.undistort (maps rebuilt every call, the naive baseline),
+cv2.remap with maps precomputed by FrameUndistorter, and cv2.undistortPoints on
+the three arm keypoints through KeypointUndistorter. It also reports the elbow
+angle error the lens causes for a straight arm near the frame edge and what
+remains after keypoint correction. Uses a calibration file or a synthetic
+wide-angle lens.
+
+Usage:
+    python -m benchmarks.undistort_benchmark
+    python -m benchmarks.undistort_benchmark --calibration calibration.json --sizes 640x480,1280x720
+"""
+
+import argparse
+import time
+
+import cv2
+import numpy as np
+
+from src.models.data_models import ArmKeypoints, Point
+from src.utils.angle_calculator import AngleCalculator
+from src.utils.lens_correction import CameraCalibration, FrameUndistorter, KeypointUndistorter, load_calibration
+from .replay_benchmark import parse_resolution
+
+
+def synthetic_calibration() -> CameraCalibration:
+    """Return a 640x480 wide-angle calibration with strong barrel distortion."""
+    camera_matrix = np.array([[400.0, 0.0, 320.0], [0.0, 400.0, 240.0], [0.0, 0.0, 1.0]])
+    return CameraCalibration(camera_matrix, np.array([[-0.3, 0.1, 0.0, 0.0, 0.0]]), (640, 480))
+
+
+def time_per_call_us(function, repeat: int) -> float:
+    """Return the median microseconds per call of function()."""
+    samples = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        function()
+        samples.append((time.perf_counter() - start) * 1e6)
+    return float(np.median(samples))
+
+
+def edge_arm_error(calibration: CameraCalibration, size) -> tuple:
+    """Distort a straight arm near the frame edge and measure the angle before and after correction.
+
+    Returns:
+        (raw angle error, corrected angle error) in degrees from 180
+    """
+    calibration = calibration.scaled_to(size)
+    scale = np.array(size, dtype=np.float64)
+    ideal = np.array([[0.70, 0.15], [0.80, 0.45], [0.90, 0.75]]) * scale
+    camera_matrix = calibration.camera_matrix
+    rays = np.column_stack([(ideal[:, 0] - camera_matrix[0, 2]) / camera_matrix[0, 0],
+                            (ideal[:, 1] - camera_matrix[1, 2]) / camera_matrix[1, 1], np.ones(3)])
+    projected, _ = cv2.projectPoints(rays, np.zeros(3), np.zeros(3), camera_matrix, calibration.dist_coeffs)
+    distorted = projected.reshape(3, 2) / scale
+    arm = ArmKeypoints.trusted(*(Point.trusted(float(x), float(y)) for x, y in distorted), 1.0)
+
+    raw = AngleCalculator.calculate_elbow_angle(arm.shoulder, arm.elbow, arm.wrist)
+    fixed = KeypointUndistorter(calibration, size).undistort_arm(arm)
+    corrected = AngleCalculator.calculate_elbow_angle(fixed.shoulder, fixed.elbow, fixed.wrist)
+    return 180.0 - raw, 180.0 - corrected
+
+
+def main() -> int:
+    """Run the lens correction benchmark."""
+    parser = argparse.ArgumentParser(description="Full-frame remap versus keypoint undistortion")
+    parser.add_argument('--calibration', default=None, help='Calibration JSON (default: synthetic wide-angle lens)')
+    parser.add_argument('--sizes', default='640x480,1280x720', help='Comma list of WIDTHxHEIGHT frame sizes')
+    parser.add_argument('--repeat', type=int, default=200)
+    args = parser.parse_args()
+
+    calibration = load_calibration(args.calibration) if args.calibration else synthetic_calibration()
+    rng = np.random.default_rng(0)
+    arm = ArmKeypoints.trusted(Point.trusted(0.7, 0.2), Point.trusted(0.8, 0.45), Point.trusted(0.9, 0.7), 1.0)
+
+    print(f"{'size':<10} {'undistort us':>13} {'remap us':>9} {'keypoints us':>13} {'edge error deg':>15} {'corrected deg':>14}")
+    for size in (parse_resolution(value) for value in args.sizes.split(',')):
+        frame = rng.integers(0, 256, (size[1], size[0], 3), dtype=np.uint8)
+        scaled = calibration.scaled_to(size)
+        frame_undistorter = FrameUndistorter(calibration, size)
+        keypoint_undistorter = KeypointUndistorter(calibration, size)
+
+        naive_us = time_per_call_us(
+            lambda: cv2.undistort(frame, scaled.camera_matrix, scaled.dist_coeffs), max(10, args.repeat // 10))
+        remap_us = time_per_call_us(lambda: frame_undistorter.undistort(frame), args.repeat)
+        keypoint_us = time_per_call_us(lambda: keypoint_undistorter.undistort_arm(arm), args.repeat * 10)
+        raw_error, corrected_error = edge_arm_error(calibration, size)
+
+        print(f"{size[0]}x{size[1]:<6} {naive_us:>13.0f} {remap_us:>9.0f} {keypoint_us:>13.1f} "
+              f"{raw_error:>15.2f} {corrected_error:>14.3f}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,93 @@
+"""
+Checkerboard calibration tool for the OpenCV Minecraft Controller.
+
+Shows the camera with detected checkerboard corners. Press SPACE to keep the
+current view (the board must be found), C to calibrate once enough views are
+kept, and Q or ESC to quit. Hold the board at different positions, angles and
+distances, including the frame edges, where lens distortion is strongest. The
+result is written as JSON for 'python main.py --calibration PATH'.
+
+Usage:
+    python calibrate_camera.py --output calibration.json
+    python calibrate_camera.py --pattern 9x6 --square-size 25 --camera-id 1
+"""
+
+import argparse
+import logging
+import sys
+
+import cv2
+
+from src.controllers.camera_manager import CameraManager
+from src.utils.lens_correction import (
+    MIN_CALIBRATION_VIEWS, calibrate_camera, find_checkerboard_corners, save_calibration
+)
+
+
+def parse_pattern(value: str):
+    """Parse an inner corner pattern such as '9x6'."""
+    try:
+        columns, rows = (int(part) for part in value.lower().split('x'))
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"pattern must be COLUMNSxROWS, got '{value}'") from None
+    if columns < 2 or rows < 2:
+        raise argparse.ArgumentTypeError("pattern needs at least 2x2 inner corners")
+    return columns, rows
+
+
+def main() -> int:
+    """Run the interactive calibration."""
+    parser = argparse.ArgumentParser(description="Calibrate the camera with a printed checkerboard")
+    parser.add_argument('--output', default='calibration.json', help='Calibration JSON to write')
+    parser.add_argument('--pattern', type=parse_pattern, default=(9, 6), help='Inner corners, e.g. 9x6')
+    parser.add_argument('--square-size', type=float, default=1.0, help='Square size (any unit)')
+    parser.add_argument('--camera-id', type=int, default=0)
+    parser.add_argument('--min-views', type=int, default=15, help='Views to collect before calibrating')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format='%(message)s')
+    min_views = max(args.min_views, MIN_CALIBRATION_VIEWS)
+
+    camera = CameraManager(camera_id=args.camera_id)
+    if not camera.start_capture():
+        print(f"Cannot open camera {args.camera_id}", file=sys.stderr)
+        return 1
+
+    corner_sets = []
+    image_size = None
+    try:
+        while True:
+            frame = camera.get_frame()
+            if frame is None:
+                continue
+            image_size = (frame.shape[1], frame.shape[0])
+            corners = find_checkerboard_corners(frame, args.pattern)
+
+            preview = frame.copy()
+            if corners is not None:
+                cv2.drawChessboardCorners(preview, args.pattern, corners, True)
+            cv2.putText(preview, f"views: {len(corner_sets)}/{min_views}  SPACE keep  C calibrate  Q quit",
+                        (10, 25), cv2.FONT_HERSHEY_SIMPLEX, 0.6, (0, 255, 0), 2)
+            cv2.imshow('Camera calibration', preview)
+
+            key = cv2.waitKey(1) & 0xFF
+            if key in (ord('q'), 27):
+                print("Calibration cancelled")
+                return 1
+            if key == ord(' ') and corners is not None:
+                corner_sets.append(corners)
+            if key == ord('c') and len(corner_sets) >= min_views:
+                break
+    finally:
+        camera.release()
+        cv2.destroyAllWindows()
+
+    calibration = calibrate_camera(corner_sets, args.pattern, image_size, args.square_size)
+    save_calibration(args.output, calibration)
+    print(f"Wrote {args.output}: RMS reprojection error {calibration.rms_error:.3f} px "
+          f"from {len(corner_sets)} views at {image_size[0]}x{image_size[1]}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,89 @@
+"""
+Thin command line client for the OpenCV Minecraft Controller session daemon.
+
+Talks to a daemon started with 'python main.py --daemon' over its Unix socket.
+It imports only the standard library, so a command returns in milliseconds.
+
+Usage:
+    python controller_client.py start [--camera-id 1]
+    python controller_client.py toggle | reset | stop | status | shutdown
+    python controller_client.py configure settings.json
+"""
+
+import argparse
+import json
+import os
+import socket
+import sys
+import tempfile
+import time
+
+
+def default_socket_path() -> str:
+    """Return the per-user default daemon socket path (matches session_daemon)."""
+    directory = os.environ.get('XDG_RUNTIME_DIR') or tempfile.gettempdir()
+    return os.path.join(directory, 'minecraft-controller.sock')
+
+
+def send_command(socket_path: str, request: dict, timeout: float = 15.0) -> dict:
+    """Send one request to the daemon and return its reply.
+
+    Raises:
+        OSError: If the daemon is not reachable
+        ValueError: If the reply is not valid JSON
+    """
+    with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as connection:
+        connection.settimeout(timeout)
+        connection.connect(socket_path)
+        connection.sendall(json.dumps(request).encode('utf-8') + b'\n')
+        data = b''
+        while not data.endswith(b'\n'):
+            chunk = connection.recv(65536)
+            if not chunk:
+                break
+            data += chunk
+    return json.loads(data.decode('utf-8'))
+
+
+def main() -> int:
+    """Run one client command."""
+    parser = argparse.ArgumentParser(description="Control the OpenCV Minecraft Controller daemon")
+    parser.add_argument('command', choices=['start', 'stop', 'toggle', 'reset', 'configure', 'status', 'shutdown'])
+    parser.add_argument('config_file', nargs='?', help='JSON configuration for the configure command')
+    parser.add_argument('--camera-id', type=int, default=None, help='Camera for the start command')
+    parser.add_argument('--socket', default=default_socket_path(), help='Daemon socket path')
+    args = parser.parse_args()
+
+    request = {'command': args.command}
+    if args.command == 'start' and args.camera_id is not None:
+        request['options'] = {'camera_id': args.camera_id}
+    if args.command == 'configure':
+        if not args.config_file:
+            parser.error("configure requires a JSON configuration file")
+        with open(args.config_file, 'r', encoding='utf-8') as config_file:
+            request['config'] = json.load(config_file)
+
+    sent_at = time.perf_counter()
+    try:
+        reply = send_command(args.socket, request)
+    except (OSError, ValueError) as e:
+        print(f"Cannot reach daemon at {args.socket}: {e}", file=sys.stderr)
+        return 1
+    round_trip_ms = (time.perf_counter() - sent_at) * 1000.0
+
+    if not reply.get('ok'):
+        print(f"Error: {reply.get('error', 'unknown error')}", file=sys.stderr)
+        return 1
+
+    if args.command == 'start':
+        print(f"Session started: first frame {reply['time_to_first_frame_ms']:.0f} ms after the command "
+              f"(camera and session setup {reply['initialize_ms']:.0f} ms, round trip {round_trip_ms:.0f} ms)")
+    elif args.command == 'status':
+        print(json.dumps(reply, indent=2))
+    else:
+        print(f"{args.command}: ok")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -0,0 +1,61 @@
+"""
+Offline labeling tool for the OpenCV Minecraft Controller.
+
+Labels every frame of a recorded video with pose landmarks, the elbow angle
+and the control state, using one worker process per CPU core by default. The
+result is a landmark record file (see src/models/landmark_record.py) that
+open_record_file() maps with one column per field.
+
+Usage:
+    python label_video.py session.mp4 --output session.klmr
+    python label_video.py session.mp4 --workers 4 --chunks 16 --warmup 60 --model-complexity 0
+"""
+
+import argparse
+import functools
+import logging
+import sys
+
+from src.controllers.offline_labeler import OfflineLabeler
+from src.controllers.pose_detector import PoseDetector
+
+
+def main() -> int:
+    """Label a video file."""
+    parser = argparse.ArgumentParser(description="Label recorded video with landmarks, angles and control states")
+    parser.add_argument('video', help='Video file to label')
+    parser.add_argument('--output', help='Landmark record file to write (default: VIDEO.klmr)')
+    parser.add_argument('--workers', type=int, default=0, help='Worker processes, 0 for one per CPU core')
+    parser.add_argument('--chunks', type=int, help='Chunks to split the video into (default: one per worker)')
+    parser.add_argument('--warmup', type=int, default=30, help='Frames tracked before each chunk and discarded')
+    parser.add_argument('--confidence', type=float, default=0.5, help='Landmark visibility threshold')
+    parser.add_argument('--model-complexity', type=int, choices=[0, 1, 2], default=1)
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format='%(message)s')
+    try:
+        labeler = OfflineLabeler(
+            args.video,
+            args.output or f"{args.video}.klmr",
+            workers=args.workers,
+            chunks=args.chunks,
+            warmup_frames=args.warmup,
+            detector_factory=functools.partial(
+                PoseDetector, confidence_threshold=args.confidence, model_complexity=args.model_complexity
+            )
+        )
+    except ValueError as e:
+        print(f"Invalid arguments: {e}", file=sys.stderr)
+        return 2
+
+    result = labeler.run()
+    if result is None:
+        return 1
+    print(f"Labeled {result['frames']} frames ({result['poses']} with a pose) in {result['chunks']} chunks "
+          f"on {result['workers']} workers: {result['seconds']:.1f} s, {result['fps']:.1f} fps")
+    print(f"Wrote {labeler.output_path}")
+    return 0
+
+
+if __name__ == '__main__':
+    raise SystemExit(main())
@@ -9,9 +9,18 @@ specific arm positions into mouse controls.
 import sys
 import logging
 import argparse
+import functools
 from typing import Optional
 
 from src.controllers.application_controller import ApplicationController
+from src.controllers.camera_manager import CAPTURE_BACKENDS
+from src.controllers.landmark_publisher import DEFAULT_MULTICAST_GROUP, DEFAULT_PORT
+from src.controllers.pose_detector import PoseDetector
+from src.controllers.remote_pipeline import RemoteInferenceServer, parse_address
+from src.controllers.session_daemon import SessionDaemon
+from src.utils.lens_correction import UNDISTORT_MODES
+from src.utils.performance_report import DEFAULT_SUMMARY_PATH, hardware_class, load_summary
+from src.utils.thread_priority import PRIORITY_MODES, ThreadPriority, configure_thread_priority
 
 
 def setup_logging(debug: bool = False) -> None:
@@ -59,6 +68,99 @@ def parse_arguments() -> argparse.Namespace:
         default=1,
         help='MediaPipe model complexity: 0=Lite (fastest), 1=Full (balanced), 2=Heavy (most accurate)'
     )
+    parser.add_argument(
+        '--capture-backend',
+        choices=list(CAPTURE_BACKENDS),
+        default='auto',
+        help='OpenCV capture backend (default: auto); gstreamer uses a low-latency v4l2src pipeline'
+    )
+    parser.add_argument(
+        '--capture-source',
+        metavar='SOURCE',
+        default=None,
+        help='Video file or GStreamer pipeline to capture from instead of --camera-id'
+    )
+    parser.add_argument(
+        '--calibration',
+        metavar='PATH',
+        default=None,
+        help='Camera calibration JSON from calibrate_camera.py; enables lens correction'
+    )
+    parser.add_argument(
+        '--undistort',
+        choices=list(UNDISTORT_MODES),
+        default='keypoints',
+        help='Lens correction: rectify whole frames or only the arm keypoints (default: keypoints)'
+    )
+    parser.add_argument(
+        '--adaptive-inference',
+        action='store_true',
+        help='Skip pose inference while the elbow angle is far from every threshold and steady'
+    )
+    parser.add_argument(
+        '--realtime',
+        choices=list(PRIORITY_MODES),
+        default='off',
+        help='Raise capture and decision threads: nice value or SCHED_FIFO/SCHED_RR; '
+             'needs privileges, otherwise falls back to normal priority (default: off)'
+    )
+    parser.add_argument(
+        '--remote-inference',
+        metavar='HOST:PORT',
+        default=None,
+        help='Stream frames to a remote inference server instead of running the model locally'
+    )
+    parser.add_argument(
+        '--remote-server',
+        metavar='HOST:PORT',
+        default=None,
+        help='Run as a remote inference server listening on HOST:PORT (no camera or mouse)'
+    )
+    parser.add_argument(
+        '--remote-reply',
+        choices=['landmarks', 'compact', 'state'],
+        default='landmarks',
+        help='Remote server reply: full landmarks, delta-coded landmarks or control state only, '
+             'decided with the server\'s default thresholds (default: landmarks)'
+    )
+    parser.add_argument(
+        '--config',
+        metavar='PATH',
+        default=None,
+        help='JSON configuration file; edits are applied live without restarting'
+    )
+    parser.add_argument(
+        '--flight-recorder',
+        metavar='SECONDS',
+        type=float,
+        default=0.0,
+        help='Keep the last SECONDS of frames and decisions, dumped on anomaly or F key (default: off)'
+    )
+    parser.add_argument(
+        '--flight-record-dir',
+        default='flight_records',
+        help='Directory for flight recorder dumps (default: flight_records)'
+    )
+    parser.add_argument(
+        '--publish',
+        metavar='DEST',
+        nargs='?',
+        const=f'udp://{DEFAULT_MULTICAST_GROUP}:{DEFAULT_PORT}',
+        default=None,
+        help='Publish a landmark record per frame to udp://HOST:PORT or unix://PATH '
+             f'(default when given without DEST: udp://{DEFAULT_MULTICAST_GROUP}:{DEFAULT_PORT}, loopback multicast)'
+    )
+    parser.add_argument(
+        '--daemon',
+        action='store_true',
+        help='Keep the detector loaded and run sessions on request from controller_client.py'
+    )
+    parser.add_argument(
+        '--socket',
+        metavar='PATH',
+        default=None,
+        help='Unix socket for --daemon (default: $XDG_RUNTIME_DIR or temp dir)'
+    )
     parser.add_argument(
         '--debug', 
         action='store_true',
@@ -68,29 +170,135 @@ def parse_arguments() -> argparse.Namespace:
     return parser.parse_args()
 
 
-def print_usage_instructions() -> None:
-    """Print usage instructions for the user."""
+def print_usage_instructions(summary_path: str = DEFAULT_SUMMARY_PATH) -> None:
+    """Print usage instructions for the user.
+    
+    Args:
+        summary_path: Benchmark matrix summary used for measured FPS figures
+    """
+    summary = load_summary(summary_path) or {}
+    measured = summary.get(hardware_class(), {})
+    fps_by_complexity = measured.get('fps_by_model_complexity', {})
+    
+    def fps_text(complexity: int) -> str:
+        fps = fps_by_complexity.get(str(complexity))
+        return f"{fps:.0f} FPS measured" if fps else "not benchmarked"
+    
     print("\n" + "="*60)
     print("OpenCV Minecraft Controller - Usage Instructions")
     print("="*60)
     print("Controls:")
     print("  SPACE    - Toggle pose control on/off")
     print("  R        - Reset system and re-enable pose control")
+    print("  F        - Dump the flight recorder (with --flight-recorder)")
     print("  ESC/Q    - Exit application")
     print("\nArm Position Controls:")
     print("  Elbow angle < 60°   - Right mouse button")
     print("  Elbow angle > 90°   - Left mouse button")
     print("  Elbow angle 60-90°  - Neutral (no clicks)")
     print("\nModel Complexity Options:")
-    print("  --model-complexity 0  - Lite (fastest, ~60+ FPS)")
-    print("  --model-complexity 1  - Full (balanced, ~30+ FPS) [DEFAULT]")
-    print("  --model-complexity 2  - Heavy (most accurate, ~15+ FPS)")
+    print(f"  --model-complexity 0  - Lite (fastest, {fps_text(0)})")
+    print(f"  --model-complexity 1  - Full (balanced, {fps_text(1)}) [DEFAULT]")
+    print(f"  --model-complexity 2  - Heavy (most accurate, {fps_text(2)})")
+    recommended = measured.get('recommended')
+    if recommended:
+        print(f"  Recommended here: model {recommended['model_complexity']} at "
+              f"{recommended['resolution']} ({recommended['fps']:.0f} FPS)")
+    elif not fps_by_complexity:
+        print("  Run 'python -m benchmarks.benchmark_matrix <clip>' to measure this machine")
     print("\nMake sure you're positioned clearly in front of the camera.")
     print("The system will display your pose overlay and current angle.")
     print("FPS will be logged every 30 frames to monitor performance.")
     print("="*60 + "\n")
 
 
+def run_remote_server(args: argparse.Namespace) -> int:
+    """Run the remote inference server until interrupted.
+    
+    Args:
+        args: Parsed command line arguments
+        
+    Returns:
+        int: Exit code (0 for success, non-zero for error)
+    """
+    logger = logging.getLogger(__name__)
+    
+    try:
+        host, port = parse_address(args.remote_server)
+    except ValueError as e:
+        logger.error(str(e))
+        return 1
+    
+    server = RemoteInferenceServer(
+        host=host,
+        port=port,
+        detector_factory=lambda: PoseDetector(
+            confidence_threshold=args.confidence,
+            model_complexity=args.model_complexity
+        ),
+        reply_mode=args.remote_reply
+    )
+    
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        logger.info("Remote server interrupted by user")
+    except Exception as e:
+        logger.error(f"Remote server error: {e}")
+        return 1
+    
+    return 0
+
+
+def run_daemon(args: argparse.Namespace) -> int:
+    """Run the warm session daemon until a shutdown command or interrupt.
+    
+    Args:
+        args: Parsed command line arguments
+        
+    Returns:
+        int: Exit code (0 for success, non-zero for error)
+    """
+    logger = logging.getLogger(__name__)
+    
+    daemon = SessionDaemon(
+        socket_path=args.socket,
+        detector_factory=lambda: PoseDetector(
+            confidence_threshold=args.confidence,
+            model_complexity=args.model_complexity
+        ),
+        session_factory=functools.partial(
+            ApplicationController,
+            camera_id=args.camera_id,
+            confidence_threshold=args.confidence,
+            model_complexity=args.model_complexity,
+            config_path=args.config,
+            flight_recorder_seconds=args.flight_recorder,
+            flight_record_dir=args.flight_record_dir,
+            publish_destination=args.publish,
+            capture_backend=args.capture_backend,
+            capture_source=args.capture_source,
+            calibration_path=args.calibration,
+            undistort_mode=args.undistort,
+            adaptive_inference=args.adaptive_inference
+        )
+    )
+    
+    try:
+        daemon.start()
+        daemon.serve_forever()
+    except KeyboardInterrupt:
+        logger.info("Session daemon interrupted by user")
+    except (OSError, AttributeError) as e:
+        # AttributeError: socket.AF_UNIX is unavailable on this platform
+        logger.error(f"Session daemon error: {e}")
+        return 1
+    finally:
+        daemon.stop()
+    
+    return 0
+
+
 def main() -> int:
     """
     Main application entry point.
@@ -110,6 +318,18 @@ def main() -> int:
         logger.error("Confidence threshold must be between 0.0 and 1.0")
         return 1
     
+    # Threads raise their own priority as they start, so configure before any start
+    if args.realtime != 'off':
+        configure_thread_priority(ThreadPriority(args.realtime))
+    
+    # Remote server mode runs inference only and never touches camera or mouse
+    if args.remote_server:
+        return run_remote_server(args)
+    
+    # Daemon mode keeps the detector warm and waits for client commands
+    if args.daemon:
+        return run_daemon(args)
+    
     # Print usage instructions
     print_usage_instructions()
     
@@ -124,7 +344,17 @@ def main() -> int:
         app_controller = ApplicationController(
             camera_id=args.camera_id,
             confidence_threshold=args.confidence,
-            model_complexity=args.model_complexity
+            model_complexity=args.model_complexity,
+            remote_address=args.remote_inference,
+            config_path=args.config,
+            flight_recorder_seconds=args.flight_recorder,
+            flight_record_dir=args.flight_record_dir,
+            publish_destination=args.publish,
+            capture_backend=args.capture_backend,
+            capture_source=args.capture_source,
+            calibration_path=args.calibration,
+            undistort_mode=args.undistort,
+            adaptive_inference=args.adaptive_inference
         )
         
         if not app_controller.initialize():
@@ -1,17 +1,38 @@
 """Controllers package for managing system components."""
 
 from .camera_manager import CameraManager
+from .capture_multiplexer import CaptureMultiplexer, SourceFrame
 from .pose_detector import PoseDetector, PoseLandmarks
 from .mouse_controller import MouseController, MouseControlError
 from .display_manager import DisplayManager
+from .replay_source import ReplaySource
+from .detector_pool import DetectorWorkerPool
+from .inference_cache import CachedPoseDetector, InferenceCache
+from .landmark_publisher import LandmarkPublisher, LandmarkSubscriber
+from .remote_pipeline import RemoteCaptureClient, RemoteInferenceServer, RemotePoseDetector
 from .application_controller import ApplicationController
+from .offline_labeler import OfflineLabeler
+from .session_daemon import SessionDaemon
 
 __all__ = [
     'CameraManager', 
+    'CaptureMultiplexer',
+    'SourceFrame',
     'PoseDetector', 
     'PoseLandmarks', 
     'MouseController', 
     'MouseControlError', 
     'DisplayManager',
-    'ApplicationController'
+    'ReplaySource',
+    'DetectorWorkerPool',
+    'InferenceCache',
+    'CachedPoseDetector',
+    'LandmarkPublisher',
+    'LandmarkSubscriber',
+    'RemoteCaptureClient',
+    'RemoteInferenceServer',
+    'RemotePoseDetector',
+    'ApplicationController',
+    'OfflineLabeler',
+    'SessionDaemon'
 ]
\ No newline at end of file
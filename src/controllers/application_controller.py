@@ -7,14 +7,28 @@ mouse control, and visual feedback.
 """
 
 import logging
+import queue
+import threading
 import time
 from typing import Optional
 
 from .camera_manager import CameraManager
-from .pose_detector import PoseDetector
+from .pose_detector import PoseDetector, landmarks_to_array
 from .mouse_controller import MouseController, MouseControlError
 from .display_manager import DisplayManager
+from .landmark_publisher import LandmarkPublisher
+from .remote_pipeline import RemoteCaptureClient, RemotePoseDetector, parse_address
 from ..utils.angle_calculator import AngleCalculator
+from ..utils.clock import SystemClock
+from ..utils.config_manager import ConfigWatcher, ControllerConfig
+from ..utils.flight_recorder import FLIGHT_STAGES, FlightRecorder
+from ..utils.frame_bus import FrameBus
+from ..utils.inference_scheduler import InferenceScheduler
+from ..utils.lens_correction import (
+    UNDISTORT_MODES, CameraCalibration, FrameUndistorter, KeypointUndistorter, load_calibration
+)
+from ..utils.performance_report import StageProfiler, resource_usage
+from ..utils.thread_priority import ROLE_DECISION, apply_thread_role, get_thread_priority
 from ..models.data_models import SystemState
 from ..models.enums import ControlState
 
@@ -29,20 +43,69 @@ class ApplicationController:
     to mouse control, with visual feedback and error handling.
     """
     
-    def __init__(self, camera_id: int = 0, confidence_threshold: float = 0.5, model_complexity: int = 1):
+    ACTIONS = ('stop', 'toggle', 'reset', 'dump')
+    KEY_ACTIONS = {'esc': 'stop', 'q': 'stop', 'space': 'toggle', 'r': 'reset', 'f': 'dump'}
+    
+    def __init__(self, camera_id: int = 0, confidence_threshold: float = 0.5, model_complexity: int = 1,
+                 remote_address: Optional[str] = None, config_path: Optional[str] = None,
+                 flight_recorder_seconds: float = 0.0, flight_record_dir: str = 'flight_records',
+                 pose_detector: Optional[PoseDetector] = None, config: Optional[ControllerConfig] = None,
+                 publish_destination: Optional[str] = None, capture_backend: str = 'auto',
+                 capture_source: Optional[str] = None, calibration_path: Optional[str] = None,
+                 undistort_mode: str = 'keypoints', clock=None, adaptive_inference: bool = False):
         """Initialize the application controller.
         
         Args:
             camera_id: Camera device ID for video capture
             confidence_threshold: Minimum confidence for pose detection
             model_complexity: MediaPipe model complexity (0=Lite, 1=Full, 2=Heavy)
+            remote_address: HOST:PORT of a remote inference server, None for local inference
+            config_path: JSON configuration file watched for runtime changes, None for defaults
+            flight_recorder_seconds: Seconds of history kept for anomaly dumps, 0 to disable
+            flight_record_dir: Directory receiving flight recorder dumps
+            pose_detector: Already loaded detector to use instead of creating one
+            config: Initial runtime configuration when no config_path is given
+            publish_destination: 'udp://HOST:PORT' or 'unix://PATH' receiving a landmark
+                record per frame, None to disable publishing
+            capture_backend: OpenCV capture backend name (see CameraManager)
+            capture_source: Video file or GStreamer pipeline used instead of camera_id
+            calibration_path: Camera calibration JSON from calibrate_camera.py, None for no
+                lens correction
+            undistort_mode: 'frame' to rectify whole frames, 'keypoints' to correct only
+                the arm keypoints before the angle is computed
+            clock: Time source for FPS tracking, frozen-camera detection, config polling
+                and flight recorder limits (SystemClock or VirtualClock); default real time
+            adaptive_inference: Skip pose inference on frames where the control state
+                cannot plausibly change (see InferenceScheduler)
+            
+        Raises:
+            ValueError: If undistort_mode is unknown
         """
+        if undistort_mode not in UNDISTORT_MODES:
+            raise ValueError(f"undistort_mode must be one of {UNDISTORT_MODES}")
+        
         self.camera_id = camera_id
         self.confidence_threshold = confidence_threshold
         self.model_complexity = model_complexity
+        self.remote_address = remote_address
+        self.config_path = config_path
+        self.config = config or ControllerConfig()
+        self.config_watcher: Optional[ConfigWatcher] = None
+        self.flight_recorder_seconds = flight_recorder_seconds
+        self.flight_record_dir = flight_record_dir
+        self.publish_destination = publish_destination
+        self.capture_backend = capture_backend
+        self.capture_source = capture_source
+        self.calibration_path = calibration_path
+        self.undistort_mode = undistort_mode
+        self.clock = clock or SystemClock()
+        self.adaptive_inference = adaptive_inference
         
-        # Initialize system state
+        # Immutable state snapshot, replaced only by the frame loop thread
+        # (see _publish_state); the elbow angle changes every frame, so it is
+        # a separate per-frame value rather than a snapshot field
         self.system_state = SystemState()
+        self.last_valid_angle: Optional[float] = None
         
         # Component instances (initialized in initialize())
         self.camera_manager: Optional[CameraManager] = None
@@ -50,11 +113,42 @@ class ApplicationController:
         self.mouse_controller: Optional[MouseController] = None
         self.display_manager: Optional[DisplayManager] = None
         self.angle_calculator: Optional[AngleCalculator] = None
+        self.remote_client: Optional[RemoteCaptureClient] = None
+        self.flight_recorder: Optional[FlightRecorder] = None
+        self.publisher: Optional[LandmarkPublisher] = None
+        self.calibration: Optional[CameraCalibration] = None
+        self._frame_undistorter: Optional[FrameUndistorter] = None
+        self._keypoint_undistorter: Optional[KeypointUndistorter] = None
+        self.inference_scheduler: Optional[InferenceScheduler] = None
+        self._provided_pose_detector = pose_detector
+        
+        # Captured frames are shared with extra consumers (recorders, previews)
+        # through the bus; publishing costs nothing until one subscribes
+        self.frame_bus = FrameBus()
         
         # Runtime state
         self._running = False
         self._frame_count = 0
         
+        # Actions and configurations requested by other threads, applied between frames
+        self._pending_actions: queue.SimpleQueue = queue.SimpleQueue()
+        self._pending_config: Optional[ControllerConfig] = None
+        
+        # Set once the first frame has been processed (perf_counter time)
+        self.first_frame_event = threading.Event()
+        self.first_frame_time: Optional[float] = None
+        
+        # Wall and CPU time per pipeline stage; the last frame's wall times and
+        # results are kept for the flight recorder
+        self.stage_profiler = StageProfiler(FLIGHT_STAGES)
+        self._frame_timings = {}
+        self._frame_landmarks = None
+        self._frame_angle: Optional[float] = None
+        
+        # Last inferred pose, reused on frames the inference scheduler skips
+        self._last_landmarks = None
+        self._last_arm_keypoints = None
+        
         # FPS tracking
         self._fps_start_time = 0.0
         self._fps_frame_count = 0
@@ -72,17 +166,54 @@ class ApplicationController:
         try:
             logger.info("Initializing application components...")
             
+            # Load the runtime configuration before building components from it
+            if self.config_path:
+                try:
+                    self.config_watcher = ConfigWatcher(self.config_path, clock=self.clock)
+                except (OSError, ValueError, TypeError) as e:
+                    logger.error(f"Failed to load configuration {self.config_path}: {e}")
+                    return False
+                self.config = self.config_watcher.config
+            
+            # Load the lens calibration; undistorters are built for the first frame size
+            if self.calibration_path:
+                try:
+                    self.calibration = load_calibration(self.calibration_path)
+                except (OSError, ValueError) as e:
+                    logger.error(f"Failed to load camera calibration {self.calibration_path}: {e}")
+                    return False
+                logger.info(f"Lens correction enabled ({self.undistort_mode})")
+            
             # Initialize camera manager
-            self.camera_manager = CameraManager(camera_id=self.camera_id)
+            self.camera_manager = CameraManager(
+                camera_id=self.camera_id,
+                backend=self.capture_backend,
+                source=self.capture_source,
+                clock=self.clock
+            )
             if not self.camera_manager.start_capture():
                 logger.error("Failed to initialize camera")
                 return False
             
-            # Initialize pose detector
-            self.pose_detector = PoseDetector(
-                confidence_threshold=self.confidence_threshold,
-                model_complexity=self.model_complexity
-            )
+            # Initialize pose detector, reusing a loaded one, locally or through a remote inference server
+            if self._provided_pose_detector is not None:
+                self.pose_detector = self._provided_pose_detector
+            elif self.remote_address:
+                host, port = parse_address(self.remote_address)
+                self.remote_client = RemoteCaptureClient(host, port)
+                if not self.remote_client.connect():
+                    logger.error("Failed to connect to remote inference server")
+                    return False
+                self.pose_detector = RemotePoseDetector(
+                    self.remote_client,
+                    confidence_threshold=self.confidence_threshold,
+                    clock=self.clock
+                )
+            else:
+                self.pose_detector = PoseDetector(
+                    confidence_threshold=self.confidence_threshold,
+                    model_complexity=self.model_complexity
+                )
             
             # Initialize mouse controller
             try:
@@ -92,10 +223,41 @@ class ApplicationController:
                 return False
             
             # Initialize display manager
-            self.display_manager = DisplayManager()
+            self.display_manager = DisplayManager(
+                show_pose_overlay=self.config.display.show_pose_overlay,
+                show_angle_info=self.config.display.show_angle_info,
+                font_scale=self.config.display.font_scale
+            )
             
             # Initialize angle calculator
-            self.angle_calculator = AngleCalculator()
+            self.angle_calculator = AngleCalculator(
+                right_click_threshold=self.config.angle.right_click_threshold,
+                left_click_threshold=self.config.angle.left_click_threshold,
+                hysteresis_margin=self.config.angle.hysteresis_margin
+            )
+            
+            # Initialize inference scheduling
+            if self.adaptive_inference:
+                self.inference_scheduler = InferenceScheduler()
+                logger.info("Adaptive inference enabled")
+            
+            # Initialize flight recorder
+            if self.flight_recorder_seconds > 0:
+                self.flight_recorder = FlightRecorder.for_duration(
+                    self.flight_recorder_seconds,
+                    output_dir=self.flight_record_dir,
+                    clock=self.clock
+                )
+                logger.info(
+                    f"Flight recorder keeping {self.flight_recorder.capacity} frames "
+                    f"({self.flight_recorder.memory_bytes / 1e6:.1f} MB)"
+                )
+            
+            # Initialize landmark publisher
+            if self.publish_destination:
+                self.publisher = LandmarkPublisher(self.publish_destination, source_id=self.camera_id)
+                if not self.publisher.start():
+                    return False
             
             logger.info("All components initialized successfully")
             return True
@@ -118,15 +280,28 @@ class ApplicationController:
         logger.info("Starting main application loop...")
         logger.info(f"Using MediaPipe model complexity: {self.model_complexity} ({'Lite' if self.model_complexity == 0 else 'Full' if self.model_complexity == 1 else 'Heavy'})")
         self._running = True
-        self._fps_start_time = time.time()
+        self._fps_start_time = self.clock.now()
+        
+        # The frame loop decides and dispatches mouse input, so it runs at the
+        # raised priority when a priority mode is configured
+        apply_thread_role(ROLE_DECISION)
         
         try:
             while self._running:
                 # Process single frame
                 frame_processed = self._process_frame()
                 
-                # Handle keyboard input (non-blocking)
+                # Record when the first frame was handled
+                if frame_processed and self.first_frame_time is None:
+                    self.first_frame_time = time.perf_counter()
+                    self.first_frame_event.set()
+                
+                # Handle keyboard input (non-blocking) and requested actions
                 self._handle_keyboard_input()
+                self._handle_pending_actions()
+                
+                # Apply configuration changes between frames
+                self._apply_config_updates()
                 
                 # If frame processing failed, handle error
                 if not frame_processed:
@@ -141,6 +316,8 @@ class ApplicationController:
             logger.info("Application interrupted by user")
         except Exception as e:
             logger.error(f"Unexpected error in main loop: {e}")
+            if self.flight_recorder:
+                self.flight_recorder.report_anomaly('exception')
         finally:
             self._running = False
             logger.info("Main application loop ended")
@@ -150,6 +327,27 @@ class ApplicationController:
         logger.info("Stopping application...")
         self._running = False
     
+    def request_action(self, action: str) -> None:
+        """Request an action from another thread or a hotkey; it runs between frames.
+        
+        Args:
+            action: One of ACTIONS ('stop', 'toggle', 'reset', 'dump')
+            
+        Raises:
+            ValueError: If the action is unknown
+        """
+        if action not in self.ACTIONS:
+            raise ValueError(f"action must be one of {self.ACTIONS}")
+        self._pending_actions.put(action)
+    
+    def apply_config(self, config: ControllerConfig) -> None:
+        """Request a configuration change from another thread; it is applied between frames.
+        
+        Args:
+            config: New runtime configuration
+        """
+        self._pending_config = config
+    
     def cleanup(self) -> None:
         """Clean up all system resources."""
         logger.info("Cleaning up application resources...")
@@ -175,24 +373,65 @@ class ApplicationController:
             except Exception as e:
                 logger.error(f"Error releasing camera: {e}")
         
+        # Let a pending flight recorder dump finish
+        if self.flight_recorder:
+            self.flight_recorder.close()
+        
+        # Stop publishing landmarks
+        if self.publisher:
+            self.publisher.close()
+        
+        # Close remote inference connection
+        if self.remote_client:
+            try:
+                self.remote_client.close()
+            except Exception as e:
+                logger.error(f"Error closing remote client: {e}")
+            self.remote_client = None
+        
         # Reset system state
         self.system_state = SystemState()
+        self.last_valid_angle = None
         
         logger.info("Cleanup completed")
     
     def toggle_pose_control(self) -> None:
-        """Toggle pose control on/off."""
-        self.system_state.pose_control_enabled = not self.system_state.pose_control_enabled
+        """Toggle pose control on/off.
         
-        if not self.system_state.pose_control_enabled:
+        Runs on the frame loop thread; other threads use request_action('toggle').
+        """
+        enabled = not self.system_state.pose_control_enabled
+        
+        if enabled:
+            self._publish_state(pose_control_enabled=True)
+            if self.inference_scheduler:
+                self.inference_scheduler.invalidate()
+        else:
             # Release all mouse buttons when disabling
             if self.mouse_controller:
                 self.mouse_controller.release_all()
-            self.system_state.current_control_state = ControlState.NEUTRAL
+            self._publish_state(pose_control_enabled=False, current_control_state=ControlState.NEUTRAL)
         
-        status = "enabled" if self.system_state.pose_control_enabled else "disabled"
+        status = "enabled" if enabled else "disabled"
         logger.info(f"Pose control {status}")
     
+    def _publish_state(self, **changes) -> None:
+        """Publish a new SystemState snapshot with some fields changed.
+        
+        Only the frame loop thread publishes, so the snapshot never needs a
+        lock: readers take system_state once and get a consistent set of
+        fields. Called on state transitions only, never for an unchanged frame.
+        
+        Args:
+            **changes: SystemState fields to change
+        """
+        state = self.system_state
+        self.system_state = SystemState.trusted(
+            changes.get('pose_control_enabled', state.pose_control_enabled),
+            changes.get('current_control_state', state.current_control_state),
+            changes.get('error_count', state.error_count)
+        )
+    
     def _process_frame(self) -> bool:
         """Process a single video frame.
         
@@ -201,9 +440,16 @@ class ApplicationController:
         """
         try:
             # Capture frame
+            stage = self.stage_profiler.begin()
             frame = self.camera_manager.get_frame()
             if frame is None:
                 return False
+            if self.calibration is not None and self.undistort_mode == 'frame':
+                frame = self._undistort_frame(frame)
+            self.frame_bus.publish(frame, self.clock.now())
+            self._frame_timings = {'capture': self.stage_profiler.end('capture', stage)}
+            self._frame_landmarks = None
+            self._frame_angle = None
             
             # Initialize display frame
             display_frame = frame.copy()
@@ -218,17 +464,40 @@ class ApplicationController:
                 self._set_neutral_state()
             
             # Draw control state indicator
+            stage = self.stage_profiler.begin()
             display_frame = self.display_manager.draw_control_state_indicator(
                 display_frame, self.system_state.current_control_state
             )
             
             # Display frame
             self.display_manager.show_frame(display_frame)
+            self._frame_timings['display'] = self.stage_profiler.end('display', stage)
+            
+            if self.flight_recorder or self.publisher:
+                landmarks = None if self._frame_landmarks is None else landmarks_to_array(self._frame_landmarks)
+                if self.publisher:
+                    self.publisher.publish(
+                        self._frame_count,
+                        self.clock.wall(),
+                        landmarks=landmarks,
+                        angle=self._frame_angle,
+                        control_state=self.system_state.current_control_state
+                    )
+                if self.flight_recorder:
+                    self.flight_recorder.record(
+                        frame,
+                        landmarks=landmarks,
+                        angle=self._frame_angle,
+                        control_state=self.system_state.current_control_state,
+                        timings_ms=self._frame_timings
+                    )
             
             return True
             
         except Exception as e:
             logger.error(f"Error processing frame: {e}")
+            if self.flight_recorder:
+                self.flight_recorder.report_anomaly('exception')
             return False
     
     def _process_pose_detection(self, original_frame, display_frame):
@@ -241,8 +510,17 @@ class ApplicationController:
         Returns:
             Updated display frame with overlays
         """
+        # Reuse the last decision while the state cannot plausibly change
+        scheduler = self.inference_scheduler
+        if scheduler is not None and not scheduler.should_infer(self.clock.now()):
+            return self._draw_last_decision(display_frame)
+        
         # Detect pose
+        stage = self.stage_profiler.begin()
         landmarks = self.pose_detector.detect_pose(original_frame)
+        self._frame_timings['inference'] = self.stage_profiler.end('inference', stage)
+        self._frame_landmarks = landmarks
+        stage = self.stage_profiler.begin()
         
         if landmarks:
             # Extract arm keypoints
@@ -250,26 +528,39 @@ class ApplicationController:
             
             if arm_keypoints:
                 try:
-                    # Calculate elbow angle
+                    # Calculate elbow angle, on lens-corrected keypoints if calibrated
+                    angle_keypoints = arm_keypoints
+                    if self.calibration is not None and self.undistort_mode == 'keypoints':
+                        angle_keypoints = self._undistort_keypoints(arm_keypoints, original_frame)
                     angle = self.angle_calculator.calculate_elbow_angle(
-                        arm_keypoints.shoulder,
-                        arm_keypoints.elbow,
-                        arm_keypoints.wrist
+                        angle_keypoints.shoulder,
+                        angle_keypoints.elbow,
+                        angle_keypoints.wrist
                     )
                     
                     if self.angle_calculator.is_angle_valid(angle):
                         # Update system state
-                        self.system_state.last_valid_angle = angle
+                        self.last_valid_angle = angle
+                        self._frame_angle = angle
                         
                         # Get control state and update mouse
                         control_state = self.angle_calculator.get_control_state(angle)
                         self._update_mouse_control(control_state)
                         
+                        if scheduler is not None:
+                            scheduler.record(
+                                self.clock.now(), angle, self.angle_calculator.get_threshold_margin(angle)
+                            )
+                            self._last_landmarks = landmarks
+                            self._last_arm_keypoints = arm_keypoints
+                        
                         # Draw pose overlay
-                        display_frame = self.display_manager.draw_pose_overlay(display_frame, arm_keypoints)
+                        if self.display_manager.show_pose_overlay:
+                            display_frame = self.display_manager.draw_pose_overlay(display_frame, arm_keypoints)
                         
                         # Draw angle and state info
-                        display_frame = self.display_manager.draw_angle_info(display_frame, angle, control_state)
+                        if self.display_manager.show_angle_info:
+                            display_frame = self.display_manager.draw_angle_info(display_frame, angle, control_state)
                         
                 except ValueError as e:
                     logger.warning(f"Invalid angle calculation: {e}")
@@ -277,12 +568,82 @@ class ApplicationController:
             else:
                 # No valid arm keypoints detected
                 self._set_neutral_state()
+        elif isinstance(self.pose_detector, RemotePoseDetector) and self.pose_detector.get_remote_decision():
+            # A state-only remote server sends its decision instead of landmarks
+            control_state, angle = self.pose_detector.get_remote_decision()
+            display_frame = self._apply_remote_decision(control_state, angle, display_frame)
         else:
             # No pose detected
             self._set_neutral_state()
         
+        if scheduler is not None and self._frame_angle is None:
+            # Nothing measured, so nothing to extrapolate from
+            scheduler.invalidate()
+        
+        self._frame_timings['decision'] = self.stage_profiler.end('decision', stage)
+        return display_frame
+    
+    def _apply_remote_decision(self, control_state: ControlState, angle: float, display_frame):
+        """Act on a control state decided by a remote server in state reply mode.
+        
+        Args:
+            control_state: Control state decided by the server
+            angle: Elbow angle the server measured
+            display_frame: Frame to draw overlays on
+            
+        Returns:
+            Updated display frame with the angle info
+        """
+        self.last_valid_angle = angle
+        self._frame_angle = angle
+        self._update_mouse_control(control_state)
+        
+        # Keep the local hysteresis in step so threshold margins match the decision
+        self.angle_calculator.set_last_state(control_state)
+        if self.inference_scheduler is not None:
+            self.inference_scheduler.record(
+                self.clock.now(), angle, self.angle_calculator.get_threshold_margin(angle)
+            )
+            self._last_landmarks = None
+            self._last_arm_keypoints = None
+        
+        if self.display_manager.show_angle_info:
+            display_frame = self.display_manager.draw_angle_info(display_frame, angle, control_state)
         return display_frame
     
+    def _draw_last_decision(self, display_frame):
+        """Keep the last inferred pose and control state for a skipped frame.
+        
+        Args:
+            display_frame: Frame to draw overlays on
+            
+        Returns:
+            Updated display frame with the last overlays
+        """
+        self._frame_landmarks = self._last_landmarks
+        self._frame_angle = self.last_valid_angle
+        if self.display_manager.show_pose_overlay and self._last_arm_keypoints is not None:
+            display_frame = self.display_manager.draw_pose_overlay(display_frame, self._last_arm_keypoints)
+        if self.display_manager.show_angle_info and self.last_valid_angle is not None:
+            display_frame = self.display_manager.draw_angle_info(
+                display_frame, self.last_valid_angle, self.system_state.current_control_state
+            )
+        return display_frame
+    
+    def _undistort_frame(self, frame):
+        """Rectify a frame, rebuilding the remap maps when the frame size changes."""
+        size = (frame.shape[1], frame.shape[0])
+        if self._frame_undistorter is None or self._frame_undistorter.frame_size != size:
+            self._frame_undistorter = FrameUndistorter(self.calibration, size)
+        return self._frame_undistorter.undistort(frame)
+    
+    def _undistort_keypoints(self, arm_keypoints, frame):
+        """Remove lens distortion from the arm keypoints of a frame."""
+        size = (frame.shape[1], frame.shape[0])
+        if self._keypoint_undistorter is None or self._keypoint_undistorter.frame_size != size:
+            self._keypoint_undistorter = KeypointUndistorter(self.calibration, size)
+        return self._keypoint_undistorter.undistort_arm(arm_keypoints)
+    
     def _update_mouse_control(self, control_state: ControlState) -> None:
         """Update mouse control based on the detected control state.
         
@@ -291,24 +652,29 @@ class ApplicationController:
         """
         try:
             self.mouse_controller.set_state(control_state)
-            self.system_state.current_control_state = control_state
-            self.system_state.error_count = 0  # Reset error count on success
-            
         except Exception as e:
-            self.system_state.error_count += 1
+            error_count = self.system_state.error_count + 1
             logger.error(f"Mouse control error: {e}")
             
             # If too many errors, disable pose control temporarily
-            if self.system_state.error_count > 5:
+            if error_count > 5:
                 logger.warning("Too many mouse control errors, temporarily disabling pose control")
-                self.system_state.pose_control_enabled = False
+                self._publish_state(error_count=error_count, pose_control_enabled=False)
+            else:
+                self._publish_state(error_count=error_count)
+            return
+        
+        # Reset error count on success; an unchanged state publishes nothing
+        state = self.system_state
+        if state.current_control_state != control_state or state.error_count:
+            self._publish_state(current_control_state=control_state, error_count=0)
     
     def _set_neutral_state(self) -> None:
         """Set mouse to neutral state when no pose is detected."""
         if self.system_state.current_control_state != ControlState.NEUTRAL:
             try:
                 self.mouse_controller.set_state(ControlState.NEUTRAL)
-                self.system_state.current_control_state = ControlState.NEUTRAL
+                self._publish_state(current_control_state=ControlState.NEUTRAL)
             except Exception as e:
                 logger.error(f"Error setting neutral state: {e}")
     
@@ -316,23 +682,88 @@ class ApplicationController:
         """Handle keyboard input for system control."""
         try:
             key = self.display_manager.handle_key_input()
-            
-            if key == 'esc' or key == 'q':
-                # Exit application
-                self.stop()
-            elif key == 'space':
-                # Toggle pose control
-                self.toggle_pose_control()
-            elif key == 'r':
-                # Reset error counts and re-enable pose control
-                self.system_state.error_count = 0
-                self.system_state.pose_control_enabled = True
-                if self.mouse_controller:
-                    self.mouse_controller.reset_error_count()
-                logger.info("System reset - pose control re-enabled")
+            action = self.KEY_ACTIONS.get(key)
+            if action:
+                # Hotkeys are commands like any other request, applied by _handle_pending_actions
+                self.request_action(action)
         except Exception as e:
             logger.error(f"Error handling keyboard input: {e}")
     
+    def _handle_pending_actions(self) -> None:
+        """Perform actions requested through request_action()."""
+        while True:
+            try:
+                action = self._pending_actions.get_nowait()
+            except queue.Empty:
+                return
+            try:
+                self._perform_action(action)
+            except Exception as e:
+                logger.error(f"Error performing requested action '{action}': {e}")
+    
+    def _perform_action(self, action: str) -> None:
+        """Perform a control action triggered by a key or a request.
+        
+        Args:
+            action: One of ACTIONS
+        """
+        if action == 'stop':
+            # Exit application
+            self.stop()
+        elif action == 'toggle':
+            # Toggle pose control
+            self.toggle_pose_control()
+        elif action == 'reset':
+            # Reset error counts and re-enable pose control
+            self._publish_state(error_count=0, pose_control_enabled=True)
+            if self.mouse_controller:
+                self.mouse_controller.reset_error_count()
+            logger.info("System reset - pose control re-enabled")
+        elif action == 'dump':
+            # Dump the flight recorder for offline inspection
+            if self.flight_recorder:
+                self.flight_recorder.trigger('hotkey')
+    
+    def _apply_config_updates(self) -> None:
+        """Apply requested or configuration file changes, rebuilding only affected components.
+        
+        The camera, pose detector and mouse controller are never touched. A new
+        angle calculator continues from the previous hysteresis state.
+        """
+        if self.config_watcher is None and self._pending_config is None:
+            return
+        
+        try:
+            new_config, self._pending_config = self._pending_config, None
+            if new_config is None:
+                new_config = self.config_watcher.poll()
+            if new_config is None:
+                return
+            
+            changed = new_config.changed_sections(self.config)
+            
+            if 'angle' in changed:
+                angle_calculator = AngleCalculator(
+                    right_click_threshold=new_config.angle.right_click_threshold,
+                    left_click_threshold=new_config.angle.left_click_threshold,
+                    hysteresis_margin=new_config.angle.hysteresis_margin
+                )
+                angle_calculator.set_last_state(self.angle_calculator.get_last_state())
+                self.angle_calculator = angle_calculator
+                if self.inference_scheduler:
+                    self.inference_scheduler.invalidate()
+            
+            if 'display' in changed:
+                self.display_manager.show_pose_overlay = new_config.display.show_pose_overlay
+                self.display_manager.show_angle_info = new_config.display.show_angle_info
+                self.display_manager.font_scale = new_config.display.font_scale
+            
+            self.config = new_config
+            logger.info(f"Configuration reloaded: {', '.join(changed) or 'no changes'}")
+            
+        except Exception as e:
+            logger.error(f"Error applying configuration update: {e}")
+    
     def _handle_frame_error(self) -> bool:
         """Handle frame processing errors.
         
@@ -344,6 +775,9 @@ class ApplicationController:
             if not self.camera_manager.is_available():
                 logger.warning("Camera unavailable, attempting reconnection...")
                 
+                # Do not keep buttons held on stale input while reconnecting
+                self._set_neutral_state()
+                
                 # Try to reconnect
                 if self.camera_manager.reconnect():
                     logger.info("Camera reconnected successfully")
@@ -352,6 +786,9 @@ class ApplicationController:
                     logger.error("Failed to reconnect camera")
                     return False
             
+            if self.flight_recorder:
+                self.flight_recorder.report_anomaly('frame_error')
+            
             # Camera is available but frame capture failed
             # Continue processing - might be temporary issue
             return True
@@ -406,13 +843,25 @@ class ApplicationController:
         self._fps_frame_count += 1
         
         if self._fps_frame_count >= self._fps_update_interval:
-            current_time = time.time()
+            current_time = self.clock.now()
             elapsed = current_time - self._fps_start_time
             
             if elapsed > 0:
                 self._current_fps = self._fps_frame_count / elapsed
                 model_name = {0: 'Lite', 1: 'Full', 2: 'Heavy'}[self.model_complexity]
                 logger.info(f"Current FPS: {self._current_fps:.1f} | Model: {model_name}")
+                stages = self.stage_profiler.get_stats()['stages']
+                logger.debug("Stage CPU ms/frame: " + " | ".join(
+                    f"{stage} {stats['cpu_ms_mean']:.1f}/{stats['wall_ms_mean']:.1f} wall"
+                    for stage, stats in stages.items()
+                ))
+                if self.remote_client:
+                    latency = self.remote_client.get_latency_stats()
+                    logger.info(
+                        f"Remote latency p50: total {latency['total_ms']['p50']:.1f} ms | "
+                        f"network {latency['network_ms']['p50']:.1f} ms | "
+                        f"inference {latency['inference_ms']['p50']:.1f} ms"
+                    )
             
             # Reset counters
             self._fps_start_time = current_time
@@ -443,18 +892,52 @@ class ApplicationController:
         """Get current system status information.
         
         Returns:
-            dict: System status information
+            dict: System status information; the control fields come from one
+                SystemState snapshot, last_valid_angle is the latest per-frame angle
         """
-        return {
+        state = self.system_state
+        status = {
             'running': self._running,
-            'pose_control_enabled': self.system_state.pose_control_enabled,
-            'current_control_state': str(self.system_state.current_control_state),
-            'last_valid_angle': self.system_state.last_valid_angle,
-            'error_count': self.system_state.error_count,
+            'pose_control_enabled': state.pose_control_enabled,
+            'current_control_state': str(state.current_control_state),
+            'last_valid_angle': self.last_valid_angle,
+            'error_count': state.error_count,
             'camera_available': self.camera_manager.is_available() if self.camera_manager else False,
             'mouse_controller_healthy': self.mouse_controller.is_healthy() if self.mouse_controller else False,
             'frame_count': self._frame_count,
             'current_fps': self._current_fps,
             'model_complexity': self.model_complexity,
-            'model_name': {0: 'Lite', 1: 'Full', 2: 'Heavy'}[self.model_complexity]
-        }
\ No newline at end of file
+            'model_name': {0: 'Lite', 1: 'Full', 2: 'Heavy'}[self.model_complexity],
+            'config_reloads': self.config_watcher.reload_count if self.config_watcher else 0,
+            'camera_frozen_events': self.camera_manager.frozen_events if self.camera_manager else 0
+        }
+        
+        if self.camera_manager:
+            status['camera_read'] = self.camera_manager.get_read_stats()
+        
+        if self.remote_client:
+            status['remote_latency'] = self.remote_client.get_latency_stats()
+        
+        if self.inference_scheduler:
+            status['inference_schedule'] = self.inference_scheduler.get_stats()
+        
+        status['thread_priority'] = get_thread_priority().get_stats()
+        
+        if self.frame_bus.has_subscribers():
+            status['frame_bus'] = self.frame_bus.get_stats()
+        status['stage_timing'] = self.stage_profiler.get_stats()
+        status['resource_usage'] = resource_usage()
+        
+        if self.flight_recorder:
+            status['flight_recorder'] = {
+                'frames': self.flight_recorder.frame_count,
+                'memory_bytes': self.flight_recorder.memory_bytes,
+                'dumps': self.flight_recorder.dump_count,
+                'failed_dumps': self.flight_recorder.failed_dumps,
+                'last_dump_path': self.flight_recorder.last_dump_path,
+            }
+        
+        if self.publisher:
+            status['publisher'] = self.publisher.get_stats()
+        
+        return status
\ No newline at end of file
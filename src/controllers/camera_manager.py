@@ -2,14 +2,88 @@
 
 import cv2
 import numpy as np
-from typing import Optional
+import time
+import zlib
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor, TimeoutError as FutureTimeoutError
+from typing import Callable, Optional
 import logging
 
+from ..utils.thread_priority import ROLE_CAPTURE, apply_thread_role
+
+
+FINGERPRINT_GRID = 16
+
+# Deadline in seconds for the test read when a capture starts; the first frame
+# after opening a device takes longer than the rest (format negotiation, exposure)
+START_READ_TIMEOUT = 2.0
+
+# Upper bounds of the cumulative read time histogram, in milliseconds
+READ_TIME_BUCKETS_MS = (10, 20, 35, 50, 100, 250, 500, 1000)
+
+# OpenCV capture backends selectable by name
+CAPTURE_BACKENDS = {
+    'auto': cv2.CAP_ANY,
+    'v4l2': cv2.CAP_V4L2,
+    'gstreamer': cv2.CAP_GSTREAMER,
+    'ffmpeg': cv2.CAP_FFMPEG,
+    'dshow': cv2.CAP_DSHOW,
+    'msmf': cv2.CAP_MSMF,
+    'avfoundation': cv2.CAP_AVFOUNDATION,
+}
+
+
+def gstreamer_camera_pipeline(camera_id: int, width: int, height: int, fps: int = 30) -> str:
+    """
+    Build a low-latency GStreamer pipeline for a V4L2 camera.
+    
+    The appsink keeps only the newest buffer (drop=true max-buffers=1) and does
+    not sync to the clock, so a slow consumer always gets the latest frame.
+    
+    Args:
+        camera_id: Camera device index (/dev/videoN)
+        width: Frame width
+        height: Frame height
+        fps: Requested frame rate
+        
+    Returns:
+        str: Pipeline string for cv2.VideoCapture(..., cv2.CAP_GSTREAMER)
+    """
+    return (
+        f"v4l2src device=/dev/video{camera_id} ! "
+        f"video/x-raw,width={width},height={height},framerate={fps}/1 ! "
+        f"videoconvert ! video/x-raw,format=BGR ! appsink drop=true max-buffers=1 sync=false"
+    )
+
+
+def frame_fingerprint(frame: np.ndarray, grid: int = FINGERPRINT_GRID) -> int:
+    """
+    Compute a cheap checksum of a sparse pixel grid.
+    
+    Live sensors never deliver two bit-identical frames because of noise, so an
+    unchanged checksum means the driver is handing back a stale buffer.
+    
+    Args:
+        frame: Image array
+        grid: Number of sampled rows and columns
+        
+    Returns:
+        int: CRC32 of the grid x grid sampled pixels
+    """
+    height, width = frame.shape[:2]
+    row_step = max(1, height // grid)
+    col_step = max(1, width // grid)
+    sample = frame[row_step // 2::row_step, col_step // 2::col_step]
+    return zlib.crc32(np.ascontiguousarray(sample))
+
 
 class CameraManager:
     """Manages camera connection, frame capture, and resource cleanup."""
     
-    def __init__(self, camera_id: int = 0, width: int = 640, height: int = 480):
+    def __init__(self, camera_id: int = 0, width: int = 640, height: int = 480,
+                 freeze_timeout: Optional[float] = 0.1, read_timeout: Optional[float] = 0.5,
+                 backend: str = 'auto', source: Optional[str] = None,
+                 clock: Callable[[], float] = time.monotonic):
         """
         Initialize camera manager.
         
@@ -17,13 +91,47 @@ class CameraManager:
             camera_id: Camera device ID (default: 0 for primary camera)
             width: Frame width for capture (default: 640)
             height: Frame height for capture (default: 480)
+            freeze_timeout: Seconds of identical frames after which the camera is
+                considered frozen (default: 0.1, None to disable)
+            read_timeout: Deadline in seconds for a single frame read (default: 0.5,
+                None to read on the calling thread without a deadline)
+            backend: OpenCV capture backend, one of CAPTURE_BACKENDS (default: 'auto')
+            source: Video file, URL or GStreamer pipeline opened instead of camera_id;
+                with the gstreamer backend and no source, a low-latency v4l2src
+                pipeline is built for camera_id
+            clock: Monotonic time source in seconds
+            
+        Raises:
+            ValueError: If the backend is unknown
         """
+        if backend not in CAPTURE_BACKENDS:
+            raise ValueError(f"backend must be one of {tuple(CAPTURE_BACKENDS)}")
+        
         self.camera_id = camera_id
+        self.backend = backend
+        self.source = source
         self.width = width
         self.height = height
+        self.freeze_timeout = freeze_timeout
         self.cap: Optional[cv2.VideoCapture] = None
         self._is_initialized = False
         self.logger = logging.getLogger(__name__)
+        
+        # Frozen frame detection
+        self._clock = clock
+        self._last_fingerprint: Optional[int] = None
+        self._last_change_time = 0.0
+        self._is_frozen = False
+        self.frozen_events = 0
+        
+        # Deadline-bounded reads run on a single reader thread
+        self.read_timeout = read_timeout
+        self._reader: Optional[ThreadPoolExecutor] = None
+        self._pending_read = None
+        self._read_timed_out = False
+        self.read_timeouts = 0
+        self._read_times_ms: deque = deque(maxlen=300)
+        self._read_histogram = np.zeros(len(READ_TIME_BUCKETS_MS) + 1, dtype=np.int64)
     
     def start_capture(self) -> bool:
         """
@@ -33,24 +141,35 @@ class CameraManager:
             bool: True if camera initialization successful, False otherwise
         """
         try:
-            self.cap = cv2.VideoCapture(self.camera_id)
+            self.cap = self._open_capture()
             
             if not self.cap.isOpened():
-                self.logger.error(f"Failed to open camera {self.camera_id}")
+                self.logger.error(f"Failed to open camera {self.camera_id} (backend: {self.backend})")
                 return False
             
-            # Set camera properties for optimal performance
-            self.cap.set(cv2.CAP_PROP_FRAME_WIDTH, self.width)
-            self.cap.set(cv2.CAP_PROP_FRAME_HEIGHT, self.height)
-            self.cap.set(cv2.CAP_PROP_FPS, 30)
+            # Set camera properties for optimal performance (pipelines and files fix their own format)
+            if self.source is None and self.backend != 'gstreamer':
+                self.cap.set(cv2.CAP_PROP_FRAME_WIDTH, self.width)
+                self.cap.set(cv2.CAP_PROP_FRAME_HEIGHT, self.height)
+                self.cap.set(cv2.CAP_PROP_FPS, 30)
             
-            # Verify camera is working by capturing a test frame
-            ret, _ = self.cap.read()
+            # Verify camera is working by capturing a test frame, under a deadline
+            # since reconnect() runs right after a read hung on this device
+            start_timeout = None if self.read_timeout is None else max(self.read_timeout, START_READ_TIMEOUT)
+            result = self._read_with_deadline(timeout=start_timeout, record=False)
+            if result is None:
+                self.logger.error("Camera opened but the test frame missed its deadline")
+                self.release()
+                return False
+            ret, frame = result
             if not ret:
                 self.logger.error("Camera opened but failed to capture frame")
                 self.release()
                 return False
             
+            self._last_fingerprint = frame_fingerprint(frame)
+            self._last_change_time = self._clock()
+            self._is_frozen = False
             self._is_initialized = True
             self.logger.info(f"Camera {self.camera_id} initialized successfully")
             return True
@@ -60,6 +179,23 @@ class CameraManager:
             self.release()
             return False
     
+    def _open_capture(self) -> cv2.VideoCapture:
+        """
+        Open the capture for the configured source and backend.
+        
+        Returns:
+            cv2.VideoCapture: Capture object (may not be opened)
+        """
+        target = self.source
+        if target is None:
+            target = self.camera_id
+            if self.backend == 'gstreamer':
+                target = gstreamer_camera_pipeline(self.camera_id, self.width, self.height)
+        
+        if self.backend == 'auto':
+            return cv2.VideoCapture(target)
+        return cv2.VideoCapture(target, CAPTURE_BACKENDS[self.backend])
+    
     def get_frame(self) -> Optional[np.ndarray]:
         """
         Capture a single frame from the camera.
@@ -72,11 +208,18 @@ class CameraManager:
             return None
         
         try:
-            ret, frame = self.cap.read()
+            result = self._read_with_deadline()
+            if result is None:
+                return None
+            
+            ret, frame = result
             if not ret:
                 self.logger.warning("Failed to capture frame")
                 return None
             
+            if self._check_frozen(frame):
+                return None
+            
             return frame
             
         except Exception as e:
@@ -93,24 +236,147 @@ class CameraManager:
         if not self._is_initialized or self.cap is None:
             return False
         
+        if self._is_frozen or self._read_timed_out:
+            return False
+        
         try:
             return self.cap.isOpened()
         except Exception:
             return False
     
+    def get_read_stats(self) -> dict:
+        """
+        Get the distribution of frame read times.
+        
+        Returns:
+            dict: Read count, missed deadlines, mean/p50/p99/max over recent reads
+                  and a cumulative histogram keyed by bucket upper bound in ms
+        """
+        recent = np.fromiter(self._read_times_ms, dtype=np.float64)
+        labels = [f"<={bound}" for bound in READ_TIME_BUCKETS_MS] + [f">{READ_TIME_BUCKETS_MS[-1]}"]
+        return {
+            'reads': int(self._read_histogram.sum()),
+            'timeouts': self.read_timeouts,
+            'mean_ms': float(recent.mean()) if recent.size else 0.0,
+            'p50_ms': float(np.percentile(recent, 50)) if recent.size else 0.0,
+            'p99_ms': float(np.percentile(recent, 99)) if recent.size else 0.0,
+            'max_ms': float(recent.max()) if recent.size else 0.0,
+            'histogram_ms': dict(zip(labels, self._read_histogram.tolist())),
+        }
+    
+    def _read_with_deadline(self, timeout: Optional[float] = None, record: bool = True) -> Optional[tuple]:
+        """
+        Read a frame, giving up after read_timeout seconds.
+        
+        A read that misses its deadline is left running on the reader thread;
+        the camera is flagged unavailable so the caller reconnects, and the
+        abandoned capture is released once that read finally returns.
+        
+        Args:
+            timeout: Deadline in seconds instead of read_timeout (ignored when
+                read_timeout is None)
+            record: Count the read in the read time statistics
+        
+        Returns:
+            Optional[tuple]: (ret, frame) from cap.read(), None if the deadline was missed
+        """
+        start = time.perf_counter()
+        if self.read_timeout is None:
+            result = self.cap.read()
+        else:
+            if self._reader is None:
+                self._reader = ThreadPoolExecutor(
+                    max_workers=1, thread_name_prefix=f'camera-{self.camera_id}-read',
+                    initializer=apply_thread_role, initargs=(ROLE_CAPTURE,)
+                )
+            deadline = self.read_timeout if timeout is None else timeout
+            self._pending_read = self._reader.submit(self.cap.read)
+            try:
+                result = self._pending_read.result(timeout=deadline)
+            except FutureTimeoutError:
+                self._read_timed_out = True
+                self.read_timeouts += 1
+                if record:
+                    self._record_read_time(deadline * 1000.0)
+                self.logger.warning(f"Camera {self.camera_id} read missed its {deadline * 1000:.0f} ms deadline")
+                return None
+            self._pending_read = None
+        
+        if record:
+            self._record_read_time((time.perf_counter() - start) * 1000.0)
+        return result
+    
+    def _record_read_time(self, read_ms: float) -> None:
+        """Add one read time to the recent window and the histogram."""
+        self._read_times_ms.append(read_ms)
+        self._read_histogram[np.searchsorted(READ_TIME_BUCKETS_MS, read_ms)] += 1
+    
+    def is_frozen(self) -> bool:
+        """
+        Check if the camera keeps returning the same frame.
+        
+        Returns:
+            bool: True if identical frames were read for longer than freeze_timeout
+        """
+        return self._is_frozen
+    
+    def _check_frozen(self, frame: np.ndarray) -> bool:
+        """
+        Compare a frame's fingerprint with the previous one.
+        
+        Args:
+            frame: Frame just read from the camera
+            
+        Returns:
+            bool: True if the camera is frozen
+        """
+        if self.freeze_timeout is None:
+            return False
+        
+        now = self._clock()
+        fingerprint = frame_fingerprint(frame)
+        if fingerprint != self._last_fingerprint:
+            self._last_fingerprint = fingerprint
+            self._last_change_time = now
+            self._is_frozen = False
+            return False
+        
+        if not self._is_frozen and now - self._last_change_time >= self.freeze_timeout:
+            self._is_frozen = True
+            self.frozen_events += 1
+            self.logger.warning(
+                f"Camera {self.camera_id} frozen: identical frames for "
+                f"{(now - self._last_change_time) * 1000:.0f} ms"
+            )
+        return self._is_frozen
+    
     def release(self) -> None:
         """Release camera resources and cleanup."""
         try:
-            if self.cap is not None:
+            if self._pending_read is not None and not self._pending_read.done():
+                # The reader is stuck in cap.read(); releasing here could block
+                # too, so release once the read returns and abandon the thread
+                cap = self.cap
+                self._pending_read.add_done_callback(lambda _: cap.release())
+                self.logger.warning("Camera read still blocked, capture released in background")
+            elif self.cap is not None:
                 self.cap.release()
                 self.logger.info("Camera resources released")
             
+            if self._reader is not None:
+                self._reader.shutdown(wait=False)
+                self._reader = None
+            
         except Exception as e:
             self.logger.error(f"Error releasing camera: {e}")
         finally:
             # Always cleanup regardless of exceptions
             self.cap = None
             self._is_initialized = False
+            self._last_fingerprint = None
+            self._is_frozen = False
+            self._pending_read = None
+            self._read_timed_out = False
     
     def reconnect(self) -> bool:
         """
@@ -139,7 +405,10 @@ class CameraManager:
                 'height': int(self.cap.get(cv2.CAP_PROP_FRAME_HEIGHT)),
                 'fps': self.cap.get(cv2.CAP_PROP_FPS),
                 'camera_id': self.camera_id,
-                'is_available': True
+                'backend': self.cap.getBackendName(),
+                'is_available': True,
+                'frozen_events': self.frozen_events,
+                'read_timeouts': self.read_timeouts
             }
         except Exception as e:
             self.logger.error(f"Error getting camera info: {e}")
@@ -0,0 +1,241 @@
+"""
+Multi-source capture multiplexer for the OpenCV Minecraft Controller.
+
+Multi-station setups read several cameras in one process. Reading them
+round-robin makes every source wait for the slowest one: a 15 fps camera
+holds back a 30 fps camera, and a frame that is ready sits in the driver
+until its turn comes. The multiplexer hands frames off in the order they
+become ready instead, each tagged with its source ID and grab timestamp.
+
+Two strategies are available:
+
+- 'waitany' blocks in cv2.VideoCapture.waitAny() on all cameras at once, then
+  retrieves only the ones that grabbed a frame. One thread serves every
+  source, but OpenCV implements it for the V4L2 backend only, and frames are
+  read from the raw captures, bypassing CameraManager's read deadline and
+  frozen-frame checks.
+- 'threads' runs one reader thread per source calling get_frame(), which works
+  with any frame source (other backends, video files, ReplaySource).
+
+'auto' probes waitAny once at start() and falls back to threads when any
+source does not support it.
+"""
+
+import logging
+import queue
+import threading
+import time
+from typing import List, NamedTuple, Optional, Sequence
+
+import cv2
+import numpy as np
+
+from ..utils.thread_priority import ROLE_CAPTURE, apply_thread_role
+
+
+logger = logging.getLogger(__name__)
+
+
+MULTIPLEX_MODES = ('auto', 'waitany', 'threads')
+
+
+class SourceFrame(NamedTuple):
+    """A frame handed off by the multiplexer."""
+    source_id: int
+    sequence: int
+    timestamp: float
+    frame: np.ndarray
+
+
+def waitany_supported(captures: Sequence) -> bool:
+    """Check whether cv2.VideoCapture.waitAny() accepts these captures.
+
+    The probe uses a 1 ns timeout, which may grab a frame on a ready camera;
+    it is dropped by the next grab.
+
+    Args:
+        captures: cv2.VideoCapture objects
+
+    Returns:
+        bool: True if waitAny can multiplex all of them
+    """
+    if not captures or not all(isinstance(cap, cv2.VideoCapture) for cap in captures):
+        return False
+    try:
+        cv2.VideoCapture.waitAny(list(captures), 1)
+        return True
+    except cv2.error:
+        return False
+
+
+class CaptureMultiplexer:
+    """Delivers frames from several sources in the order they become ready."""
+
+    def __init__(
+        self,
+        sources: Sequence,
+        mode: str = 'auto',
+        queue_size: int = 8,
+        wait_timeout: float = 0.1
+    ):
+        """Initialize the multiplexer; the sources must already be started.
+
+        Args:
+            sources: Frame sources with get_frame() (CameraManager, ReplaySource);
+                the waitany mode also needs a cv2.VideoCapture in their cap attribute
+            mode: 'auto', 'waitany' or 'threads'
+            queue_size: Frames buffered for the consumer before the oldest is dropped
+            wait_timeout: Seconds one waitAny() call blocks before checking for close()
+
+        Raises:
+            ValueError: If there are no sources, or mode or queue_size is invalid
+        """
+        if not sources:
+            raise ValueError("at least one source is required")
+        if mode not in MULTIPLEX_MODES:
+            raise ValueError(f"mode must be one of {', '.join(MULTIPLEX_MODES)}")
+        if queue_size < 1:
+            raise ValueError("queue_size must be positive")
+
+        self.sources = list(sources)
+        self.requested_mode = mode
+        self.mode: Optional[str] = None
+        self.wait_timeout = wait_timeout
+
+        self._frames: queue.Queue = queue.Queue(maxsize=queue_size)
+        self._threads: List[threading.Thread] = []
+        self._running = False
+        self._sequences = [0] * len(self.sources)
+        self._dropped = 0
+        self._read_failures = [0] * len(self.sources)
+
+    def start(self) -> str:
+        """Start delivering frames.
+
+        Returns:
+            str: The mode in use, 'waitany' or 'threads'
+
+        Raises:
+            RuntimeError: If mode is 'waitany' and the sources do not support it
+        """
+        captures = [getattr(source, 'cap', None) for source in self.sources]
+        if self.requested_mode == 'threads':
+            self.mode = 'threads'
+        elif waitany_supported(captures):
+            self.mode = 'waitany'
+        elif self.requested_mode == 'waitany':
+            raise RuntimeError("cv2.VideoCapture.waitAny() is not supported by these sources (V4L2 only)")
+        else:
+            logger.info("waitAny not supported by the capture sources, using one reader thread per source")
+            self.mode = 'threads'
+
+        self._running = True
+        if self.mode == 'waitany':
+            self._threads = [threading.Thread(
+                target=self._waitany_loop, args=(captures,), name='capture-waitany', daemon=True
+            )]
+        else:
+            self._threads = [
+                threading.Thread(target=self._reader_loop, args=(source_id,),
+                                 name=f'capture-reader-{source_id}', daemon=True)
+                for source_id in range(len(self.sources))
+            ]
+        for thread in self._threads:
+            thread.start()
+
+        logger.info(f"Multiplexing {len(self.sources)} capture sources ({self.mode})")
+        return self.mode
+
+    def get(self, timeout: Optional[float] = 1.0) -> Optional[SourceFrame]:
+        """Return the next ready frame from any source.
+
+        Args:
+            timeout: Seconds to wait, None to wait indefinitely
+
+        Returns:
+            SourceFrame, None if no frame arrived in time
+        """
+        try:
+            return self._frames.get(timeout=timeout)
+        except queue.Empty:
+            return None
+
+    def get_stats(self) -> dict:
+        """Get multiplexer counters.
+
+        Returns:
+            dict: mode, frames delivered per source, dropped (queue overflow)
+            and read failures per source
+        """
+        return {
+            'mode': self.mode,
+            'frames': list(self._sequences),
+            'dropped': self._dropped,
+            'read_failures': list(self._read_failures),
+        }
+
+    def close(self) -> None:
+        """Stop the reader threads; the sources are left open for their owner to release."""
+        self._running = False
+        for thread in self._threads:
+            thread.join(timeout=2.0)
+        self._threads = []
+
+    def _deliver(self, source_id: int, timestamp: float, frame: np.ndarray) -> None:
+        """Queue a frame for the consumer, dropping the oldest one when full."""
+        item = SourceFrame(source_id, self._sequences[source_id], timestamp, frame)
+        self._sequences[source_id] += 1
+        while True:
+            try:
+                self._frames.put_nowait(item)
+                return
+            except queue.Full:
+                try:
+                    self._frames.get_nowait()
+                    self._dropped += 1
+                except queue.Empty:
+                    pass
+
+    def _waitany_loop(self, captures: List[cv2.VideoCapture]) -> None:
+        """Grab from whichever cameras are ready and retrieve only those."""
+        apply_thread_role(ROLE_CAPTURE)
+        timeout_ns = max(1, int(self.wait_timeout * 1e9))
+        while self._running:
+            try:
+                ready, indices = cv2.VideoCapture.waitAny(captures, timeout_ns)
+            except cv2.error as e:
+                logger.error(f"waitAny failed, stopping capture multiplexer: {e}")
+                self._running = False
+                return
+            if not ready:
+                continue
+            timestamp = time.perf_counter()
+            for index in np.asarray(indices).ravel():
+                source_id = int(index)
+                ok, frame = captures[source_id].retrieve()
+                if ok and frame is not None:
+                    self._deliver(source_id, timestamp, frame)
+                else:
+                    self._read_failures[source_id] += 1
+
+    def _reader_loop(self, source_id: int) -> None:
+        """Read one source as fast as it delivers frames."""
+        apply_thread_role(ROLE_CAPTURE)
+        source = self.sources[source_id]
+        while self._running:
+            frame = source.get_frame()
+            if frame is None:
+                self._read_failures[source_id] += 1
+                # Avoid spinning on a disconnected source
+                time.sleep(0.01)
+                continue
+            self._deliver(source_id, time.perf_counter(), frame)
+
+    def __enter__(self):
+        """Context manager entry - start multiplexing."""
+        self.start()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - stop multiplexing."""
+        self.close()
@@ -0,0 +1,246 @@
+"""
+Pre-fork pose detector worker pool for the OpenCV Minecraft Controller.
+
+For multi-station setups one machine serves many camera streams. The pool
+forks the worker processes from a parent that has already paid the imports,
+and each worker builds its own detector after the fork. Streams are assigned
+to workers round-robin; each stream owns a shared memory frame slot, so only
+a small request tuple crosses the process boundary per frame and the landmark
+array (33 x 4 float32) comes back.
+
+With share_detector=True the parent builds and warms the detector once and
+the workers inherit it in copy-on-write memory instead of paying the load
+time and memory again. That only works for detectors that start no threads
+at construction: MediaPipe's PoseDetector starts its calculator graph
+threads there, and forked children inherit the graph but not its threads,
+so its inference never returns in a worker.
+
+Forking requires the 'fork' start method (Linux, macOS).
+"""
+
+import logging
+import multiprocessing
+import threading
+import time
+from multiprocessing import shared_memory
+from typing import Callable, List, Optional, Tuple
+
+import numpy as np
+
+from .pose_detector import landmarks_to_array
+from ..utils.performance_report import process_memory_mb
+
+
+logger = logging.getLogger(__name__)
+
+
+def _worker_main(detector, detector_factory: Optional[Callable], requests, result_pipes: dict, frames: dict) -> None:
+    """Serve detection requests for the streams assigned to one worker.
+
+    Runs in a forked child: the detector and the shared memory frame views are
+    inherited from the parent, not pickled.
+    """
+    if detector is None:
+        detector = detector_factory()
+
+    try:
+        while True:
+            request = requests.get()
+            if request is None:
+                break
+            stream_id, sequence, submitted_at = request
+            start = time.perf_counter()
+            try:
+                landmarks = detector.detect_pose(frames[stream_id])
+                array = None if landmarks is None else landmarks_to_array(landmarks)
+                error = None
+            except Exception as e:
+                array, error = None, str(e)
+            inference_ms = (time.perf_counter() - start) * 1000.0
+            result_pipes[stream_id].send((sequence, array, inference_ms, error))
+    except KeyboardInterrupt:
+        pass
+
+
+class DetectorWorkerPool:
+    """Runs pose detection for many frame streams on forked worker processes."""
+
+    def __init__(
+        self,
+        detector_factory: Callable,
+        workers: int = 2,
+        streams: int = 1,
+        frame_shape: Tuple[int, int, int] = (480, 640, 3),
+        share_detector: bool = False
+    ):
+        """Initialize the pool; call start() to load the detector and fork.
+
+        Args:
+            detector_factory: Callable creating a detector with detect_pose(frame)
+            workers: Number of worker processes
+            streams: Number of frame streams (assigned to workers round-robin)
+            frame_shape: Shape of every submitted uint8 frame
+            share_detector: Build the detector in the parent and inherit it through
+                fork (fork-safe detectors only, not MediaPipe); False builds one per
+                worker after the fork
+
+        Raises:
+            ValueError: If workers or streams is not positive
+        """
+        if workers < 1 or streams < 1:
+            raise ValueError("workers and streams must be positive")
+
+        self.detector_factory = detector_factory
+        self.workers = min(workers, streams)
+        self.streams = streams
+        self.frame_shape = tuple(frame_shape)
+        self.share_detector = share_detector
+
+        self._context = multiprocessing.get_context('fork')
+        self._processes: List[multiprocessing.Process] = []
+        self._requests = []
+        self._results = []
+        self._slots: List[shared_memory.SharedMemory] = []
+        self._frames: List[np.ndarray] = []
+        self._sequences = [0] * streams
+        self._stream_locks = [threading.Lock() for _ in range(streams)]
+        self.load_ms = 0.0
+
+    def worker_for_stream(self, stream_id: int) -> int:
+        """Return the worker index serving a stream."""
+        return stream_id % self.workers
+
+    @property
+    def worker_pids(self) -> List[int]:
+        """Return the process IDs of the workers."""
+        return [process.pid for process in self._processes]
+
+    def start(self) -> None:
+        """Load and warm the detector, allocate frame slots and fork the workers."""
+        load_start = time.perf_counter()
+        detector = None
+        if self.share_detector:
+            detector = self.detector_factory()
+            # Run one inference so lazily built state exists before the fork
+            detector.detect_pose(np.zeros(self.frame_shape, dtype=np.uint8))
+        self.load_ms = (time.perf_counter() - load_start) * 1000.0
+
+        frame_bytes = int(np.prod(self.frame_shape))
+        for _ in range(self.streams):
+            slot = shared_memory.SharedMemory(create=True, size=frame_bytes)
+            self._slots.append(slot)
+            self._frames.append(np.ndarray(self.frame_shape, dtype=np.uint8, buffer=slot.buf))
+            self._results.append(self._context.Pipe(duplex=False))
+
+        for worker_index in range(self.workers):
+            requests = self._context.SimpleQueue()
+            assigned = [s for s in range(self.streams) if self.worker_for_stream(s) == worker_index]
+            process = self._context.Process(
+                target=_worker_main,
+                args=(
+                    detector, None if self.share_detector else self.detector_factory, requests,
+                    {s: self._results[s][1] for s in assigned}, {s: self._frames[s] for s in assigned}
+                ),
+                name=f'detector-worker-{worker_index}',
+                daemon=True
+            )
+            process.start()
+            self._requests.append(requests)
+            self._processes.append(process)
+
+        logger.info(
+            f"Detector pool: {self.workers} workers for {self.streams} streams "
+            f"(detector {'shared' if self.share_detector else 'per worker'}, load {self.load_ms:.0f} ms)"
+        )
+
+    def detect(self, stream_id: int, frame: np.ndarray, timeout: float = 5.0) -> Optional[dict]:
+        """Run detection for one frame of a stream and wait for the result.
+
+        Each stream has one frame slot, so calls for the same stream are
+        serialized; different streams run in parallel on their workers.
+
+        Args:
+            stream_id: Stream index
+            frame: uint8 frame of frame_shape
+            timeout: Seconds to wait for the worker
+
+        Returns:
+            dict with sequence, landmarks ((33, 4) array or None), inference_ms and
+            latency_ms; None on timeout or worker error
+
+        Raises:
+            ValueError: If the stream ID or frame shape is invalid
+        """
+        if not 0 <= stream_id < self.streams:
+            raise ValueError(f"stream_id must be between 0 and {self.streams - 1}")
+        if frame.shape != self.frame_shape:
+            raise ValueError(f"frame shape {frame.shape} does not match pool frame shape {self.frame_shape}")
+
+        with self._stream_locks[stream_id]:
+            sequence = self._sequences[stream_id]
+            self._sequences[stream_id] += 1
+            submitted_at = time.perf_counter()
+            np.copyto(self._frames[stream_id], frame)
+            self._requests[self.worker_for_stream(stream_id)].put((stream_id, sequence, submitted_at))
+
+            receiver = self._results[stream_id][0]
+            deadline = submitted_at + timeout
+            while True:
+                remaining = deadline - time.perf_counter()
+                if remaining <= 0 or not receiver.poll(remaining):
+                    logger.error(f"Detector worker for stream {stream_id} did not answer in time")
+                    return None
+                result_sequence, landmarks, inference_ms, error = receiver.recv()
+                # Skip stale answers to requests that timed out earlier
+                if result_sequence == sequence:
+                    break
+
+        if error is not None:
+            logger.error(f"Detector worker failed on stream {stream_id}: {error}")
+            return None
+        return {
+            'sequence': sequence,
+            'landmarks': landmarks,
+            'inference_ms': inference_ms,
+            'latency_ms': (time.perf_counter() - submitted_at) * 1000.0,
+        }
+
+    def worker_memory(self) -> List[dict]:
+        """Return the memory breakdown (rss, pss, shared, private) of each worker."""
+        return [process_memory_mb(pid) for pid in self.worker_pids]
+
+    def close(self, timeout: float = 2.0) -> None:
+        """Stop the workers and free the frame slots."""
+        for requests in self._requests:
+            try:
+                requests.put(None)
+            except (OSError, ValueError):
+                pass
+        for process in self._processes:
+            process.join(timeout)
+            if process.is_alive():
+                process.terminate()
+        self._processes = []
+        self._requests = []
+        for receiver, sender in self._results:
+            receiver.close()
+            sender.close()
+        self._results = []
+
+        self._frames = []
+        for slot in self._slots:
+            slot.close()
+            try:
+                slot.unlink()
+            except FileNotFoundError:
+                pass
+        self._slots = []
+
+    def __enter__(self):
+        """Context manager entry - start the pool."""
+        self.start()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - stop the pool."""
+        self.close()
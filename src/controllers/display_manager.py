@@ -19,13 +19,24 @@ class DisplayManager:
     angle and control state information display.
     """
     
-    def __init__(self, window_name: str = "OpenCV Minecraft Controller"):
+    def __init__(
+        self,
+        window_name: str = "OpenCV Minecraft Controller",
+        show_pose_overlay: bool = True,
+        show_angle_info: bool = True,
+        font_scale: float = 0.7
+    ):
         """Initialize the display manager.
         
         Args:
             window_name: Name of the OpenCV window
+            show_pose_overlay: Draw the arm skeleton overlay
+            show_angle_info: Draw the angle and control state text
+            font_scale: Scale of the angle and state text
         """
         self.window_name = window_name
+        self.show_pose_overlay = show_pose_overlay
+        self.show_angle_info = show_angle_info
         self._window_created = False
         
         # Display colors (BGR format for OpenCV)
@@ -42,7 +53,7 @@ class DisplayManager:
         
         # Text settings
         self.font = cv2.FONT_HERSHEY_SIMPLEX
-        self.font_scale = 0.7
+        self.font_scale = font_scale
         self.font_thickness = 2
         self.text_padding = 10
     
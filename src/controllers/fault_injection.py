@@ -0,0 +1,264 @@
+"""
+Fault and latency injection for the OpenCV Minecraft Controller.
+
+Wrappers around the camera, pose detector and mouse controller add delays,
+failures and frozen frames while a fault window is open. Each wrapper draws
+its faults from a FaultSchedule with a seeded random generator, so a scenario
+injects the same faults on every run. Delays go through the clock's sleep(),
+so they cost no real time with a VirtualClock.
+
+- FaultyCamera wraps a CameraManager and injects into its capture object, so
+  slow, failed and frozen reads pass through CameraManager's own read
+  deadline and frozen-frame detection. The read deadline waits in real time,
+  so it only fires when the schedule uses the SystemClock.
+- FaultyPoseDetector delays detect_pose() (a processing spike) or raises from it.
+- FaultyMouseController delays set_state(), as a blocking injection backend
+  would, or raises MouseControlError.
+
+Unwrapped attributes are forwarded to the wrapped component, so the wrappers
+can be assigned to an ApplicationController in place of the real ones.
+"""
+
+import logging
+from dataclasses import dataclass
+from typing import NamedTuple, Optional
+
+import numpy as np
+
+from .mouse_controller import MouseControlError
+from ..models.enums import ControlState
+from ..utils.clock import SystemClock
+
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass
+class FaultSpec:
+    """Faults to inject; probabilities apply to each call while the window is open."""
+    delay_s: float = 0.0
+    delay_probability: float = 1.0
+    failure_probability: float = 0.0
+    freeze_probability: float = 0.0
+    freeze_s: float = 1.0
+    start_s: float = 0.0
+    end_s: Optional[float] = None
+
+    def __post_init__(self):
+        """Validate probabilities, durations and the fault window."""
+        for name in ('delay_probability', 'failure_probability', 'freeze_probability'):
+            if not 0.0 <= getattr(self, name) <= 1.0:
+                raise ValueError(f"{name} must be between 0 and 1")
+        if self.delay_s < 0 or self.freeze_s < 0:
+            raise ValueError("delay_s and freeze_s must not be negative")
+        if self.end_s is not None and self.end_s < self.start_s:
+            raise ValueError("end_s must not be before start_s")
+
+
+class Fault(NamedTuple):
+    """Faults drawn for one call."""
+    delay_s: float
+    fail: bool
+    freeze: bool
+
+
+NO_FAULT = Fault(0.0, False, False)
+
+
+class FaultSchedule:
+    """Draws faults for successive calls from a seeded generator."""
+
+    def __init__(self, spec: FaultSpec, seed: int = 0, clock=None):
+        """Initialize the schedule; the fault window is timed from now.
+
+        Args:
+            spec: Faults to inject
+            seed: Random seed; equal seeds inject equal faults
+            clock: Clock timing the fault window and the injected delays
+                (default: SystemClock)
+        """
+        self.spec = spec
+        self.seed = seed
+        self.clock = clock or SystemClock()
+        self._rng = np.random.default_rng(seed)
+        self._origin = self.clock.now()
+        self.calls = 0
+        self.delays = 0
+        self.failures = 0
+        self.freezes = 0
+
+    def elapsed(self) -> float:
+        """Return seconds since the schedule was created."""
+        return self.clock.now() - self._origin
+
+    def is_active(self) -> bool:
+        """Check whether the fault window is open."""
+        elapsed = self.elapsed()
+        return elapsed >= self.spec.start_s and (self.spec.end_s is None or elapsed < self.spec.end_s)
+
+    def next_fault(self) -> Fault:
+        """Draw the faults for the next call.
+
+        Returns:
+            Fault to apply, NO_FAULT outside the fault window
+        """
+        self.calls += 1
+        # Draw every call, inside the window or not, so the faults depend only on the seed
+        delay_draw, failure_draw, freeze_draw = self._rng.random(3)
+        if not self.is_active():
+            return NO_FAULT
+
+        spec = self.spec
+        fault = Fault(
+            spec.delay_s if spec.delay_s > 0 and delay_draw < spec.delay_probability else 0.0,
+            failure_draw < spec.failure_probability,
+            freeze_draw < spec.freeze_probability
+        )
+        self.delays += fault.delay_s > 0
+        self.failures += fault.fail
+        self.freezes += fault.freeze
+        return fault
+
+    def get_stats(self) -> dict:
+        """Get the number of calls and of each injected fault."""
+        return {'calls': self.calls, 'delays': self.delays, 'failures': self.failures, 'freezes': self.freezes}
+
+
+class _FaultyCapture:
+    """cv2.VideoCapture stand-in that applies a FaultyCamera's faults to read()."""
+
+    def __init__(self, owner: 'FaultyCamera', cap):
+        self._owner = owner
+        self.cap = cap
+
+    def read(self, *args):
+        """Read a frame, then delay, drop or replace it with the frozen frame."""
+        fault = self._owner.schedule.next_fault()
+        # The real read still happens so the camera keeps its own pace while faulted
+        ok, frame = self.cap.read(*args)
+        return self._owner._apply(fault, ok, frame)
+
+    def __getattr__(self, name):
+        return getattr(self.cap, name)
+
+
+class FaultyCamera:
+    """CameraManager wrapper injecting slow, failed and frozen reads."""
+
+    def __init__(self, camera, schedule: FaultSchedule):
+        """Wrap a camera; its capture is wrapped whenever it is (re)opened.
+
+        Args:
+            camera: CameraManager (anything keeping its capture in a cap attribute)
+            schedule: Fault schedule; delay_s slows each read, failures make the
+                read fail and a freeze repeats the last frame for freeze_s
+        """
+        self.camera = camera
+        self.schedule = schedule
+        self._frozen_frame: Optional[np.ndarray] = None
+        self._frozen_until = 0.0
+        self._last_frame: Optional[np.ndarray] = None
+        if getattr(camera, 'cap', None) is not None:
+            self._wrap_capture()
+
+    def start_capture(self) -> bool:
+        """Start the wrapped camera and wrap its capture."""
+        started = self.camera.start_capture()
+        if started:
+            self._wrap_capture()
+        return started
+
+    def reconnect(self) -> bool:
+        """Reconnect the wrapped camera; an ongoing freeze outlives the reconnection."""
+        reconnected = self.camera.reconnect()
+        if reconnected:
+            self._wrap_capture()
+        return reconnected
+
+    def is_frozen_by_fault(self) -> bool:
+        """Check whether an injected freeze is in progress."""
+        return self._frozen_frame is not None and self.schedule.clock.now() < self._frozen_until
+
+    def _wrap_capture(self) -> None:
+        """Put the fault-injecting capture in front of the camera's capture."""
+        if not isinstance(self.camera.cap, _FaultyCapture):
+            self.camera.cap = _FaultyCapture(self, self.camera.cap)
+
+    def _apply(self, fault: Fault, ok: bool, frame):
+        """Return the (ok, frame) read result after applying a fault."""
+        clock = self.schedule.clock
+        clock.sleep(fault.delay_s)
+        if fault.freeze and self._last_frame is not None and not self.is_frozen_by_fault():
+            self._frozen_frame = self._last_frame
+            self._frozen_until = clock.now() + self.schedule.spec.freeze_s
+        if self.is_frozen_by_fault():
+            return True, self._frozen_frame.copy()
+        self._frozen_frame = None
+        if fault.fail:
+            return False, None
+        if ok:
+            self._last_frame = frame
+        return ok, frame
+
+    def __getattr__(self, name):
+        return getattr(self.camera, name)
+
+
+class FaultyPoseDetector:
+    """PoseDetector wrapper injecting processing spikes and inference failures."""
+
+    def __init__(self, detector, schedule: FaultSchedule):
+        """Wrap a detector.
+
+        Args:
+            detector: Object with detect_pose(frame)
+            schedule: Fault schedule; delay_s is added to detect_pose() and
+                failures raise RuntimeError from it
+        """
+        self.detector = detector
+        self.schedule = schedule
+
+    def detect_pose(self, frame):
+        """Detect the pose after applying the scheduled fault.
+
+        Raises:
+            RuntimeError: When a failure is injected
+        """
+        fault = self.schedule.next_fault()
+        self.schedule.clock.sleep(fault.delay_s)
+        if fault.fail:
+            raise RuntimeError("injected pose detector failure")
+        return self.detector.detect_pose(frame)
+
+    def __getattr__(self, name):
+        return getattr(self.detector, name)
+
+
+class FaultyMouseController:
+    """MouseController wrapper injecting blocking and failing button changes."""
+
+    def __init__(self, mouse, schedule: FaultSchedule):
+        """Wrap a mouse controller.
+
+        Args:
+            mouse: Object with set_state(state)
+            schedule: Fault schedule; delay_s blocks set_state() and failures
+                raise MouseControlError before the state changes
+        """
+        self.mouse = mouse
+        self.schedule = schedule
+
+    def set_state(self, state: ControlState) -> None:
+        """Change the button state after applying the scheduled fault.
+
+        Raises:
+            MouseControlError: When a failure is injected
+        """
+        fault = self.schedule.next_fault()
+        self.schedule.clock.sleep(fault.delay_s)
+        if fault.fail:
+            raise MouseControlError(f"injected failure setting mouse state to {state}")
+        self.mouse.set_state(state)
+
+    def __getattr__(self, name):
+        return getattr(self.mouse, name)
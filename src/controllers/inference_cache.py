@@ -0,0 +1,265 @@
+"""
+Content-addressed cache of pose inference results.
+
+Replays and parameter sweeps run the same recorded clips through MediaPipe
+again and again. This module stores detect_pose() results on disk, keyed by a
+fast hash of the frame contents, in one directory per model configuration, so
+runs that only change downstream decision logic skip inference entirely.
+
+Results are stored as fixed-size landmark records (models.landmark_record) and
+memory-mapped on open. Because MediaPipe tracks across frames, a cached result
+reproduces what inference returned when the clip was replayed in the same order.
+"""
+
+import hashlib
+import json
+import logging
+import os
+import zlib
+from typing import Callable, Dict, List, Optional, Tuple
+
+import numpy as np
+
+from .pose_detector import PoseDetector, PoseLandmarks, landmarks_from_array, landmarks_to_array
+from ..models.landmark_record import (
+    LANDMARK_RECORD_DTYPE, RECORD_VERSION, LandmarkRecordWriter, create_records,
+    open_record_file, pack_record, record_landmarks
+)
+
+
+logger = logging.getLogger(__name__)
+
+
+RECORDS_FILE = 'results.klmr'
+KEYS_FILE = 'keys.u64'
+CONFIG_FILE = 'config.json'
+KEY_DTYPE = np.dtype('<u8')
+
+
+def frame_hash(frame: np.ndarray) -> int:
+    """Compute a fast 64-bit content hash of a frame.
+
+    Combines CRC-32 and Adler-32 over the raw pixels, seeded with the frame shape
+    and dtype, which runs several times faster than a cryptographic hash.
+
+    Args:
+        frame: Image array
+
+    Returns:
+        int: Unsigned 64-bit hash
+    """
+    data = memoryview(np.ascontiguousarray(frame)).cast('B')
+    seed = zlib.crc32(f"{frame.shape}{frame.dtype.str}".encode())
+    return (zlib.crc32(data, seed) << 32) | zlib.adler32(data)
+
+
+def model_cache_key(backend: str, model_complexity: int, confidence_threshold: float) -> str:
+    """Describe the detector configuration that determines its results.
+
+    Args:
+        backend: Pose backend name, e.g. 'mediapipe'
+        model_complexity: Model complexity (0=Lite, 1=Full, 2=Heavy)
+        confidence_threshold: Detection and tracking confidence
+
+    Returns:
+        str: Stable configuration key
+    """
+    return (
+        f"{backend}|model_complexity={model_complexity}"
+        f"|confidence={confidence_threshold}|record_version={RECORD_VERSION}"
+    )
+
+
+class InferenceCache:
+    """On-disk map from frame hash to landmark record for one model configuration."""
+
+    def __init__(self, cache_dir: str, model_key: str):
+        """Open or create the cache directory for a model configuration.
+
+        Args:
+            cache_dir: Root directory holding one subdirectory per configuration
+            model_key: Configuration key, e.g. from model_cache_key()
+        """
+        digest = hashlib.blake2b(model_key.encode(), digest_size=8).hexdigest()
+        self.model_key = model_key
+        self.directory = os.path.join(cache_dir, digest)
+        os.makedirs(self.directory, exist_ok=True)
+
+        config_path = os.path.join(self.directory, CONFIG_FILE)
+        if not os.path.exists(config_path):
+            with open(config_path, 'w', encoding='utf-8') as config_file:
+                json.dump({'model_key': model_key}, config_file)
+
+        records_path = os.path.join(self.directory, RECORDS_FILE)
+        keys_path = os.path.join(self.directory, KEYS_FILE)
+        self._records, keys = self._load(records_path, keys_path)
+
+        self._index: Dict[int, int] = {int(key): position for position, key in enumerate(keys)}
+        self._new_records: List[np.ndarray] = []
+        self._record_writer = LandmarkRecordWriter(records_path)
+        self._keys_file = open(keys_path, 'ab')
+        self._hits = 0
+        self._misses = 0
+
+    def __len__(self) -> int:
+        """Return the number of cached results."""
+        return len(self._index)
+
+    def lookup(self, key: int) -> Tuple[bool, Optional[np.ndarray]]:
+        """Look up a cached result.
+
+        Args:
+            key: Frame hash from frame_hash()
+
+        Returns:
+            Tuple of (found, (K, 4) landmark array or None when no pose was detected)
+        """
+        position = self._index.get(key)
+        if position is None:
+            self._misses += 1
+            return False, None
+
+        self._hits += 1
+        if position < len(self._records):
+            record = self._records[position]
+        else:
+            record = self._new_records[position - len(self._records)][0]
+        poses = record_landmarks(record)
+        return True, None if poses is None else poses[0]
+
+    def store(self, key: int, landmarks: Optional[np.ndarray]) -> None:
+        """Add a result to the cache.
+
+        Args:
+            key: Frame hash from frame_hash()
+            landmarks: (K, 4) landmark array, or None if no pose was detected
+        """
+        if key in self._index:
+            return
+
+        record = create_records(1)
+        pack_record(record[0], len(self._index), 0.0, landmarks)
+        self._record_writer.write(record)
+        self._keys_file.write(np.array([key], dtype=KEY_DTYPE).tobytes())
+        self._index[key] = len(self._records) + len(self._new_records)
+        self._new_records.append(record)
+
+    def get_stats(self) -> dict:
+        """Get hit and miss statistics for this session.
+
+        Returns:
+            dict: hits, misses, hit_rate and number of entries
+        """
+        lookups = self._hits + self._misses
+        return {
+            'hits': self._hits,
+            'misses': self._misses,
+            'hit_rate': self._hits / lookups if lookups else 0.0,
+            'entries': len(self._index),
+        }
+
+    def flush(self) -> None:
+        """Flush new entries to disk."""
+        self._record_writer.flush()
+        self._keys_file.flush()
+
+    def close(self) -> None:
+        """Flush and close the cache files."""
+        self._record_writer.close()
+        if not self._keys_file.closed:
+            self._keys_file.close()
+
+    def _load(self, records_path: str, keys_path: str):
+        """Memory-map existing entries, dropping any partially written tail."""
+        if not os.path.exists(records_path) or not os.path.exists(keys_path):
+            for path in (records_path, keys_path):
+                open(path, 'wb').close()
+            return np.zeros(0, dtype=LANDMARK_RECORD_DTYPE), np.zeros(0, dtype=KEY_DTYPE)
+
+        record_count = os.path.getsize(records_path) // LANDMARK_RECORD_DTYPE.itemsize
+        key_count = os.path.getsize(keys_path) // KEY_DTYPE.itemsize
+        count = min(record_count, key_count)
+        if record_count != key_count or os.path.getsize(records_path) % LANDMARK_RECORD_DTYPE.itemsize:
+            logger.warning(f"Inference cache {self.directory} was not closed cleanly, keeping {count} entries")
+            os.truncate(records_path, count * LANDMARK_RECORD_DTYPE.itemsize)
+            os.truncate(keys_path, count * KEY_DTYPE.itemsize)
+
+        keys = np.fromfile(keys_path, dtype=KEY_DTYPE, count=count)
+        return open_record_file(records_path), keys
+
+    def __enter__(self):
+        """Context manager entry."""
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - close the cache files."""
+        self.close()
+
+
+class CachedPoseDetector(PoseDetector):
+    """PoseDetector that answers repeated frames from an InferenceCache.
+
+    The real detector is only created on the first cache miss, so a fully
+    cached replay never loads the model. Misses store their result, including
+    frames where no pose was found.
+    """
+
+    def __init__(
+        self,
+        cache: InferenceCache,
+        detector_factory: Callable[[], PoseDetector],
+        confidence_threshold: float = 0.5
+    ):
+        """Initialize the cached detector without loading a model.
+
+        Args:
+            cache: Cache opened for the factory's model configuration
+            detector_factory: Callable creating the detector used on misses
+            confidence_threshold: Minimum landmark visibility for arm keypoints
+
+        Raises:
+            ValueError: If confidence_threshold is not between 0.0 and 1.0
+        """
+        if not 0.0 <= confidence_threshold <= 1.0:
+            raise ValueError("confidence_threshold must be between 0.0 and 1.0")
+
+        self.cache = cache
+        self.confidence_threshold = confidence_threshold
+        self._detector_factory = detector_factory
+        self._detector: Optional[PoseDetector] = None
+        self._last_detection_successful = False
+
+    @property
+    def detector(self) -> Optional[PoseDetector]:
+        """Return the wrapped detector, None if no miss has required it yet."""
+        return self._detector
+
+    def detect_pose(self, frame: np.ndarray) -> Optional[PoseLandmarks]:
+        """Return the cached result for the frame, running inference on a miss.
+
+        Args:
+            frame: Input video frame (BGR format)
+
+        Returns:
+            PoseLandmarks if a pose was detected, None otherwise
+
+        Raises:
+            ValueError: If frame is not a valid numpy array
+        """
+        if not isinstance(frame, np.ndarray):
+            raise ValueError("frame must be a numpy array")
+        if len(frame.shape) != 3 or frame.shape[2] != 3:
+            raise ValueError("frame must be a 3-channel BGR image")
+
+        key = frame_hash(frame)
+        found, landmarks = self.cache.lookup(key)
+        if found:
+            self._last_detection_successful = landmarks is not None
+            return None if landmarks is None else landmarks_from_array(landmarks)
+
+        if self._detector is None:
+            self._detector = self._detector_factory()
+        pose_landmarks = self._detector.detect_pose(frame)
+        self.cache.store(key, None if pose_landmarks is None else landmarks_to_array(pose_landmarks))
+        self._last_detection_successful = pose_landmarks is not None
+        return pose_landmarks
@@ -0,0 +1,306 @@
+"""
+Landmark and control state publisher for the OpenCV Minecraft Controller.
+
+Other local tools (stream overlays, analytics, game integrations) can consume
+each processed frame without embedding Python. Every frame is sent as one
+datagram holding exactly one fixed-size landmark record (see
+models.landmark_record: 40-byte little-endian header followed by float32
+landmarks), either to a UDP address, typically a multicast group kept on the
+loopback interface, or to a Unix datagram socket.
+
+Publishing is fire-and-forget: the frame loop packs the record and hands it to
+a bounded queue, and a dedicated thread sends it on a non-blocking socket. A
+full queue drops the oldest record, and a missing or slow subscriber only
+costs a counted send error, so subscribers can never stall the frame loop.
+"""
+
+import ipaddress
+import logging
+import os
+import queue
+import socket
+import stat
+import struct
+import threading
+from typing import Optional, Tuple, Union
+
+import numpy as np
+
+from ..models.enums import ControlState
+from ..models.landmark_record import LANDMARK_RECORD_DTYPE, create_records, decode_records, pack_record
+from ..utils.thread_priority import ROLE_BACKGROUND, apply_thread_role
+
+
+logger = logging.getLogger(__name__)
+
+
+DEFAULT_MULTICAST_GROUP = '239.255.77.77'
+DEFAULT_PORT = 5577
+LOOPBACK_INTERFACE = '127.0.0.1'
+
+
+def parse_destination(destination: str) -> Tuple[int, Union[str, Tuple[str, int]]]:
+    """Parse a publish destination.
+
+    Accepted forms are 'udp://HOST:PORT' (a multicast group or unicast address)
+    and 'unix://PATH' (a Unix datagram socket path).
+
+    Args:
+        destination: Destination string
+
+    Returns:
+        (address family, socket address)
+
+    Raises:
+        ValueError: If the destination is malformed
+    """
+    if destination.startswith('unix://'):
+        path = destination[len('unix://'):]
+        if not path:
+            raise ValueError("unix destination needs a socket path")
+        return socket.AF_UNIX, path
+
+    if destination.startswith('udp://'):
+        host, separator, port = destination[len('udp://'):].rpartition(':')
+        if not separator or not host:
+            raise ValueError(f"udp destination must be udp://HOST:PORT, got '{destination}'")
+        try:
+            port_number = int(port)
+        except ValueError:
+            raise ValueError(f"invalid port in '{destination}'") from None
+        if not 0 < port_number < 65536:
+            raise ValueError(f"port out of range in '{destination}'")
+        return socket.AF_INET, (host, port_number)
+
+    raise ValueError(f"destination must start with udp:// or unix://, got '{destination}'")
+
+
+def _is_multicast(host: str) -> bool:
+    """Check whether a host is an IPv4 multicast address."""
+    try:
+        return ipaddress.IPv4Address(host).is_multicast
+    except ValueError:
+        return False
+
+
+class LandmarkPublisher:
+    """Sends one landmark record per frame to subscribers from a background thread."""
+
+    def __init__(self, destination: str, queue_size: int = 8, source_id: int = 0):
+        """Initialize the publisher.
+
+        Args:
+            destination: 'udp://HOST:PORT' or 'unix://PATH' (see parse_destination)
+            queue_size: Records buffered for the sender thread before the oldest is dropped
+            source_id: Camera or stream identifier written into every record
+
+        Raises:
+            ValueError: If the destination is malformed or queue_size is not positive
+        """
+        if queue_size < 1:
+            raise ValueError("queue_size must be positive")
+
+        self.destination = destination
+        self.family, self.address = parse_destination(destination)
+        self.source_id = source_id
+
+        self._record = create_records(1)
+        self._pending: queue.Queue = queue.Queue(maxsize=queue_size)
+        self._socket: Optional[socket.socket] = None
+        self._thread: Optional[threading.Thread] = None
+        self._running = False
+
+        self._published = 0
+        self._sent = 0
+        self._dropped = 0
+        self._send_errors = 0
+
+    def start(self) -> bool:
+        """Open the socket and start the sender thread.
+
+        Returns:
+            bool: True if the publisher is running, False if the socket could not be opened
+        """
+        try:
+            sock = socket.socket(self.family, socket.SOCK_DGRAM)
+            if self.family == socket.AF_INET and _is_multicast(self.address[0]):
+                # TTL 0 keeps datagrams on this host; loop them back to local subscribers
+                sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 0)
+                sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+                sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(LOOPBACK_INTERFACE))
+            sock.setblocking(False)
+        except OSError as e:
+            logger.error(f"Failed to open publisher socket for {self.destination}: {e}")
+            return False
+
+        self._socket = sock
+        self._running = True
+        self._thread = threading.Thread(target=self._send_loop, name='landmark-publisher', daemon=True)
+        self._thread.start()
+        logger.info(f"Publishing landmark records ({LANDMARK_RECORD_DTYPE.itemsize} bytes) to {self.destination}")
+        return True
+
+    def publish(
+        self,
+        sequence: int,
+        timestamp: float,
+        landmarks: Optional[np.ndarray] = None,
+        angle: Optional[float] = None,
+        control_state: Optional[ControlState] = None
+    ) -> None:
+        """Queue one frame's record for sending; never blocks.
+
+        Args:
+            sequence: Frame sequence number
+            timestamp: Frame timestamp in seconds (wall clock)
+            landmarks: (33, 4) landmark array, None if no pose was detected
+            angle: Elbow angle in degrees, None if not measured
+            control_state: Control state decided for the frame
+        """
+        if not self._running:
+            return
+
+        pack_record(self._record[0], sequence, timestamp, landmarks, self.source_id, angle, control_state)
+        payload = self._record.tobytes()
+        self._published += 1
+
+        while True:
+            try:
+                self._pending.put_nowait(payload)
+                return
+            except queue.Full:
+                try:
+                    self._pending.get_nowait()
+                    self._dropped += 1
+                except queue.Empty:
+                    pass
+
+    def get_stats(self) -> dict:
+        """Get publisher counters.
+
+        Returns:
+            dict: published, sent, dropped (queue overflow) and send_errors counts
+        """
+        return {
+            'destination': self.destination,
+            'published': self._published,
+            'sent': self._sent,
+            'dropped': self._dropped,
+            'send_errors': self._send_errors,
+        }
+
+    def close(self) -> None:
+        """Stop the sender thread and close the socket."""
+        self._running = False
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        if self._socket is not None:
+            self._socket.close()
+            self._socket = None
+
+    def _send_loop(self) -> None:
+        """Send queued records; failures are counted and never retried."""
+        apply_thread_role(ROLE_BACKGROUND)
+        while self._running:
+            try:
+                payload = self._pending.get(timeout=0.2)
+            except queue.Empty:
+                continue
+            try:
+                self._socket.sendto(payload, self.address)
+                self._sent += 1
+            except OSError as e:
+                # No subscriber bound (Unix), full socket buffer or unreachable network
+                self._send_errors += 1
+                if self._send_errors == 1:
+                    logger.debug(f"Publisher send to {self.destination} failed: {e}")
+
+    def __enter__(self):
+        """Context manager entry - start publishing."""
+        self.start()
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - stop publishing."""
+        self.close()
+
+
+class LandmarkSubscriber:
+    """Receives landmark records sent by a LandmarkPublisher.
+
+    Reference consumer for tools written in Python; other languages only need
+    to bind the same address and read the record layout from the datagrams.
+    """
+
+    def __init__(self, destination: str, timeout: float = 1.0):
+        """Bind the subscriber socket.
+
+        Args:
+            destination: Same destination string as the publisher
+            timeout: Seconds receive() waits for a record
+
+        Raises:
+            ValueError: If the destination is malformed
+            OSError: If the socket cannot be bound, or a unix:// path exists and
+                is not a socket
+        """
+        self.family, self.address = parse_destination(destination)
+
+        if self.family == socket.AF_UNIX:
+            try:
+                mode = os.lstat(self.address).st_mode
+            except FileNotFoundError:
+                mode = None
+            if mode is not None:
+                # Replace a socket left by an earlier subscriber, never another file
+                if not stat.S_ISSOCK(mode):
+                    raise OSError(f"{self.address} exists and is not a socket")
+                os.unlink(self.address)
+
+        self._socket = socket.socket(self.family, socket.SOCK_DGRAM)
+        if self.family == socket.AF_UNIX:
+            self._socket.bind(self.address)
+        else:
+            host, port = self.address
+            self._socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+            if _is_multicast(host):
+                self._socket.bind(('', port))
+                membership = struct.pack('4s4s', socket.inet_aton(host), socket.inet_aton(LOOPBACK_INTERFACE))
+                self._socket.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+            else:
+                self._socket.bind((host, port))
+        self._socket.settimeout(timeout)
+
+    def receive(self) -> Optional[np.ndarray]:
+        """Wait for the next record.
+
+        Returns:
+            One landmark record, None on timeout or if the datagram is not a valid record
+        """
+        try:
+            data = self._socket.recv(LANDMARK_RECORD_DTYPE.itemsize * 2)
+        except socket.timeout:
+            return None
+        try:
+            return decode_records(data)[0]
+        except (ValueError, IndexError) as e:
+            logger.debug(f"Ignoring invalid landmark datagram: {e}")
+            return None
+
+    def close(self) -> None:
+        """Close the socket and remove a Unix socket path."""
+        self._socket.close()
+        if self.family == socket.AF_UNIX:
+            try:
+                os.unlink(self.address)
+            except OSError:
+                pass
+
+    def __enter__(self):
+        """Context manager entry."""
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - close the socket."""
+        self.close()
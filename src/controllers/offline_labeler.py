@@ -0,0 +1,285 @@
+"""
+Parallel offline labeling of recorded video for the OpenCV Minecraft Controller.
+
+Hours of recorded gameplay are labeled in batch to tune the controllers: the
+video is split into chunks of consecutive frames and each chunk is labeled
+in its own worker process, which opens the video, seeks to the chunk and runs
+its own PoseDetector in tracking (video) mode. Because the detector tracks
+across frames, each chunk starts warmup_frames early and discards those
+results, so its first labeled frame is tracked like any other. The angle
+calculator's hysteresis is warmed up the same way.
+
+Every frame gets one landmark record (models.landmark_record) holding the
+frame index as sequence, its media timestamp, the landmarks, the elbow angle
+and the control state the live controller would decide. Workers write their
+chunk to a part file and the parts are concatenated in order, so the output
+is one record file that open_record_file() maps with one column per field
+(timestamp, angle, control_state, landmarks).
+
+Workers are forked (Linux, macOS); the detector factory runs in each worker.
+"""
+
+import functools
+import logging
+import multiprocessing
+import os
+import shutil
+import time
+from typing import Callable, List, NamedTuple, Optional
+
+import cv2
+
+from .pose_detector import PoseDetector, landmarks_to_array
+from ..models.enums import ControlState
+from ..models.landmark_record import LandmarkRecordWriter, create_records, pack_record
+from ..utils.angle_calculator import AngleCalculator
+from ..utils.config_manager import AngleConfig
+
+
+logger = logging.getLogger(__name__)
+
+
+WRITE_BATCH = 256
+
+
+class LabelChunk(NamedTuple):
+    """Frames [start, end) of a video, decoded from warmup_start for tracker warm-up."""
+    index: int
+    start: int
+    end: int
+    warmup_start: int
+
+
+def plan_chunks(frame_count: int, chunks: int, warmup_frames: int) -> List[LabelChunk]:
+    """Split a video into contiguous chunks of nearly equal length.
+
+    Args:
+        frame_count: Number of frames in the video
+        chunks: Number of chunks (fewer if there are fewer frames)
+        warmup_frames: Frames decoded before each chunk start and discarded
+
+    Returns:
+        Chunks covering every frame once, in order
+
+    Raises:
+        ValueError: If chunks is not positive or warmup_frames is negative
+    """
+    if chunks < 1:
+        raise ValueError("chunks must be positive")
+    if warmup_frames < 0:
+        raise ValueError("warmup_frames must not be negative")
+
+    chunks = max(1, min(chunks, frame_count))
+    bounds = [frame_count * index // chunks for index in range(chunks + 1)]
+    return [
+        LabelChunk(index, bounds[index], bounds[index + 1], max(0, bounds[index] - warmup_frames))
+        for index in range(chunks)
+        if bounds[index + 1] > bounds[index]
+    ]
+
+
+def label_frame(detector, calculator: AngleCalculator, frame):
+    """Run the controller's per-frame decision on one frame.
+
+    Returns:
+        Tuple of ((33, 4) landmarks or None, angle or None, control state)
+    """
+    landmarks = detector.detect_pose(frame)
+    if not landmarks:
+        return None, None, ControlState.NEUTRAL
+
+    array = landmarks_to_array(landmarks)
+    keypoints = detector.get_arm_keypoints(landmarks)
+    if keypoints is None:
+        return array, None, ControlState.NEUTRAL
+    try:
+        angle = calculator.calculate_elbow_angle(keypoints.shoulder, keypoints.elbow, keypoints.wrist)
+    except ValueError:
+        return array, None, ControlState.NEUTRAL
+    if not calculator.is_angle_valid(angle):
+        return array, None, ControlState.NEUTRAL
+    return array, angle, calculator.get_control_state(angle)
+
+
+def seek_frame(capture, frame_index: int) -> int:
+    """Position a capture at or before a frame, never past it.
+
+    Setting CAP_PROP_POS_FRAMES is not frame-accurate for every codec and
+    backend: some land on the nearest keyframe instead. The position is read
+    back so the caller knows where decoding actually resumes and can grab()
+    forward; if it is past the frame or unknown, the capture rewinds to the
+    start.
+
+    Returns:
+        Index of the frame the next capture.read() returns
+    """
+    if frame_index <= 0:
+        return 0
+    if capture.set(cv2.CAP_PROP_POS_FRAMES, frame_index):
+        position = int(capture.get(cv2.CAP_PROP_POS_FRAMES))
+        if 0 <= position <= frame_index:
+            return position
+    logger.debug(f"Seek to frame {frame_index} overshot, decoding from the start")
+    capture.set(cv2.CAP_PROP_POS_FRAMES, 0)
+    return 0
+
+
+def _label_chunk(video_path: str, part_path: str, detector_factory: Callable,
+                 angle_config: AngleConfig, chunk: LabelChunk) -> dict:
+    """Label one chunk into a part file; runs in a worker process."""
+    start_time = time.perf_counter()
+    detector = detector_factory()
+    calculator = AngleCalculator(
+        right_click_threshold=angle_config.right_click_threshold,
+        left_click_threshold=angle_config.left_click_threshold,
+        hysteresis_margin=angle_config.hysteresis_margin
+    )
+    capture = cv2.VideoCapture(video_path)
+    try:
+        if not capture.isOpened():
+            raise RuntimeError(f"cannot open {video_path}")
+        fps = capture.get(cv2.CAP_PROP_FPS) or 30.0
+        # A seek may land early; decode up to warmup_start without detection
+        skipped = 0
+        for _ in range(seek_frame(capture, chunk.warmup_start), chunk.warmup_start):
+            if not capture.grab():
+                raise RuntimeError(f"video ended before frame {chunk.warmup_start}")
+            skipped += 1
+
+        records = create_records(WRITE_BATCH)
+        labeled = poses = 0
+        if os.path.exists(part_path):
+            os.remove(part_path)
+        with LandmarkRecordWriter(part_path) as writer:
+            # Frames before the chunk start only warm up the tracker
+            for frame_index in range(chunk.warmup_start, chunk.end):
+                ok, frame = capture.read()
+                if not ok:
+                    logger.warning(f"Video ended at frame {frame_index}, expected {chunk.end}")
+                    break
+                landmarks, angle, state = label_frame(detector, calculator, frame)
+                if frame_index < chunk.start:
+                    continue
+                pack_record(records[labeled % WRITE_BATCH], frame_index, frame_index / fps,
+                            landmarks, angle=angle, control_state=state)
+                labeled += 1
+                poses += landmarks is not None
+                if labeled % WRITE_BATCH == 0:
+                    writer.write(records)
+            if labeled % WRITE_BATCH:
+                writer.write(records[:labeled % WRITE_BATCH])
+    finally:
+        capture.release()
+
+    return {
+        'index': chunk.index,
+        'frames': labeled,
+        'poses': poses,
+        'warmup_frames': chunk.start - chunk.warmup_start,
+        'skipped_frames': skipped,
+        'seconds': time.perf_counter() - start_time,
+    }
+
+
+class OfflineLabeler:
+    """Labels a video file into a landmark record file with parallel worker processes."""
+
+    def __init__(
+        self,
+        video_path: str,
+        output_path: str,
+        workers: int = 0,
+        chunks: Optional[int] = None,
+        warmup_frames: int = 30,
+        detector_factory: Optional[Callable] = None,
+        angle_config: Optional[AngleConfig] = None
+    ):
+        """Initialize the labeler.
+
+        Args:
+            video_path: Video file to label
+            output_path: Landmark record file to write
+            workers: Worker processes, 0 for one per CPU core
+            chunks: Chunks to split the video into (default: one per worker)
+            warmup_frames: Frames tracked before each chunk and discarded
+            detector_factory: Picklable callable creating the detector in each worker
+                (default: PoseDetector with default settings)
+            angle_config: Thresholds for the angle and control state labels
+
+        Raises:
+            ValueError: If workers, chunks or warmup_frames is out of range
+        """
+        if workers < 0:
+            raise ValueError("workers must not be negative")
+        if chunks is not None and chunks < 1:
+            raise ValueError("chunks must be positive")
+        if warmup_frames < 0:
+            raise ValueError("warmup_frames must not be negative")
+
+        self.video_path = video_path
+        self.output_path = output_path
+        self.workers = workers or os.cpu_count() or 1
+        self.chunks = chunks or self.workers
+        self.warmup_frames = warmup_frames
+        self.detector_factory = detector_factory or PoseDetector
+        self.angle_config = angle_config or AngleConfig()
+
+    def run(self) -> Optional[dict]:
+        """Label the whole video.
+
+        Returns:
+            dict with frames, poses, chunks, workers, seconds, fps (labeled frames
+            per second of wall time) and per-chunk results; None if the video
+            cannot be read or a worker failed
+        """
+        capture = cv2.VideoCapture(self.video_path)
+        frame_count = int(capture.get(cv2.CAP_PROP_FRAME_COUNT)) if capture.isOpened() else 0
+        capture.release()
+        if frame_count <= 0:
+            logger.error(f"Cannot read frame count of {self.video_path}")
+            return None
+
+        plan = plan_chunks(frame_count, self.chunks, self.warmup_frames)
+        part_paths = [f"{self.output_path}.part{chunk.index:04d}" for chunk in plan]
+        workers = min(self.workers, len(plan))
+        logger.info(f"Labeling {frame_count} frames of {self.video_path} in {len(plan)} chunks on {workers} workers")
+
+        start_time = time.perf_counter()
+        try:
+            jobs = [
+                functools.partial(_label_chunk, self.video_path, part_path, self.detector_factory, self.angle_config)
+                for part_path in part_paths
+            ]
+            if workers == 1:
+                results = [job(chunk) for job, chunk in zip(jobs, plan)]
+            else:
+                with multiprocessing.get_context('fork').Pool(workers) as pool:
+                    pending = [pool.apply_async(job, (chunk,)) for job, chunk in zip(jobs, plan)]
+                    results = [result.get() for result in pending]
+            self._concatenate(part_paths)
+        except Exception as e:
+            logger.error(f"Labeling {self.video_path} failed: {e}")
+            return None
+        finally:
+            for part_path in part_paths:
+                if os.path.exists(part_path):
+                    os.remove(part_path)
+        seconds = time.perf_counter() - start_time
+
+        frames = sum(result['frames'] for result in results)
+        return {
+            'frames': frames,
+            'poses': sum(result['poses'] for result in results),
+            'chunks': len(plan),
+            'workers': workers,
+            'seconds': seconds,
+            'fps': frames / seconds if seconds > 0 else 0.0,
+            'chunk_results': results,
+        }
+
+    def _concatenate(self, part_paths: List[str]) -> None:
+        """Join the part files in chunk order into the output file."""
+        with open(self.output_path, 'wb') as output:
+            for part_path in part_paths:
+                with open(part_path, 'rb') as part:
+                    shutil.copyfileobj(part, output)
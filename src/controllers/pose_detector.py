@@ -18,6 +18,41 @@ class PoseLandmarks(NamedTuple):
     landmarks: list
 
 
+class LandmarkPoint(NamedTuple):
+    """Landmark rebuilt from an array, shaped like a MediaPipe landmark."""
+    x: float
+    y: float
+    z: float
+    visibility: float
+
+
+def landmarks_to_array(landmarks: PoseLandmarks) -> np.ndarray:
+    """Convert pose landmarks to a float32 (K, 4) array of x, y, z, visibility.
+    
+    Args:
+        landmarks: PoseLandmarks from detect_pose()
+        
+    Returns:
+        Array with one row per landmark
+    """
+    return np.array(
+        [(lm.x, lm.y, lm.z, lm.visibility) for lm in landmarks.landmarks],
+        dtype=np.float32
+    ).reshape(-1, 4)
+
+
+def landmarks_from_array(array: np.ndarray) -> PoseLandmarks:
+    """Convert a (K, 4) array of x, y, z, visibility back to pose landmarks.
+    
+    Args:
+        array: Landmark array as produced by landmarks_to_array()
+        
+    Returns:
+        PoseLandmarks usable with PoseDetector.get_arm_keypoints()
+    """
+    return PoseLandmarks(landmarks=[LandmarkPoint(*row) for row in array.tolist()])
+
+
 class PoseDetector:
     """Handles pose detection and arm keypoint extraction using MediaPipe Pose.
     
@@ -186,29 +221,13 @@ class PoseDetector:
             if min_confidence < self.confidence_threshold:
                 return None
             
-            # Convert to Point objects
-            shoulder = Point(
-                x=shoulder_lm.x,
-                y=shoulder_lm.y,
-                z=shoulder_lm.z
-            )
-            elbow = Point(
-                x=elbow_lm.x,
-                y=elbow_lm.y,
-                z=elbow_lm.z
-            )
-            wrist = Point(
-                x=wrist_lm.x,
-                y=wrist_lm.y,
-                z=wrist_lm.z
-            )
+            # Convert to Point objects; landmark values are always floats and
+            # visibility is in [0, 1], so the validating constructors are skipped
+            shoulder = Point.trusted(shoulder_lm.x, shoulder_lm.y, shoulder_lm.z)
+            elbow = Point.trusted(elbow_lm.x, elbow_lm.y, elbow_lm.z)
+            wrist = Point.trusted(wrist_lm.x, wrist_lm.y, wrist_lm.z)
             
-            return ArmKeypoints(
-                shoulder=shoulder,
-                elbow=elbow,
-                wrist=wrist,
-                confidence=min_confidence
-            )
+            return ArmKeypoints.trusted(shoulder, elbow, wrist, min_confidence)
             
         except (AttributeError, IndexError):
             return None
@@ -0,0 +1,801 @@
+"""
+Remote inference pipeline for the OpenCV Minecraft Controller.
+
+This module lets a spare machine run pose inference on behalf of the gaming PC.
+The RemoteCaptureClient JPEG-encodes frames on a worker thread and streams them
+with timestamps over TCP, and the RemoteInferenceServer decodes them, runs
+PoseDetector and streams back landmark, delta-coded landmark or control state
+messages.
+Both sides are pipelined so several frames can be in flight at once.
+"""
+
+import logging
+import queue
+import socket
+import struct
+import threading
+import time
+from collections import deque
+from typing import Callable, NamedTuple, Optional, Tuple
+
+import cv2
+import numpy as np
+
+from .pose_detector import PoseDetector, PoseLandmarks, landmarks_from_array, landmarks_to_array
+from ..models.enums import ControlState
+from ..models.landmark_codec import LandmarkStreamDecoder, LandmarkStreamEncoder
+from ..models.landmark_record import (
+    HEADER_ONLY_DTYPE, LANDMARK_RECORD_DTYPE, create_records, decode_records, pack_record,
+    record_angle, record_control_state, record_dtype_for_size, record_landmarks
+)
+from ..utils.angle_calculator import AngleCalculator
+from ..utils.clock import SystemClock
+from ..utils.spsc_ring import SPSCRing
+from ..utils.thread_priority import ROLE_CAPTURE, ROLE_DECISION, apply_thread_role
+
+
+logger = logging.getLogger(__name__)
+
+
+# Wire format (network byte order for the framing headers)
+#   frame:  magic, sequence, client timestamp, payload length, JPEG bytes
+#   result: magic, server queue/decode/inference ms, record length, followed by
+#           one landmark record (see models.landmark_record) carrying the
+#           sequence, client timestamp, angle, control state and landmarks
+#   compact result: as result with magic KC, followed by a header-only record
+#           and one landmark codec stream frame (see models.landmark_codec)
+FRAME_MAGIC = b'KF'
+RESULT_MAGIC = b'KR'
+COMPACT_RESULT_MAGIC = b'KC'
+FRAME_HEADER = struct.Struct('!2sIdI')
+RESULT_HEADER = struct.Struct('!2sfffH')
+
+REPLY_MODES = ('landmarks', 'compact', 'state')
+
+# Metadata stored with each frame handed from submit() to the encoder thread
+PENDING_FRAME_META_DTYPE = np.dtype([('sequence', '<u4'), ('submitted_at', '<f8')])
+
+
+class RemoteResult(NamedTuple):
+    """Inference result received from a RemoteInferenceServer."""
+    sequence: int
+    landmarks: Optional[np.ndarray]
+    control_state: Optional[ControlState]
+    angle: Optional[float]
+    latency: dict
+
+
+def _recv_exact(sock: socket.socket, size: int) -> Optional[bytes]:
+    """Read exactly size bytes from a socket.
+
+    Args:
+        sock: Connected socket
+        size: Number of bytes to read
+
+    Returns:
+        The bytes read, or None if the peer closed the connection
+    """
+    buffer = bytearray(size)
+    view = memoryview(buffer)
+    received = 0
+    while received < size:
+        count = sock.recv_into(view[received:], size - received)
+        if count == 0:
+            return None
+        received += count
+    return bytes(buffer)
+
+
+def parse_address(address: str) -> Tuple[str, int]:
+    """Parse a HOST:PORT string.
+
+    Args:
+        address: Address in HOST:PORT form
+
+    Returns:
+        Tuple of host and port
+
+    Raises:
+        ValueError: If the address is malformed
+    """
+    host, sep, port = address.rpartition(':')
+    if not sep or not host or not port.isdigit():
+        raise ValueError(f"address must be in HOST:PORT form, got {address!r}")
+    return host, int(port)
+
+
+def _percentile(values, percent: float) -> float:
+    """Return the given percentile of a sequence, or 0.0 if it is empty."""
+    if not values:
+        return 0.0
+    return float(np.percentile(np.asarray(values, dtype=np.float64), percent))
+
+
+class RemoteInferenceServer:
+    """Serves pose inference to a RemoteCaptureClient over TCP.
+
+    One client is served at a time. A receiver thread reads and decodes frames
+    while the processing thread runs inference on the previous frame, so decode
+    and inference overlap.
+    """
+
+    def __init__(
+        self,
+        host: str = '0.0.0.0',
+        port: int = 5555,
+        detector_factory: Optional[Callable[[], PoseDetector]] = None,
+        reply_mode: str = 'landmarks',
+        max_queued_frames: int = 4
+    ):
+        """Initialize the inference server.
+
+        Args:
+            host: Interface to listen on
+            port: TCP port to listen on (0 picks a free port)
+            detector_factory: Callable creating the pose detector (default: PoseDetector())
+            reply_mode: 'landmarks' to send all landmarks, 'compact' for delta-coded
+                landmarks, 'state' for control state only
+            max_queued_frames: Maximum decoded frames waiting for inference
+
+        Raises:
+            ValueError: If reply_mode or max_queued_frames is invalid
+        """
+        if reply_mode not in REPLY_MODES:
+            raise ValueError(f"reply_mode must be one of {REPLY_MODES}")
+        if max_queued_frames < 1:
+            raise ValueError("max_queued_frames must be at least 1")
+
+        self.host = host
+        self.port = port
+        self.reply_mode = reply_mode
+        self.max_queued_frames = max_queued_frames
+        self._detector_factory = detector_factory or PoseDetector
+        self._detector: Optional[PoseDetector] = None
+        self._angle_calculator = AngleCalculator()
+
+        self._listen_socket: Optional[socket.socket] = None
+        self._running = False
+        self._accept_thread: Optional[threading.Thread] = None
+        self._client_socket: Optional[socket.socket] = None
+        self._frames_served = 0
+
+    @property
+    def address(self) -> Tuple[str, int]:
+        """Return the bound (host, port) of the listening socket."""
+        if self._listen_socket is None:
+            return (self.host, self.port)
+        return self._listen_socket.getsockname()[:2]
+
+    @property
+    def frames_served(self) -> int:
+        """Return the number of frames processed since start."""
+        return self._frames_served
+
+    def start(self) -> None:
+        """Bind the listening socket and serve clients on a background thread."""
+        if self._running:
+            return
+
+        if self._detector is None:
+            self._detector = self._detector_factory()
+
+        self._listen_socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self._listen_socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self._listen_socket.bind((self.host, self.port))
+        self._listen_socket.listen(1)
+        self._listen_socket.settimeout(0.2)
+        self._running = True
+
+        self._accept_thread = threading.Thread(
+            target=self._accept_loop, name='remote-server-accept', daemon=True
+        )
+        self._accept_thread.start()
+        logger.info(f"Remote inference server listening on {self.address[0]}:{self.address[1]}")
+
+    def serve_forever(self) -> None:
+        """Start the server and block until stop() is called."""
+        self.start()
+        try:
+            while self._running:
+                time.sleep(0.2)
+        finally:
+            self.stop()
+
+    def stop(self) -> None:
+        """Stop serving and close the listening socket."""
+        self._running = False
+        if self._listen_socket is not None:
+            try:
+                self._listen_socket.close()
+            except OSError:
+                pass
+        if self._client_socket is not None:
+            try:
+                self._client_socket.shutdown(socket.SHUT_RDWR)
+            except OSError:
+                pass
+        if self._accept_thread is not None and self._accept_thread is not threading.current_thread():
+            self._accept_thread.join(timeout=2.0)
+        self._accept_thread = None
+        self._listen_socket = None
+        logger.info("Remote inference server stopped")
+
+    def _accept_loop(self) -> None:
+        """Accept clients one at a time until stopped."""
+        while self._running:
+            try:
+                connection, peer = self._listen_socket.accept()
+            except socket.timeout:
+                continue
+            except OSError:
+                break
+
+            logger.info(f"Remote client connected from {peer[0]}:{peer[1]}")
+            try:
+                self._serve_client(connection)
+            except Exception as e:
+                logger.error(f"Error serving remote client: {e}")
+            finally:
+                connection.close()
+                self._angle_calculator.reset_state()
+                logger.info("Remote client disconnected")
+
+    def _serve_client(self, connection: socket.socket) -> None:
+        """Serve a single client connection.
+
+        Args:
+            connection: Accepted client socket
+        """
+        connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        connection.settimeout(None)
+        self._client_socket = connection
+        record_dtype = LANDMARK_RECORD_DTYPE if self.reply_mode == 'landmarks' else HEADER_ONLY_DTYPE
+        reply_record = create_records(1, record_dtype)
+        landmark_encoder = LandmarkStreamEncoder() if self.reply_mode == 'compact' else None
+        decoded_frames: queue.Queue = queue.Queue(maxsize=self.max_queued_frames)
+        client_done = threading.Event()
+
+        receiver = threading.Thread(
+            target=self._receive_frames,
+            args=(connection, decoded_frames, client_done),
+            name='remote-server-recv',
+            daemon=True
+        )
+        receiver.start()
+
+        while self._running:
+            try:
+                item = decoded_frames.get(timeout=0.2)
+            except queue.Empty:
+                if client_done.is_set():
+                    break
+                continue
+            if item is None:
+                break
+
+            sequence, client_timestamp, received_at, decode_ms, frame = item
+            queue_ms = (time.perf_counter() - received_at) * 1000.0 - decode_ms
+
+            inference_start = time.perf_counter()
+            if frame is None:
+                landmarks, state, angle = None, None, None
+            else:
+                landmarks, state, angle = self._run_inference(frame)
+            inference_ms = (time.perf_counter() - inference_start) * 1000.0
+
+            message = self._encode_result(
+                reply_record, sequence, client_timestamp, max(queue_ms, 0.0), decode_ms,
+                inference_ms, landmarks, state, angle, landmark_encoder
+            )
+            try:
+                connection.sendall(message)
+            except OSError:
+                break
+            self._frames_served += 1
+
+        client_done.set()
+        try:
+            connection.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        receiver.join(timeout=2.0)
+        self._client_socket = None
+
+    def _receive_frames(
+        self,
+        connection: socket.socket,
+        decoded_frames: queue.Queue,
+        client_done: threading.Event
+    ) -> None:
+        """Read and decode frames from the client until it disconnects."""
+        try:
+            while self._running and not client_done.is_set():
+                header = _recv_exact(connection, FRAME_HEADER.size)
+                if header is None:
+                    break
+
+                magic, sequence, client_timestamp, length = FRAME_HEADER.unpack(header)
+                if magic != FRAME_MAGIC:
+                    logger.error("Invalid frame header from remote client")
+                    break
+
+                payload = _recv_exact(connection, length)
+                if payload is None:
+                    break
+
+                received_at = time.perf_counter()
+                frame = cv2.imdecode(np.frombuffer(payload, dtype=np.uint8), cv2.IMREAD_COLOR)
+                decode_ms = (time.perf_counter() - received_at) * 1000.0
+                if frame is None:
+                    # Still answered (with no pose) so the client frees its in-flight slot
+                    logger.warning(f"Failed to decode remote frame {sequence}")
+
+                item = (sequence, client_timestamp, received_at, decode_ms, frame)
+                while not client_done.is_set():
+                    try:
+                        decoded_frames.put(item, timeout=0.2)
+                        break
+                    except queue.Full:
+                        continue
+        except OSError as e:
+            logger.debug(f"Remote receive ended: {e}")
+        finally:
+            client_done.set()
+
+    def _run_inference(self, frame: np.ndarray):
+        """Run pose detection and decision logic on a decoded frame.
+
+        Args:
+            frame: Decoded BGR frame
+
+        Returns:
+            Tuple of (landmark array or None, control state or None, angle or None)
+        """
+        pose_landmarks = self._detector.detect_pose(frame)
+        if pose_landmarks is None:
+            return None, None, None
+
+        landmarks = landmarks_to_array(pose_landmarks)
+
+        state = None
+        angle = None
+        arm_keypoints = self._detector.get_arm_keypoints(pose_landmarks)
+        if arm_keypoints:
+            try:
+                angle = self._angle_calculator.calculate_elbow_angle(
+                    arm_keypoints.shoulder, arm_keypoints.elbow, arm_keypoints.wrist
+                )
+                if self._angle_calculator.is_angle_valid(angle):
+                    state = self._angle_calculator.get_control_state(angle)
+                else:
+                    angle = None
+            except ValueError:
+                angle = None
+
+        return landmarks, state, angle
+
+    def _encode_result(
+        self,
+        reply_record: np.ndarray,
+        sequence: int,
+        client_timestamp: float,
+        queue_ms: float,
+        decode_ms: float,
+        inference_ms: float,
+        landmarks: Optional[np.ndarray],
+        state: Optional[ControlState],
+        angle: Optional[float],
+        landmark_encoder: Optional[LandmarkStreamEncoder] = None
+    ) -> bytes:
+        """Serialize an inference result message into the reusable reply record."""
+        magic = RESULT_MAGIC
+        if self.reply_mode == 'landmarks':
+            pack_record(reply_record[0], sequence, client_timestamp, landmarks, angle=angle, control_state=state)
+            payload = reply_record.tobytes()
+        else:
+            pack_record(reply_record[0], sequence, client_timestamp, angle=angle, control_state=state)
+            payload = reply_record.tobytes()
+            if landmark_encoder is not None:
+                magic = COMPACT_RESULT_MAGIC
+                payload += landmark_encoder.encode(landmarks)
+
+        header = RESULT_HEADER.pack(magic, queue_ms, decode_ms, inference_ms, len(payload))
+        return header + payload
+
+
+class RemoteCaptureClient:
+    """Streams JPEG-encoded frames to a RemoteInferenceServer and collects results.
+
+    Frames submitted with submit() are encoded and sent on a worker thread, and
+    results are read on a second thread, so up to max_in_flight frames can be
+    outstanding at once. submit() copies the frame into a preallocated
+    latest-wins ring, so callers may reuse their buffer; when the encoder falls
+    behind it only ever encodes the newest frame, which keeps latency bounded.
+    """
+
+    def __init__(
+        self,
+        host: str,
+        port: int,
+        jpeg_quality: int = 80,
+        max_in_flight: int = 3,
+        stats_window: int = 300
+    ):
+        """Initialize the capture client.
+
+        Args:
+            host: Server host name or address
+            port: Server TCP port
+            jpeg_quality: JPEG encoding quality (1-100)
+            max_in_flight: Maximum frames sent but not yet answered
+            stats_window: Number of recent frames kept for latency statistics
+
+        Raises:
+            ValueError: If jpeg_quality or max_in_flight is out of range
+        """
+        if not 1 <= jpeg_quality <= 100:
+            raise ValueError("jpeg_quality must be between 1 and 100")
+        if max_in_flight < 1:
+            raise ValueError("max_in_flight must be at least 1")
+
+        self.host = host
+        self.port = port
+        self.jpeg_quality = jpeg_quality
+        self.max_in_flight = max_in_flight
+
+        self._socket: Optional[socket.socket] = None
+        self._running = False
+        self._pending_frames: Optional[SPSCRing] = None
+        self._frames_ready = threading.Event()
+        self._in_flight = threading.Semaphore(max_in_flight)
+        self._send_times: dict = {}
+        self._landmark_decoder = LandmarkStreamDecoder()
+        self._send_times_lock = threading.Lock()
+        self._sequence = 0
+        self._encoder_thread: Optional[threading.Thread] = None
+        self._receiver_thread: Optional[threading.Thread] = None
+
+        self._latest_result: Optional[RemoteResult] = None
+        self._result_condition = threading.Condition()
+        self._latency_history: deque = deque(maxlen=stats_window)
+        self._frames_sent = 0
+        self._frames_dropped = 0
+        self._results_received = 0
+
+    def connect(self, timeout: float = 5.0) -> bool:
+        """Connect to the server and start the worker threads.
+
+        Args:
+            timeout: Connection timeout in seconds
+
+        Returns:
+            bool: True if connected successfully, False otherwise
+        """
+        try:
+            self._socket = socket.create_connection((self.host, self.port), timeout=timeout)
+            self._socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            self._socket.settimeout(None)
+        except OSError as e:
+            logger.error(f"Failed to connect to remote server {self.host}:{self.port}: {e}")
+            self._socket = None
+            return False
+
+        self._landmark_decoder = LandmarkStreamDecoder()
+        self._running = True
+        self._encoder_thread = threading.Thread(
+            target=self._encode_loop, name='remote-client-encode', daemon=True
+        )
+        self._receiver_thread = threading.Thread(
+            target=self._receive_loop, name='remote-client-recv', daemon=True
+        )
+        self._encoder_thread.start()
+        self._receiver_thread.start()
+        logger.info(f"Connected to remote inference server {self.host}:{self.port}")
+        return True
+
+    def is_connected(self) -> bool:
+        """Check if the client is connected and running."""
+        return self._running and self._socket is not None
+
+    def submit(self, frame: np.ndarray) -> int:
+        """Queue a frame for encoding and sending.
+
+        Args:
+            frame: BGR frame to send
+
+        Returns:
+            int: Sequence number assigned to the frame
+        """
+        sequence = self._sequence
+        self._sequence = (self._sequence + 1) & 0xFFFFFFFF
+
+        ring = self._pending_frames
+        if ring is None or ring.shape != frame.shape or ring.dtype != frame.dtype:
+            # Frames left in a replaced ring are never encoded
+            if ring is not None:
+                ring_stats = ring.get_stats()
+                self._frames_dropped += ring_stats['put'] - ring_stats['got']
+            ring = SPSCRing(frame.shape, frame.dtype, capacity=3, mode='latest',
+                            meta_dtype=PENDING_FRAME_META_DTYPE)
+            self._pending_frames = ring
+            self._frames_ready.set()
+        ring.put(frame, meta=(sequence, time.perf_counter()))
+        return sequence
+
+    def get_latest_result(self) -> Optional[RemoteResult]:
+        """Return the most recently received result without blocking."""
+        return self._latest_result
+
+    def wait_for_result(self, sequence: int, timeout: float = 1.0) -> Optional[RemoteResult]:
+        """Block until a result for the given sequence (or a later one) arrives.
+
+        Args:
+            sequence: Sequence number returned by submit()
+            timeout: Maximum time to wait in seconds
+
+        Returns:
+            The latest result if it covers the sequence, None on timeout
+        """
+        deadline = time.monotonic() + timeout
+        with self._result_condition:
+            while True:
+                result = self._latest_result
+                if result is not None and result.sequence >= sequence:
+                    return result
+                remaining = deadline - time.monotonic()
+                if remaining <= 0 or not self._running:
+                    return None
+                self._result_condition.wait(remaining)
+
+    def get_latency_stats(self) -> dict:
+        """Get the latency breakdown over recent frames.
+
+        Returns:
+            dict: Mean, p50 and p99 in milliseconds for each stage plus counters
+        """
+        history = list(self._latency_history)
+        ring = self._pending_frames
+        stats = {
+            'frames_sent': self._frames_sent,
+            'frames_dropped': self._frames_dropped + (ring.get_stats()['skipped'] if ring is not None else 0),
+            'results_received': self._results_received,
+        }
+        for stage in ('client_queue_ms', 'encode_ms', 'network_ms', 'server_queue_ms', 'decode_ms',
+                      'inference_ms', 'total_ms'):
+            values = [entry[stage] for entry in history]
+            stats[stage] = {
+                'mean': float(np.mean(values)) if values else 0.0,
+                'p50': _percentile(values, 50),
+                'p99': _percentile(values, 99),
+            }
+        return stats
+
+    def close(self) -> None:
+        """Stop the worker threads and close the connection."""
+        self._running = False
+        if self._socket is not None:
+            try:
+                self._socket.shutdown(socket.SHUT_RDWR)
+            except OSError:
+                pass
+            self._socket.close()
+
+        # Wake the encoder if it is waiting on the in-flight limit
+        self._in_flight.release()
+        for thread in (self._encoder_thread, self._receiver_thread):
+            if thread is not None:
+                thread.join(timeout=2.0)
+
+        with self._result_condition:
+            self._result_condition.notify_all()
+        self._socket = None
+        logger.info("Remote capture client closed")
+
+    def _encode_loop(self) -> None:
+        """Encode pending frames and send them while under the in-flight limit."""
+        apply_thread_role(ROLE_CAPTURE)
+        encode_params = [int(cv2.IMWRITE_JPEG_QUALITY), self.jpeg_quality]
+
+        while self._running:
+            ring = self._pending_frames
+            if ring is None:
+                self._frames_ready.wait(0.2)
+                continue
+            # The slot stays untouched by submit() until the next get()
+            frame = ring.get(timeout=0.2)
+            if frame is None:
+                continue
+            sequence = int(ring.meta['sequence'])
+            submitted_at = float(ring.meta['submitted_at'])
+
+            encode_start = time.perf_counter()
+            ok, encoded = cv2.imencode('.jpg', frame, encode_params)
+            encode_ms = (time.perf_counter() - encode_start) * 1000.0
+            if not ok:
+                logger.warning(f"Failed to JPEG-encode frame {sequence}")
+                continue
+
+            while self._running and not self._in_flight.acquire(timeout=0.2):
+                pass
+            if not self._running:
+                break
+
+            # Time in the pending ring and waiting for an in-flight slot is client-side
+            sent_at = time.perf_counter()
+            client_queue_ms = (sent_at - submitted_at) * 1000.0 - encode_ms
+            payload = encoded.tobytes()
+            with self._send_times_lock:
+                self._send_times[sequence] = (submitted_at, sent_at, encode_ms, client_queue_ms)
+            try:
+                self._socket.sendall(
+                    FRAME_HEADER.pack(FRAME_MAGIC, sequence, submitted_at, len(payload)) + payload
+                )
+                self._frames_sent += 1
+            except OSError as e:
+                logger.error(f"Failed to send frame to remote server: {e}")
+                self._running = False
+                break
+
+    def _receive_loop(self) -> None:
+        """Read results from the server and record latency breakdowns."""
+        apply_thread_role(ROLE_DECISION)
+        try:
+            while self._running:
+                header = _recv_exact(self._socket, RESULT_HEADER.size)
+                if header is None:
+                    break
+
+                magic, queue_ms, decode_ms, inference_ms, payload_size = RESULT_HEADER.unpack(header)
+                if magic not in (RESULT_MAGIC, COMPACT_RESULT_MAGIC):
+                    logger.error("Invalid result header from remote server")
+                    break
+
+                payload = _recv_exact(self._socket, payload_size)
+                if payload is None:
+                    break
+                if magic == COMPACT_RESULT_MAGIC:
+                    record = decode_records(payload[:HEADER_ONLY_DTYPE.itemsize], HEADER_ONLY_DTYPE)[0]
+                    landmarks = self._landmark_decoder.decode(payload[HEADER_ONLY_DTYPE.itemsize:])
+                else:
+                    record = decode_records(payload, record_dtype_for_size(payload_size))[0]
+                    poses = record_landmarks(record)
+                    landmarks = None if poses is None else poses[0]
+                sequence = int(record['sequence'])
+
+                received_at = time.perf_counter()
+                self._in_flight.release()
+                with self._send_times_lock:
+                    submitted_at, sent_at, encode_ms, client_queue_ms = self._send_times.pop(
+                        sequence, (received_at, received_at, 0.0, 0.0)
+                    )
+
+                server_ms = queue_ms + decode_ms + inference_ms
+                latency = {
+                    'client_queue_ms': max(client_queue_ms, 0.0),
+                    'encode_ms': encode_ms,
+                    'network_ms': max((received_at - sent_at) * 1000.0 - server_ms, 0.0),
+                    'server_queue_ms': queue_ms,
+                    'decode_ms': decode_ms,
+                    'inference_ms': inference_ms,
+                    'total_ms': (received_at - submitted_at) * 1000.0,
+                }
+                self._latency_history.append(latency)
+                self._results_received += 1
+
+                result = RemoteResult(
+                    sequence=sequence,
+                    landmarks=landmarks,
+                    control_state=record_control_state(record),
+                    angle=record_angle(record),
+                    latency=latency
+                )
+                with self._result_condition:
+                    self._latest_result = result
+                    self._result_condition.notify_all()
+        except (OSError, ValueError) as e:
+            if self._running:
+                logger.error(f"Remote receive failed: {e}")
+        finally:
+            self._running = False
+            with self._result_condition:
+                self._result_condition.notify_all()
+
+    def __enter__(self):
+        """Context manager entry."""
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - close the connection."""
+        self.close()
+
+
+class RemotePoseDetector(PoseDetector):
+    """PoseDetector that offloads inference to a remote server.
+
+    detect_pose() submits the frame and returns the most recent landmarks that
+    have come back, so the local loop never waits for the network hop. Results
+    older than max_result_age are treated as no detection.
+
+    A server in 'state' reply mode sends no landmarks, only its own decision;
+    detect_pose() then returns None and get_remote_decision() has the server's
+    control state and angle, decided with the server's thresholds.
+    """
+
+    def __init__(
+        self,
+        client: RemoteCaptureClient,
+        confidence_threshold: float = 0.5,
+        max_result_age: float = 0.5,
+        clock=None
+    ):
+        """Initialize the remote pose detector without loading a local model.
+
+        Args:
+            client: Connected RemoteCaptureClient
+            confidence_threshold: Minimum landmark visibility for arm keypoints
+            max_result_age: Seconds after which the latest result is considered stale
+            clock: Clock timing result age (default: SystemClock)
+
+        Raises:
+            ValueError: If confidence_threshold is not between 0.0 and 1.0
+        """
+        if not 0.0 <= confidence_threshold <= 1.0:
+            raise ValueError("confidence_threshold must be between 0.0 and 1.0")
+
+        self.client = client
+        self.confidence_threshold = confidence_threshold
+        self.max_result_age = max_result_age
+        self.clock = clock or SystemClock()
+        self._last_sequence = -1
+        self._last_result_time = 0.0
+        self._last_landmarks: Optional[PoseLandmarks] = None
+        self._last_decision: Optional[Tuple[ControlState, float]] = None
+        self._last_detection_successful = False
+
+    def detect_pose(self, frame: np.ndarray) -> Optional[PoseLandmarks]:
+        """Submit a frame and return the latest remote landmarks.
+
+        Args:
+            frame: Input video frame (BGR format)
+
+        Returns:
+            PoseLandmarks from the newest result, None if there is none or it is stale
+
+        Raises:
+            ValueError: If frame is not a valid numpy array
+        """
+        if not isinstance(frame, np.ndarray):
+            raise ValueError("frame must be a numpy array")
+
+        self.client.submit(frame)
+        result = self.client.get_latest_result()
+        now = self.clock.now()
+
+        if result is not None and result.sequence != self._last_sequence:
+            self._last_sequence = result.sequence
+            self._last_result_time = now
+            if result.landmarks is None:
+                self._last_landmarks = None
+            else:
+                self._last_landmarks = landmarks_from_array(result.landmarks)
+            # Only state-only replies carry a decision without landmarks
+            if result.landmarks is None and result.control_state is not None:
+                self._last_decision = (result.control_state, result.angle)
+            else:
+                self._last_decision = None
+
+        if now - self._last_result_time > self.max_result_age:
+            self._last_landmarks = None
+            self._last_decision = None
+
+        self._last_detection_successful = self._last_landmarks is not None or self._last_decision is not None
+        return self._last_landmarks
+
+    def get_remote_decision(self) -> Optional[Tuple[ControlState, float]]:
+        """Get the server's decision from the latest state-only reply.
+
+        Returns:
+            (control state, elbow angle) from a fresh state-only reply, None when
+            the reply carried landmarks, no pose was found, or it is stale
+        """
+        return self._last_decision
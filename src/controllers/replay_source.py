@@ -0,0 +1,229 @@
+"""Replay source that feeds recorded video through the camera interface."""
+
+import cv2
+import numpy as np
+from typing import List, Optional
+import logging
+
+from ..utils.clock import VirtualClock
+
+
+class ReplaySource:
+    """Plays back a recorded video file with the same interface as CameraManager.
+
+    In 'stream' mode frames are decoded on demand; in 'preload' mode the whole
+    clip is decoded into memory at start so replays measure only downstream work.
+    Given a VirtualClock, the source advances it to each frame's media
+    timestamp, so timing features see the clip's time instead of wall time.
+    """
+
+    CAPTURE_MODES = ('stream', 'preload')
+
+    def __init__(self, path: str, capture_mode: str = 'stream', loop: bool = False,
+                 max_frames: Optional[int] = None, clock: Optional[VirtualClock] = None):
+        """
+        Initialize replay source.
+
+        Args:
+            path: Path to a video file readable by OpenCV
+            capture_mode: 'stream' to decode per frame, 'preload' to decode everything up front
+            loop: Restart from the first frame at the end of the clip
+            max_frames: Stop after this many frames (default: whole clip)
+            clock: Virtual clock advanced to the media timestamp of every returned frame
+                (continuing across loops), None to leave time alone
+
+        Raises:
+            ValueError: If capture_mode is unknown or max_frames is not positive
+        """
+        if capture_mode not in self.CAPTURE_MODES:
+            raise ValueError(f"capture_mode must be one of {self.CAPTURE_MODES}")
+        if max_frames is not None and max_frames <= 0:
+            raise ValueError("max_frames must be positive")
+
+        self.path = path
+        self.capture_mode = capture_mode
+        self.loop = loop
+        self.max_frames = max_frames
+        self.cap: Optional[cv2.VideoCapture] = None
+        self._frames: List[np.ndarray] = []
+        self._timestamps: List[float] = []
+        self._position = 0
+        self._last_timestamp = 0.0
+        self._fps = 0.0
+        self.clock = clock
+        self._clock_origin = 0.0
+        self._loop_offset = 0.0
+        self._is_initialized = False
+        self.logger = logging.getLogger(__name__)
+
+    def start_capture(self) -> bool:
+        """
+        Open the video file and, in preload mode, decode all frames.
+
+        Returns:
+            bool: True if the clip was opened and has at least one frame, False otherwise
+        """
+        try:
+            self.cap = cv2.VideoCapture(self.path)
+            if not self.cap.isOpened():
+                self.logger.error(f"Failed to open replay file {self.path}")
+                return False
+
+            self._fps = self.cap.get(cv2.CAP_PROP_FPS) or 0.0
+            self._position = 0
+            self._loop_offset = 0.0
+            if self.clock is not None:
+                self._clock_origin = self.clock.now()
+
+            if self.capture_mode == 'preload':
+                self._frames = []
+                self._timestamps = []
+                while self.max_frames is None or len(self._frames) < self.max_frames:
+                    ret, frame = self.cap.read()
+                    if not ret:
+                        break
+                    self._frames.append(frame)
+                    self._timestamps.append(self._read_timestamp(len(self._frames) - 1))
+                self.cap.release()
+                self.cap = None
+                if not self._frames:
+                    self.logger.error(f"Replay file {self.path} contains no frames")
+                    return False
+
+            self._is_initialized = True
+            self.logger.info(f"Replay source {self.path} opened ({self.capture_mode} mode)")
+            return True
+
+        except Exception as e:
+            self.logger.error(f"Error opening replay file: {e}")
+            self.release()
+            return False
+
+    def get_frame(self) -> Optional[np.ndarray]:
+        """
+        Return the next frame of the clip.
+
+        Returns:
+            Optional[np.ndarray]: Next frame, or None at the end of a non-looping clip
+        """
+        if not self._is_initialized:
+            self.logger.warning("Replay source not initialized")
+            return None
+
+        if self.max_frames is not None and self._position >= self.max_frames and not self.loop:
+            return None
+
+        if self.capture_mode == 'preload':
+            if self._position >= len(self._frames):
+                if not self.loop:
+                    return None
+                self._position = 0
+                self._loop_offset += self._clip_duration()
+            index = self._position
+            self._position += 1
+            self._last_timestamp = self._timestamps[index]
+            self._advance_clock()
+            return self._frames[index]
+
+        ret, frame = self.cap.read()
+        if not ret or (self.max_frames is not None and self._position >= self.max_frames):
+            if not self.loop:
+                return None
+            self.cap.set(cv2.CAP_PROP_POS_FRAMES, 0)
+            self._position = 0
+            self._loop_offset += self._clip_duration()
+            ret, frame = self.cap.read()
+            if not ret:
+                return None
+
+        self._last_timestamp = self._read_timestamp(self._position)
+        self._position += 1
+        self._advance_clock()
+        return frame
+
+    def get_frame_timestamp(self) -> float:
+        """
+        Get the media timestamp of the last returned frame.
+
+        Returns:
+            float: Timestamp in seconds from the start of the clip
+        """
+        return self._last_timestamp
+
+    def is_available(self) -> bool:
+        """
+        Check if the replay source can still produce frames.
+
+        Returns:
+            bool: True if the source is open, False otherwise
+        """
+        if not self._is_initialized:
+            return False
+        if self.capture_mode == 'preload':
+            return True
+        return self.cap is not None and self.cap.isOpened()
+
+    def release(self) -> None:
+        """Release the video file and any preloaded frames."""
+        try:
+            if self.cap is not None:
+                self.cap.release()
+        except Exception as e:
+            self.logger.error(f"Error releasing replay source: {e}")
+        finally:
+            self.cap = None
+            self._frames = []
+            self._timestamps = []
+            self._is_initialized = False
+
+    def reconnect(self) -> bool:
+        """
+        Reopen the clip from the beginning.
+
+        Returns:
+            bool: True if reopening succeeded, False otherwise
+        """
+        self.release()
+        return self.start_capture()
+
+    def get_camera_info(self) -> dict:
+        """
+        Get replay properties in the same shape as CameraManager.get_camera_info().
+
+        Returns:
+            dict: Replay properties including frame size and fps
+        """
+        if not self.is_available():
+            return {}
+
+        if self.capture_mode == 'preload':
+            height, width = self._frames[0].shape[:2]
+        else:
+            width = int(self.cap.get(cv2.CAP_PROP_FRAME_WIDTH))
+            height = int(self.cap.get(cv2.CAP_PROP_FRAME_HEIGHT))
+
+        return {
+            'width': width,
+            'height': height,
+            'fps': self._fps,
+            'replay_path': self.path,
+            'is_available': True
+        }
+
+    def _clip_duration(self) -> float:
+        """Return the length of one pass through the clip, ending one frame after the last timestamp."""
+        return self._last_timestamp + (1.0 / self._fps if self._fps > 0 else 1.0)
+
+    def _advance_clock(self) -> None:
+        """Move the virtual clock to the media time of the frame just returned."""
+        if self.clock is not None:
+            self.clock.advance_to(self._clock_origin + self._loop_offset + self._last_timestamp)
+
+    def _read_timestamp(self, index: int) -> float:
+        """Return the media timestamp of the frame just read, in seconds."""
+        position_ms = self.cap.get(cv2.CAP_PROP_POS_MSEC) if self.cap is not None else 0.0
+        if position_ms and position_ms > 0:
+            return position_ms / 1000.0
+        if self._fps > 0:
+            return index / self._fps
+        return float(index)
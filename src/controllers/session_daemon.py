@@ -0,0 +1,360 @@
+"""
+Warm session daemon for the OpenCV Minecraft Controller.
+
+Each main.py launch pays for imports and for MediaPipe graph construction
+before the first frame. The SessionDaemon does that once: it loads and warms
+the pose detector, leaves the camera closed, and waits for commands on a Unix
+domain socket. A 'start' command opens the camera and runs a session with the
+already loaded detector, so the time from the command to the first processed
+frame is mostly camera negotiation. Sessions are stopped, toggled and
+reconfigured by further commands; controller_client.py is the thin client.
+
+Protocol: one JSON object per connection, newline terminated, answered by one
+JSON object. Requests carry a 'command' field (see COMMANDS); replies carry
+'ok' and either results or an 'error' message.
+"""
+
+import json
+import logging
+import os
+import queue
+import socket
+import stat
+import tempfile
+import threading
+import time
+from typing import Callable, Optional
+
+import numpy as np
+
+from .application_controller import ApplicationController
+from .pose_detector import PoseDetector
+from ..utils.config_manager import ControllerConfig
+
+
+logger = logging.getLogger(__name__)
+
+
+COMMANDS = ('start', 'stop', 'toggle', 'reset', 'configure', 'status', 'shutdown')
+MAX_REQUEST_BYTES = 65536
+
+
+def default_socket_path() -> str:
+    """Return the per-user default daemon socket path."""
+    directory = os.environ.get('XDG_RUNTIME_DIR') or tempfile.gettempdir()
+    return os.path.join(directory, 'minecraft-controller.sock')
+
+
+class SessionDaemon:
+    """Keeps a warm pose detector and runs controller sessions on request.
+
+    Sessions run on the thread calling serve_forever() (the main thread, so
+    OpenCV windows behave); commands are received on a background thread.
+    """
+
+    def __init__(
+        self,
+        socket_path: Optional[str] = None,
+        detector_factory: Optional[Callable[[], PoseDetector]] = None,
+        session_factory: Optional[Callable[..., ApplicationController]] = None,
+        start_timeout: float = 10.0
+    ):
+        """Initialize the daemon.
+
+        Args:
+            socket_path: Unix socket path (default: default_socket_path())
+            detector_factory: Callable creating the pose detector (default: PoseDetector())
+            session_factory: Callable(pose_detector=..., config=..., **options) creating a
+                session (default: ApplicationController)
+            start_timeout: Seconds a 'start' command waits for the first frame
+        """
+        self.socket_path = socket_path or default_socket_path()
+        self.start_timeout = start_timeout
+        self._detector_factory = detector_factory or PoseDetector
+        self._session_factory = session_factory or ApplicationController
+        self._detector: Optional[PoseDetector] = None
+        self._config: Optional[ControllerConfig] = None
+
+        self._listen_socket: Optional[socket.socket] = None
+        self._accept_thread: Optional[threading.Thread] = None
+        self._requests: queue.Queue = queue.Queue()
+        self._running = False
+        self._session: Optional[ApplicationController] = None
+        # Outcome of a queued 'start' whose session is not running yet
+        self._pending_start: Optional[dict] = None
+        self._session_lock = threading.Lock()
+        self._sessions_started = 0
+        self._last_start_timing: Optional[dict] = None
+        self.warmup_ms = 0.0
+
+    @property
+    def session_active(self) -> bool:
+        """Check whether a session is running."""
+        return self._session is not None
+
+    def start(self) -> None:
+        """Load and warm the detector, then listen for commands.
+
+        Raises:
+            OSError: If the socket cannot be bound (e.g. another daemon is running)
+        """
+        warmup_start = time.perf_counter()
+        self._detector = self._detector_factory()
+        # Run one inference so the model graph is built before the first session
+        self._detector.detect_pose(np.zeros((240, 320, 3), dtype=np.uint8))
+        self.warmup_ms = (time.perf_counter() - warmup_start) * 1000.0
+
+        self._remove_stale_socket()
+        self._listen_socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self._listen_socket.bind(self.socket_path)
+        os.chmod(self.socket_path, 0o600)
+        self._listen_socket.listen(4)
+        # Closing a socket does not wake a blocked accept() on Linux, so the
+        # accept loop polls _running between short timeouts
+        self._listen_socket.settimeout(0.2)
+        self._running = True
+
+        self._accept_thread = threading.Thread(target=self._accept_loop, name='daemon-accept', daemon=True)
+        self._accept_thread.start()
+        logger.info(f"Session daemon ready on {self.socket_path} (detector warm in {self.warmup_ms:.0f} ms)")
+
+    def serve_forever(self) -> None:
+        """Run requested sessions on this thread until a shutdown command."""
+        if not self._running:
+            self.start()
+        try:
+            while self._running:
+                try:
+                    request = self._requests.get(timeout=0.5)
+                except queue.Empty:
+                    continue
+                if request is None:
+                    break
+                self._run_session(*request)
+        finally:
+            self.stop()
+
+    def stop(self) -> None:
+        """Stop any session, close the socket and remove it."""
+        self._running = False
+        with self._session_lock:
+            if self._session is not None:
+                self._session.request_action('stop')
+            if self._pending_start is not None:
+                self._pending_start['cancelled'] = True
+                self._pending_start = None
+        self._requests.put(None)
+
+        if self._listen_socket:
+            try:
+                self._listen_socket.close()
+            except OSError:
+                pass
+            self._listen_socket = None
+            try:
+                os.unlink(self.socket_path)
+            except OSError:
+                pass
+        if self._accept_thread and self._accept_thread is not threading.current_thread():
+            self._accept_thread.join(timeout=2.0)
+
+    def handle_request(self, request: dict) -> dict:
+        """Execute one command.
+
+        Args:
+            request: Decoded request with a 'command' field
+
+        Returns:
+            dict: Reply with 'ok' and results or 'error'
+        """
+        command = request.get('command')
+        if command not in COMMANDS:
+            return {'ok': False, 'error': f"command must be one of {COMMANDS}"}
+
+        if command == 'status':
+            return self._status()
+        if command == 'start':
+            return self._start_session(request.get('options') or {})
+        if command == 'configure':
+            return self._configure(request.get('config') or {})
+        if command == 'shutdown':
+            self.stop()
+            return {'ok': True}
+
+        # stop, toggle and reset apply to the running session
+        action = {'stop': 'stop', 'toggle': 'toggle', 'reset': 'reset'}[command]
+        with self._session_lock:
+            if self._session is None:
+                return {'ok': False, 'error': 'no session is running'}
+            self._session.request_action(action)
+        return {'ok': True}
+
+    def _start_session(self, options: dict) -> dict:
+        """Queue a session and wait until it has processed its first frame.
+
+        A start that times out is cancelled, so its session never runs after
+        the client has been told it failed.
+        """
+        received_at = time.perf_counter()
+        outcome = {'ready': threading.Event()}
+        with self._session_lock:
+            if self._session is not None:
+                return {'ok': False, 'error': 'a session is already running'}
+            if self._pending_start is not None:
+                return {'ok': False, 'error': 'a session is already starting'}
+            self._pending_start = outcome
+        self._requests.put((options, received_at, outcome))
+
+        if not outcome['ready'].wait(self.start_timeout):
+            with self._session_lock:
+                if 'session' not in outcome:
+                    outcome['cancelled'] = True
+                    if self._pending_start is outcome:
+                        self._pending_start = None
+                    return {'ok': False, 'error': 'session did not initialize in time'}
+        if 'error' in outcome:
+            return {'ok': False, 'error': outcome['error']}
+
+        session = outcome['session']
+        if not session.first_frame_event.wait(self.start_timeout):
+            session.request_action('stop')
+            return {'ok': False, 'error': 'no frame processed in time'}
+
+        timing = {
+            'initialize_ms': (outcome['initialized_at'] - received_at) * 1000.0,
+            'time_to_first_frame_ms': (session.first_frame_time - received_at) * 1000.0,
+        }
+        self._last_start_timing = timing
+        return {'ok': True, **timing}
+
+    def _run_session(self, options: dict, received_at: float, outcome: dict) -> None:
+        """Create, run and clean up one session on the serving thread."""
+        if outcome.get('cancelled'):
+            return
+        try:
+            session = self._session_factory(pose_detector=self._detector, config=self._config, **options)
+        except (TypeError, ValueError) as e:
+            self._fail_start(outcome, f"invalid session options: {e}")
+            return
+
+        if not session.initialize():
+            self._fail_start(outcome, 'failed to initialize session (camera or mouse unavailable)')
+            return
+
+        with self._session_lock:
+            if outcome.get('cancelled'):
+                session.cleanup()
+                logger.info("Session start was cancelled, camera released")
+                return
+            self._pending_start = None
+            outcome['initialized_at'] = time.perf_counter()
+            outcome['session'] = session
+            self._session = session
+            self._sessions_started += 1
+        outcome['ready'].set()
+
+        try:
+            session.run()
+        finally:
+            with self._session_lock:
+                self._session = None
+            session.cleanup()
+            logger.info("Session ended, detector kept warm")
+
+    def _fail_start(self, outcome: dict, error: str) -> None:
+        """Report a session that could not be started."""
+        with self._session_lock:
+            if self._pending_start is outcome:
+                self._pending_start = None
+        outcome['error'] = error
+        outcome['ready'].set()
+
+    def _configure(self, config_data: dict) -> dict:
+        """Validate a configuration and apply it to the current and future sessions."""
+        try:
+            config = ControllerConfig.from_dict(config_data)
+        except (TypeError, ValueError) as e:
+            return {'ok': False, 'error': f"invalid configuration: {e}"}
+
+        self._config = config
+        with self._session_lock:
+            if self._session is not None:
+                self._session.apply_config(config)
+        return {'ok': True}
+
+    def _status(self) -> dict:
+        """Report daemon state and, while a session runs, its system status."""
+        reply = {
+            'ok': True,
+            'detector_ready': self._detector is not None,
+            'warmup_ms': self.warmup_ms,
+            'session_active': self.session_active,
+            'sessions_started': self._sessions_started,
+            'last_start': self._last_start_timing,
+        }
+        with self._session_lock:
+            if self._session is not None:
+                reply['session'] = self._session.get_system_status()
+        return reply
+
+    def _accept_loop(self) -> None:
+        """Accept client connections and answer one request per connection."""
+        while self._running:
+            try:
+                connection, _ = self._listen_socket.accept()
+            except socket.timeout:
+                continue
+            except (OSError, AttributeError):
+                # AttributeError: stop() cleared the socket between polls
+                break
+            # Requests such as 'start' block until the session is up, so each
+            # connection is answered on its own thread
+            threading.Thread(
+                target=self._serve_connection, args=(connection,), name='daemon-client', daemon=True
+            ).start()
+
+    def _serve_connection(self, connection: socket.socket) -> None:
+        """Read one JSON request and write its reply."""
+        with connection:
+            try:
+                connection.settimeout(self.start_timeout)
+                data = b''
+                while not data.endswith(b'\n') and len(data) < MAX_REQUEST_BYTES:
+                    chunk = connection.recv(4096)
+                    if not chunk:
+                        break
+                    data += chunk
+                try:
+                    request = json.loads(data.decode('utf-8'))
+                    reply = self.handle_request(request) if isinstance(request, dict) else {
+                        'ok': False, 'error': 'request must be a JSON object'
+                    }
+                except ValueError as e:
+                    reply = {'ok': False, 'error': f"invalid request: {e}"}
+                connection.sendall(json.dumps(reply, default=str).encode('utf-8') + b'\n')
+            except OSError as e:
+                logger.debug(f"Daemon client connection failed: {e}")
+
+    def _remove_stale_socket(self) -> None:
+        """Remove a socket file left by a daemon that is no longer running.
+
+        Raises:
+            OSError: If another daemon is still listening on the path, or the
+                path exists and is not a socket
+        """
+        try:
+            mode = os.lstat(self.socket_path).st_mode
+        except FileNotFoundError:
+            return
+        if not stat.S_ISSOCK(mode):
+            # Never delete a file a mistyped --socket happens to point at
+            raise OSError(f"{self.socket_path} exists and is not a socket")
+        probe = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            probe.connect(self.socket_path)
+        except OSError:
+            os.unlink(self.socket_path)
+            return
+        finally:
+            probe.close()
+        raise OSError(f"a daemon is already listening on {self.socket_path}")
@@ -2,15 +2,26 @@
 Data models and enums for the OpenCV Minecraft Controller.
 
 This module contains the core data structures used throughout the application
-including Point coordinates, ArmKeypoints, SystemState, and ControlState enum.
+including Point coordinates, ArmKeypoints, SystemState, ControlState enum,
+the fixed-size binary landmark record format and the landmark stream codec.
 """
 
 from .data_models import Point, ArmKeypoints, SystemState
 from .enums import ControlState
+from .landmark_record import LANDMARK_RECORD_DTYPE, landmark_record_dtype
+from .landmark_codec import (
+    LandmarkStreamDecoder, LandmarkStreamEncoder, decode_landmark_sequence, encode_landmark_sequence
+)
 
 __all__ = [
     "Point",
     "ArmKeypoints", 
     "SystemState",
-    "ControlState"
+    "ControlState",
+    "LANDMARK_RECORD_DTYPE",
+    "landmark_record_dtype",
+    "LandmarkStreamEncoder",
+    "LandmarkStreamDecoder",
+    "encode_landmark_sequence",
+    "decode_landmark_sequence"
 ]
\ No newline at end of file
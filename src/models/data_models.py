@@ -3,14 +3,20 @@ Core data models for the OpenCV Minecraft Controller.
 
 This module defines the fundamental data structures used throughout the application
 for representing 3D coordinates, arm keypoints, and system state.
+
+All models use __slots__ and are frozen values; each model also has a
+trusted() constructor that skips validation for internal producers such as
+PoseDetector, while the regular constructor validates external input.
 """
 
 from dataclasses import dataclass
-from typing import Optional
 from .enums import ControlState
 
 
-@dataclass
+_new_instance = object.__new__
+
+
+@dataclass(frozen=True, slots=True)
 class Point:
     """Represents a 3D coordinate point.
     
@@ -28,9 +34,27 @@ class Point:
             raise TypeError("y coordinate must be a number")
         if not isinstance(self.z, (int, float)):
             raise TypeError("z coordinate must be a number")
+    
+    @classmethod
+    def trusted(cls, x: float, y: float, z: float = 0.0) -> 'Point':
+        """Create a Point without validation.
+        
+        Only for producers that already guarantee numeric coordinates.
+        """
+        point = _new_instance(cls)
+        _set_point_x(point, x)
+        _set_point_y(point, y)
+        _set_point_z(point, z)
+        return point
+
+
+# Slot setters bypass the frozen __setattr__ for trusted construction
+_set_point_x = Point.__dict__['x'].__set__
+_set_point_y = Point.__dict__['y'].__set__
+_set_point_z = Point.__dict__['z'].__set__
 
 
-@dataclass
+@dataclass(frozen=True, slots=True)
 class ArmKeypoints:
     """Represents the key points of an arm for pose detection.
     
@@ -53,17 +77,40 @@ class ArmKeypoints:
             raise TypeError("confidence must be a number")
         if not 0.0 <= self.confidence <= 1.0:
             raise ValueError("confidence must be between 0.0 and 1.0")
+    
+    @classmethod
+    def trusted(cls, shoulder: Point, elbow: Point, wrist: Point, confidence: float) -> 'ArmKeypoints':
+        """Create ArmKeypoints without validation.
+        
+        Only for producers that already guarantee Point instances and a confidence in [0, 1].
+        """
+        keypoints = _new_instance(cls)
+        _set_arm_shoulder(keypoints, shoulder)
+        _set_arm_elbow(keypoints, elbow)
+        _set_arm_wrist(keypoints, wrist)
+        _set_arm_confidence(keypoints, confidence)
+        return keypoints
+
+
+_set_arm_shoulder = ArmKeypoints.__dict__['shoulder'].__set__
+_set_arm_elbow = ArmKeypoints.__dict__['elbow'].__set__
+_set_arm_wrist = ArmKeypoints.__dict__['wrist'].__set__
+_set_arm_confidence = ArmKeypoints.__dict__['confidence'].__set__
 
 
-@dataclass
+@dataclass(frozen=True, slots=True)
 class SystemState:
     """Represents the current state of the application system.
     
     Tracks pose control status, current control state, and error information.
+    Instances are immutable snapshots: the owner of the state publishes a new
+    one by replacing its reference, so readers on other threads always see a
+    consistent set of fields without locking. The elbow angle changes every
+    frame and is not part of the snapshot; ApplicationController keeps it as
+    last_valid_angle.
     """
     pose_control_enabled: bool = True
     current_control_state: ControlState = ControlState.NEUTRAL
-    last_valid_angle: Optional[float] = None
     error_count: int = 0
     
     def __post_init__(self):
@@ -72,9 +119,26 @@ class SystemState:
             raise TypeError("pose_control_enabled must be a boolean")
         if not isinstance(self.current_control_state, ControlState):
             raise TypeError("current_control_state must be a ControlState enum")
-        if self.last_valid_angle is not None and not isinstance(self.last_valid_angle, (int, float)):
-            raise TypeError("last_valid_angle must be a number or None")
         if not isinstance(self.error_count, int):
             raise TypeError("error_count must be an integer")
         if self.error_count < 0:
-            raise ValueError("error_count must be non-negative")
\ No newline at end of file
+            raise ValueError("error_count must be non-negative")
+    
+    @classmethod
+    def trusted(
+        cls,
+        pose_control_enabled: bool = True,
+        current_control_state: ControlState = ControlState.NEUTRAL,
+        error_count: int = 0
+    ) -> 'SystemState':
+        """Create a SystemState without validation, for internal state updates."""
+        state = _new_instance(cls)
+        _set_state_enabled(state, pose_control_enabled)
+        _set_state_control(state, current_control_state)
+        _set_state_errors(state, error_count)
+        return state
+
+
+_set_state_enabled = SystemState.__dict__['pose_control_enabled'].__set__
+_set_state_control = SystemState.__dict__['current_control_state'].__set__
+_set_state_errors = SystemState.__dict__['error_count'].__set__
@@ -0,0 +1,317 @@
+"""
+Fixed-size binary landmark records for the OpenCV Minecraft Controller.
+
+This module defines the one wire and disk format used for landmarks across
+processes, recordings and remote streaming. Each record is a versioned numpy
+structured dtype of fixed size: a header (magic, version, pose count, sequence
+number, timestamp, source ID, elbow angle, control state) followed by a float32
+(poses, landmarks, 4) array of x, y, z and visibility. Buffers and files of
+records are read zero-copy with np.frombuffer or np.memmap.
+"""
+
+import os
+from typing import Optional
+
+import numpy as np
+
+from .enums import ControlState
+
+
+RECORD_MAGIC = b'KLMR'
+RECORD_VERSION = 1
+NUM_POSE_LANDMARKS = 33
+LANDMARK_FIELDS = 4  # x, y, z, visibility
+
+NO_CONTROL_STATE = -1
+CONTROL_STATE_CODES = {
+    ControlState.NEUTRAL: 0,
+    ControlState.LEFT_CLICK: 1,
+    ControlState.RIGHT_CLICK: 2,
+}
+CODE_CONTROL_STATES = {code: state for state, code in CONTROL_STATE_CODES.items()}
+
+# Little-endian header, 40 bytes with every field naturally aligned
+_HEADER_FIELDS = [
+    ('magic', 'S4'),
+    ('version', '<u2'),
+    ('pose_count', '<u2'),
+    ('sequence', '<u8'),
+    ('timestamp', '<f8'),
+    ('source_id', '<u4'),
+    ('angle', '<f4'),
+    ('control_state', 'i1'),
+    ('reserved', 'V7'),
+]
+HEADER_SIZE = 40
+
+
+def landmark_record_dtype(max_poses: int = 1, num_landmarks: int = NUM_POSE_LANDMARKS) -> np.dtype:
+    """Build the record dtype for a given pose capacity.
+
+    Args:
+        max_poses: Number of pose slots in each record (0 for header-only records)
+        num_landmarks: Landmarks per pose
+
+    Returns:
+        Structured numpy dtype of fixed size
+
+    Raises:
+        ValueError: If max_poses or num_landmarks is negative or out of range
+    """
+    if not 0 <= max_poses <= 0xFFFF:
+        raise ValueError("max_poses must be between 0 and 65535")
+    if num_landmarks < 1:
+        raise ValueError("num_landmarks must be positive")
+
+    fields = list(_HEADER_FIELDS)
+    if max_poses:
+        fields.append(('landmarks', '<f4', (max_poses, num_landmarks, LANDMARK_FIELDS)))
+    return np.dtype(fields)
+
+
+def record_dtype_for_size(size: int, num_landmarks: int = NUM_POSE_LANDMARKS) -> np.dtype:
+    """Return the record dtype whose itemsize matches a received record length.
+
+    Args:
+        size: Record length in bytes
+        num_landmarks: Landmarks per pose
+
+    Returns:
+        Matching record dtype
+
+    Raises:
+        ValueError: If no pose capacity produces that size
+    """
+    pose_size = num_landmarks * LANDMARK_FIELDS * 4
+    if size < HEADER_SIZE or (size - HEADER_SIZE) % pose_size:
+        raise ValueError(f"invalid landmark record size {size}")
+    return landmark_record_dtype((size - HEADER_SIZE) // pose_size, num_landmarks)
+
+
+LANDMARK_RECORD_DTYPE = landmark_record_dtype()
+HEADER_ONLY_DTYPE = landmark_record_dtype(max_poses=0)
+
+
+def create_records(count: int, dtype: np.dtype = LANDMARK_RECORD_DTYPE) -> np.ndarray:
+    """Allocate zeroed records with magic and version filled in.
+
+    Args:
+        count: Number of records
+        dtype: Record dtype from landmark_record_dtype()
+
+    Returns:
+        Array of records with NaN angles and no control state
+    """
+    records = np.zeros(count, dtype=dtype)
+    records['magic'] = RECORD_MAGIC
+    records['version'] = RECORD_VERSION
+    records['angle'] = np.nan
+    records['control_state'] = NO_CONTROL_STATE
+    return records
+
+
+def pack_record(
+    record: np.ndarray,
+    sequence: int,
+    timestamp: float,
+    landmarks: Optional[np.ndarray] = None,
+    source_id: int = 0,
+    angle: Optional[float] = None,
+    control_state: Optional[ControlState] = None
+) -> np.ndarray:
+    """Fill a single record in place.
+
+    Args:
+        record: One element of an array from create_records() (e.g. records[i])
+        sequence: Frame sequence number
+        timestamp: Capture timestamp in seconds
+        landmarks: (K, 4) array for one pose or (P, K, 4) for several, None for no pose
+        source_id: Identifier of the camera or stream
+        angle: Elbow angle in degrees, None if not measured
+        control_state: Decided control state, None if no decision was made
+
+    Returns:
+        The record that was filled
+
+    Raises:
+        ValueError: If the landmarks do not fit the record
+    """
+    record['magic'] = RECORD_MAGIC
+    record['version'] = RECORD_VERSION
+    record['sequence'] = sequence
+    record['timestamp'] = timestamp
+    record['source_id'] = source_id
+    record['angle'] = np.nan if angle is None else angle
+    record['control_state'] = CONTROL_STATE_CODES.get(control_state, NO_CONTROL_STATE)
+
+    if landmarks is None:
+        record['pose_count'] = 0
+        return record
+
+    poses = np.asarray(landmarks, dtype=np.float32)
+    if poses.ndim == 2:
+        poses = poses[np.newaxis]
+
+    if 'landmarks' not in record.dtype.names:
+        raise ValueError("record has no landmark capacity")
+    capacity = record['landmarks'].shape
+    if poses.ndim != 3 or poses.shape[0] > capacity[0] or poses.shape[1:] != capacity[1:]:
+        raise ValueError(f"landmarks of shape {poses.shape} do not fit record capacity {capacity}")
+
+    record['pose_count'] = poses.shape[0]
+    record['landmarks'][:poses.shape[0]] = poses
+    return record
+
+
+def encode_record(
+    sequence: int,
+    timestamp: float,
+    landmarks: Optional[np.ndarray] = None,
+    source_id: int = 0,
+    angle: Optional[float] = None,
+    control_state: Optional[ControlState] = None,
+    dtype: np.dtype = LANDMARK_RECORD_DTYPE
+) -> bytes:
+    """Serialize one record to bytes.
+
+    Args:
+        sequence: Frame sequence number
+        timestamp: Capture timestamp in seconds
+        landmarks: (K, 4) or (P, K, 4) landmark array, None for no pose
+        source_id: Identifier of the camera or stream
+        angle: Elbow angle in degrees, None if not measured
+        control_state: Decided control state, None if no decision was made
+        dtype: Record dtype
+
+    Returns:
+        bytes: Exactly dtype.itemsize bytes
+    """
+    records = create_records(1, dtype)
+    pack_record(records[0], sequence, timestamp, landmarks, source_id, angle, control_state)
+    return records.tobytes()
+
+
+def decode_records(buffer, dtype: np.dtype = LANDMARK_RECORD_DTYPE) -> np.ndarray:
+    """View a buffer of records without copying.
+
+    Args:
+        buffer: bytes, bytearray, memoryview or mmap holding whole records
+        dtype: Record dtype
+
+    Returns:
+        Read-only (for bytes) array of records sharing memory with buffer
+
+    Raises:
+        ValueError: If the buffer is not a whole number of valid records
+    """
+    if len(buffer) % dtype.itemsize:
+        raise ValueError(f"buffer length {len(buffer)} is not a multiple of record size {dtype.itemsize}")
+    records = np.frombuffer(buffer, dtype=dtype)
+    validate_records(records)
+    return records
+
+
+def validate_records(records: np.ndarray) -> None:
+    """Check magic and version of every record.
+
+    Raises:
+        ValueError: If any record has the wrong magic or an unsupported version
+    """
+    if len(records) == 0:
+        return
+    if not np.all(records['magic'] == RECORD_MAGIC):
+        raise ValueError("buffer does not contain landmark records")
+    if not np.all(records['version'] == RECORD_VERSION):
+        raise ValueError(f"unsupported landmark record version (expected {RECORD_VERSION})")
+
+
+def record_landmarks(record: np.ndarray) -> Optional[np.ndarray]:
+    """Return the populated (P, K, 4) landmark view of a record, None if it has no pose."""
+    count = int(record['pose_count'])
+    if count == 0 or 'landmarks' not in record.dtype.names:
+        return None
+    return record['landmarks'][:count]
+
+
+def record_control_state(record: np.ndarray) -> Optional[ControlState]:
+    """Return the ControlState stored in a record, None if no decision was made."""
+    return CODE_CONTROL_STATES.get(int(record['control_state']))
+
+
+def record_angle(record: np.ndarray) -> Optional[float]:
+    """Return the elbow angle stored in a record, None if it was not measured."""
+    angle = float(record['angle'])
+    return None if np.isnan(angle) else angle
+
+
+class LandmarkRecordWriter:
+    """Appends fixed-size records to a file that open_record_file() can memory-map."""
+
+    def __init__(self, path: str, dtype: np.dtype = LANDMARK_RECORD_DTYPE):
+        """Open the file for appending.
+
+        Args:
+            path: Destination file path
+            dtype: Record dtype shared by every record in the file
+        """
+        self.path = path
+        self.dtype = dtype
+        self._file = open(path, 'ab')
+        self._count = 0
+
+    @property
+    def count(self) -> int:
+        """Return the number of records written by this writer."""
+        return self._count
+
+    def write(self, records: np.ndarray) -> None:
+        """Append one record or an array of records.
+
+        Raises:
+            ValueError: If the records use a different dtype
+        """
+        if records.dtype != self.dtype:
+            raise ValueError("records do not match the writer dtype")
+        self._file.write(records.tobytes())
+        self._count += records.size
+
+    def flush(self) -> None:
+        """Flush buffered records to disk."""
+        self._file.flush()
+
+    def close(self) -> None:
+        """Close the file."""
+        if not self._file.closed:
+            self._file.close()
+
+    def __enter__(self):
+        """Context manager entry."""
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        """Context manager exit - close the file."""
+        self.close()
+
+
+def open_record_file(path: str, dtype: np.dtype = LANDMARK_RECORD_DTYPE) -> np.ndarray:
+    """Memory-map a record file written by LandmarkRecordWriter.
+
+    Args:
+        path: Record file path
+        dtype: Record dtype used when writing
+
+    Returns:
+        Read-only memory-mapped array of records (empty array for an empty file)
+
+    Raises:
+        ValueError: If the file is not a whole number of valid records
+    """
+    size = os.path.getsize(path)
+    if size % dtype.itemsize:
+        raise ValueError(f"file size {size} is not a multiple of record size {dtype.itemsize}")
+    if size == 0:
+        return np.zeros(0, dtype=dtype)
+
+    records = np.memmap(path, dtype=dtype, mode='r')
+    validate_records(records)
+    return records
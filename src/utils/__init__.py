@@ -6,7 +6,34 @@ angle computation, configuration management, and other utilities.
 """
 
 from .angle_calculator import AngleCalculator
+from .clock import SystemClock, VirtualClock
+from .config_manager import ConfigWatcher, ControllerConfig, load_config
+from .flight_recorder import FlightRecorder, load_flight_dump
+from .frame_bus import FrameBus, FrameRef, FrameSubscription
+from .inference_scheduler import InferenceScheduler
+from .lens_correction import CameraCalibration, FrameUndistorter, KeypointUndistorter, load_calibration
+from .spsc_ring import SPSCRing
+from .thread_priority import ThreadPriority, apply_thread_role, configure_thread_priority
 
 __all__ = [
-    "AngleCalculator"
+    "AngleCalculator",
+    "CameraCalibration",
+    "ConfigWatcher",
+    "ControllerConfig",
+    "FlightRecorder",
+    "FrameBus",
+    "FrameRef",
+    "FrameSubscription",
+    "FrameUndistorter",
+    "InferenceScheduler",
+    "KeypointUndistorter",
+    "SPSCRing",
+    "SystemClock",
+    "ThreadPriority",
+    "VirtualClock",
+    "apply_thread_role",
+    "configure_thread_priority",
+    "load_calibration",
+    "load_config",
+    "load_flight_dump"
 ]
\ No newline at end of file
@@ -22,8 +22,25 @@ class AngleCalculator:
     LEFT_CLICK_THRESHOLD = 90.0   # Above this angle triggers left-click
     HYSTERESIS_MARGIN = 2.0       # Prevents rapid state changes
     
-    def __init__(self):
-        """Initialize the angle calculator."""
+    def __init__(
+        self,
+        right_click_threshold: Optional[float] = None,
+        left_click_threshold: Optional[float] = None,
+        hysteresis_margin: Optional[float] = None
+    ):
+        """Initialize the angle calculator.
+        
+        Args:
+            right_click_threshold: Angle below which right-click triggers (default: class constant)
+            left_click_threshold: Angle above which left-click triggers (default: class constant)
+            hysteresis_margin: Margin required to leave a click state (default: class constant)
+        """
+        if right_click_threshold is not None:
+            self.RIGHT_CLICK_THRESHOLD = float(right_click_threshold)
+        if left_click_threshold is not None:
+            self.LEFT_CLICK_THRESHOLD = float(left_click_threshold)
+        if hysteresis_margin is not None:
+            self.HYSTERESIS_MARGIN = float(hysteresis_margin)
         self._last_state: Optional[ControlState] = None
     
     @staticmethod
@@ -103,6 +120,26 @@ class AngleCalculator:
         self._last_state = new_state
         return new_state
     
+    def get_threshold_margin(self, angle: float) -> float:
+        """Get how far the angle can move before the control state changes.
+        
+        Uses the thresholds that apply to the last mapped state, so call it after
+        get_control_state() for the same angle.
+        
+        Args:
+            angle: Elbow angle in degrees
+            
+        Returns:
+            Degrees to the nearest threshold that would change the state (0 if on it)
+        """
+        if self._last_state == ControlState.RIGHT_CLICK:
+            margin = self.RIGHT_CLICK_THRESHOLD + self.HYSTERESIS_MARGIN - angle
+        elif self._last_state == ControlState.LEFT_CLICK:
+            margin = angle - (self.LEFT_CLICK_THRESHOLD - self.HYSTERESIS_MARGIN)
+        else:
+            margin = min(angle - self.RIGHT_CLICK_THRESHOLD, self.LEFT_CLICK_THRESHOLD - angle)
+        return max(margin, 0.0)
+    
     def is_angle_valid(self, angle: float) -> bool:
         """Check if the calculated angle is within valid range.
         
@@ -114,6 +151,22 @@ class AngleCalculator:
         """
         return 0.0 <= angle <= 180.0
     
+    def get_last_state(self) -> Optional[ControlState]:
+        """Get the last control state used for hysteresis.
+        
+        Returns:
+            The last control state, or None if no angle has been mapped yet
+        """
+        return self._last_state
+    
+    def set_last_state(self, state: Optional[ControlState]) -> None:
+        """Seed the hysteresis state, e.g. when replacing a calculator at runtime.
+        
+        Args:
+            state: Control state to continue from
+        """
+        self._last_state = state
+    
     def reset_state(self) -> None:
         """Reset the internal state tracking for hysteresis."""
         self._last_state = None
\ No newline at end of file
@@ -0,0 +1,103 @@
+"""
+Injectable clocks for the OpenCV Minecraft Controller.
+
+Timing features (FPS tracking, frozen-camera detection, configuration polling,
+flight recorder rate limits) read time through a clock object instead of
+calling the time module directly. SystemClock reads the real clocks;
+VirtualClock only moves when told to, so tests and replays can run hours of
+timing behaviour in seconds and get the same result every time. A
+ReplaySource given a VirtualClock advances it to each frame's media
+timestamp.
+
+Clocks are also callable and return now(), so one can be passed wherever a
+plain monotonic time function is expected (the clock= arguments of
+CameraManager, ConfigWatcher and FlightRecorder).
+"""
+
+import threading
+import time
+
+
+class SystemClock:
+    """Real time: monotonic now(), wall-clock wall() and a blocking sleep()."""
+
+    def now(self) -> float:
+        """Return monotonic time in seconds."""
+        return time.monotonic()
+
+    def wall(self) -> float:
+        """Return wall-clock time in seconds since the epoch."""
+        return time.time()
+
+    def sleep(self, seconds: float) -> None:
+        """Block the calling thread for the given seconds."""
+        if seconds > 0:
+            time.sleep(seconds)
+
+    def __call__(self) -> float:
+        """Return now() so the clock can be used as a time function."""
+        return self.now()
+
+
+class VirtualClock:
+    """Time that advances only through advance(), advance_to() and sleep()."""
+
+    def __init__(self, start: float = 0.0, wall_start: float = 0.0):
+        """Initialize the clock.
+
+        Args:
+            start: Initial monotonic time in seconds
+            wall_start: Wall-clock time corresponding to start
+        """
+        self._now = float(start)
+        self._wall_offset = float(wall_start) - float(start)
+        self._lock = threading.Lock()
+
+    def now(self) -> float:
+        """Return the current virtual monotonic time in seconds."""
+        return self._now
+
+    def wall(self) -> float:
+        """Return the current virtual wall-clock time in seconds."""
+        return self._now + self._wall_offset
+
+    def advance(self, seconds: float) -> float:
+        """Move the clock forward.
+
+        Args:
+            seconds: Non-negative amount to advance
+
+        Returns:
+            float: The new time
+
+        Raises:
+            ValueError: If seconds is negative
+        """
+        if seconds < 0:
+            raise ValueError("a virtual clock cannot move backwards")
+        with self._lock:
+            self._now += seconds
+            return self._now
+
+    def advance_to(self, timestamp: float) -> float:
+        """Move the clock forward to a timestamp; earlier timestamps leave it unchanged.
+
+        Args:
+            timestamp: Target monotonic time in seconds
+
+        Returns:
+            float: The new time
+        """
+        with self._lock:
+            if timestamp > self._now:
+                self._now = float(timestamp)
+            return self._now
+
+    def sleep(self, seconds: float) -> None:
+        """Advance the clock instead of blocking."""
+        if seconds > 0:
+            self.advance(seconds)
+
+    def __call__(self) -> float:
+        """Return now() so the clock can be used as a time function."""
+        return self._now
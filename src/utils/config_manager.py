@@ -0,0 +1,206 @@
+"""
+Runtime configuration for the OpenCV Minecraft Controller.
+
+This module defines the JSON configuration file layout and a watcher that
+detects changes to it, so settings can be applied between frames without
+restarting the camera or reloading the pose model.
+"""
+
+import json
+import logging
+import os
+import time
+from dataclasses import dataclass, field, fields
+from typing import Callable, List, Optional
+
+from .angle_calculator import AngleCalculator
+
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass(frozen=True)
+class AngleConfig:
+    """Angle thresholds and hysteresis used by AngleCalculator."""
+    right_click_threshold: float = AngleCalculator.RIGHT_CLICK_THRESHOLD
+    left_click_threshold: float = AngleCalculator.LEFT_CLICK_THRESHOLD
+    hysteresis_margin: float = AngleCalculator.HYSTERESIS_MARGIN
+
+    def __post_init__(self):
+        """Validate threshold values."""
+        for name in ('right_click_threshold', 'left_click_threshold', 'hysteresis_margin'):
+            if not isinstance(getattr(self, name), (int, float)) or isinstance(getattr(self, name), bool):
+                raise TypeError(f"{name} must be a number")
+        if not 0.0 <= self.right_click_threshold < self.left_click_threshold <= 180.0:
+            raise ValueError("thresholds must satisfy 0 <= right_click_threshold < left_click_threshold <= 180")
+        if self.hysteresis_margin < 0.0:
+            raise ValueError("hysteresis_margin must be non-negative")
+        if 2 * self.hysteresis_margin >= self.left_click_threshold - self.right_click_threshold:
+            raise ValueError("hysteresis_margin must be less than half the neutral band")
+
+
+@dataclass(frozen=True)
+class DisplayConfig:
+    """Overlay options used by DisplayManager."""
+    show_pose_overlay: bool = True
+    show_angle_info: bool = True
+    font_scale: float = 0.7
+
+    def __post_init__(self):
+        """Validate display options."""
+        if not isinstance(self.show_pose_overlay, bool):
+            raise TypeError("show_pose_overlay must be a boolean")
+        if not isinstance(self.show_angle_info, bool):
+            raise TypeError("show_angle_info must be a boolean")
+        if not isinstance(self.font_scale, (int, float)) or self.font_scale <= 0:
+            raise ValueError("font_scale must be a positive number")
+
+
+@dataclass(frozen=True)
+class ControllerConfig:
+    """Complete runtime configuration, one section per component."""
+    angle: AngleConfig = field(default_factory=AngleConfig)
+    display: DisplayConfig = field(default_factory=DisplayConfig)
+
+    SECTIONS = ('angle', 'display')
+
+    @classmethod
+    def from_dict(cls, data: dict) -> 'ControllerConfig':
+        """Build a configuration from parsed JSON.
+
+        Missing sections and keys fall back to their defaults.
+
+        Args:
+            data: Dictionary with optional 'angle' and 'display' sections
+
+        Returns:
+            Validated ControllerConfig
+
+        Raises:
+            TypeError: If a value has the wrong type
+            ValueError: If a section or key is unknown or a value is out of range
+        """
+        if not isinstance(data, dict):
+            raise ValueError("configuration must be a JSON object")
+
+        unknown = set(data) - set(cls.SECTIONS)
+        if unknown:
+            raise ValueError(f"unknown configuration sections: {sorted(unknown)}")
+
+        sections = {}
+        for name, section_type in (('angle', AngleConfig), ('display', DisplayConfig)):
+            values = data.get(name, {})
+            if not isinstance(values, dict):
+                raise ValueError(f"section '{name}' must be a JSON object")
+            allowed = {f.name for f in fields(section_type)}
+            unknown_keys = set(values) - allowed
+            if unknown_keys:
+                raise ValueError(f"unknown keys in '{name}': {sorted(unknown_keys)}")
+            sections[name] = section_type(**values)
+
+        return cls(**sections)
+
+    def changed_sections(self, other: 'ControllerConfig') -> List[str]:
+        """List the sections that differ from another configuration.
+
+        Args:
+            other: Configuration to compare against
+
+        Returns:
+            Names of the sections whose values differ
+        """
+        return [name for name in self.SECTIONS if getattr(self, name) != getattr(other, name)]
+
+
+def load_config(path: str) -> ControllerConfig:
+    """Load and validate a configuration file.
+
+    Args:
+        path: Path to a JSON configuration file
+
+    Returns:
+        Validated ControllerConfig
+
+    Raises:
+        OSError: If the file cannot be read
+        ValueError: If the file is not valid JSON or fails validation
+        TypeError: If a value has the wrong type
+    """
+    with open(path, 'r', encoding='utf-8') as config_file:
+        return ControllerConfig.from_dict(json.load(config_file))
+
+
+class ConfigWatcher:
+    """Watches a configuration file and reports validated changes.
+
+    poll() is cheap enough to call every frame: it only stats the file once per
+    check interval and only parses it when the modification time or size changed.
+    Invalid edits are logged and ignored so the last good configuration stays active.
+    """
+
+    def __init__(
+        self,
+        path: str,
+        check_interval: float = 0.5,
+        clock: Callable[[], float] = time.monotonic
+    ):
+        """Initialize the watcher and load the current configuration.
+
+        Args:
+            path: Path to the JSON configuration file
+            check_interval: Minimum seconds between file checks
+            clock: Monotonic time source in seconds
+
+        Raises:
+            OSError: If the file cannot be read
+            ValueError: If the initial configuration is invalid
+        """
+        self.path = path
+        self.check_interval = check_interval
+        self._clock = clock
+        self._last_check = clock()
+        self._signature = self._stat_signature()
+        self.config = load_config(path)
+        self._reload_count = 0
+
+    @property
+    def reload_count(self) -> int:
+        """Return the number of configuration changes applied since start."""
+        return self._reload_count
+
+    def poll(self) -> Optional[ControllerConfig]:
+        """Check the file for changes.
+
+        Returns:
+            The new configuration if the file changed and is valid, None otherwise
+        """
+        now = self._clock()
+        if now - self._last_check < self.check_interval:
+            return None
+        self._last_check = now
+
+        signature = self._stat_signature()
+        if signature is None or signature == self._signature:
+            return None
+        self._signature = signature
+
+        try:
+            new_config = load_config(self.path)
+        except (OSError, ValueError, TypeError) as e:
+            logger.error(f"Ignoring invalid configuration in {self.path}: {e}")
+            return None
+
+        if new_config == self.config:
+            return None
+
+        self.config = new_config
+        self._reload_count += 1
+        return new_config
+
+    def _stat_signature(self):
+        """Return (mtime_ns, size) of the watched file, or None if it is missing."""
+        try:
+            stat = os.stat(self.path)
+        except OSError:
+            return None
+        return (stat.st_mtime_ns, stat.st_size)
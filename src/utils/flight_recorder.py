@@ -0,0 +1,301 @@
+"""
+Flight recorder for the OpenCV Minecraft Controller.
+
+Keeps the last few seconds of the pipeline in a preallocated ring: downscaled
+frames, landmarks, elbow angles, control states and per-stage timings. Nothing
+is allocated per frame; each frame costs one resize into its ring slot plus a
+few scalar writes. A hotkey, a capture stall, an exception or a latency spike
+snapshots the ring and writes it to disk on a background thread, so a stray
+click in a real session can be inspected offline with load_flight_dump().
+The stall and latency spike triggers are armed only after a warm-up, since
+the first inference after loading the model is routinely that slow.
+Landmarks are stored in dumps with the delta landmark codec.
+"""
+
+import logging
+import os
+import threading
+import time
+from typing import Dict, Optional, Tuple
+
+import cv2
+import numpy as np
+
+from ..models.enums import ControlState
+from ..models.landmark_codec import decode_landmark_sequence, encode_landmark_sequence
+from ..models.landmark_record import HEADER_ONLY_DTYPE, create_records, pack_record
+from .thread_priority import ROLE_BACKGROUND, apply_thread_role
+
+
+logger = logging.getLogger(__name__)
+
+
+FLIGHT_STAGES = ('capture', 'inference', 'decision', 'display')
+
+
+class FlightRecorder:
+    """Fixed-memory ring buffer of recent frames and decisions, dumped on anomaly."""
+
+    def __init__(
+        self,
+        capacity: int = 300,
+        thumbnail_size: Tuple[int, int] = (160, 120),
+        output_dir: str = 'flight_records',
+        stall_threshold: float = 0.5,
+        latency_spike_ms: float = 250.0,
+        min_dump_interval: float = 5.0,
+        warmup_frames: int = 30,
+        clock=time.monotonic
+    ):
+        """Preallocate the ring.
+
+        Args:
+            capacity: Number of frames kept (seconds of history times FPS)
+            thumbnail_size: (width, height) of the stored downscaled frames
+            output_dir: Directory receiving dump files
+            stall_threshold: Gap between recorded frames, in seconds, that triggers a dump
+            latency_spike_ms: Summed stage time of one frame that triggers a dump
+            min_dump_interval: Minimum seconds between automatic dumps
+            warmup_frames: Frames recorded before the stall and latency spike
+                triggers are armed
+            clock: Monotonic time source in seconds
+
+        Raises:
+            ValueError: If capacity, thumbnail size or thresholds are not positive,
+                or warmup_frames is negative
+        """
+        if capacity < 1:
+            raise ValueError("capacity must be positive")
+        if len(thumbnail_size) != 2 or min(thumbnail_size) < 1:
+            raise ValueError("thumbnail_size must be a positive (width, height)")
+        if stall_threshold <= 0 or latency_spike_ms <= 0:
+            raise ValueError("stall_threshold and latency_spike_ms must be positive")
+        if warmup_frames < 0:
+            raise ValueError("warmup_frames must not be negative")
+
+        self.capacity = capacity
+        self.thumbnail_size = (int(thumbnail_size[0]), int(thumbnail_size[1]))
+        self.output_dir = output_dir
+        self.stall_threshold = stall_threshold
+        self.latency_spike_ms = latency_spike_ms
+        self.min_dump_interval = min_dump_interval
+        self.warmup_frames = warmup_frames
+        self._clock = clock
+
+        width, height = self.thumbnail_size
+        self._thumbnails = np.zeros((capacity, height, width, 3), dtype=np.uint8)
+        self._records = create_records(capacity)
+        self._timings_ms = np.zeros((capacity, len(FLIGHT_STAGES)), dtype=np.float32)
+
+        self._lock = threading.Lock()
+        self._count = 0
+        self._last_timestamp: Optional[float] = None
+        self._last_dump_time: Optional[float] = None
+        self._dump_thread: Optional[threading.Thread] = None
+        self._dump_count = 0
+        self._failed_dumps = 0
+        self._last_dump_path: Optional[str] = None
+
+    @classmethod
+    def for_duration(cls, seconds: float, fps: float = 30.0, **kwargs) -> 'FlightRecorder':
+        """Create a recorder holding roughly the given seconds of history at fps."""
+        return cls(capacity=max(1, int(round(seconds * fps))), **kwargs)
+
+    @property
+    def memory_bytes(self) -> int:
+        """Return the fixed memory held by the ring buffers."""
+        return self._thumbnails.nbytes + self._records.nbytes + self._timings_ms.nbytes
+
+    @property
+    def frame_count(self) -> int:
+        """Return the total number of frames recorded."""
+        return self._count
+
+    @property
+    def dump_count(self) -> int:
+        """Return the number of dumps triggered, including failed ones."""
+        return self._dump_count
+
+    @property
+    def failed_dumps(self) -> int:
+        """Return the number of dumps that could not be written."""
+        return self._failed_dumps
+
+    @property
+    def last_dump_path(self) -> Optional[str]:
+        """Return the path of the most recent dump written, None if none was."""
+        return self._last_dump_path
+
+    def record(
+        self,
+        frame: np.ndarray,
+        landmarks: Optional[np.ndarray] = None,
+        angle: Optional[float] = None,
+        control_state: Optional[ControlState] = None,
+        timings_ms: Optional[Dict[str, float]] = None
+    ) -> Optional[str]:
+        """Write one frame into the ring and, after the warm-up, check for stalls
+        and latency spikes.
+
+        Args:
+            frame: BGR frame, resized into the ring slot
+            landmarks: (33, 4) landmark array, None if no pose was detected
+            angle: Elbow angle in degrees, None if not measured
+            control_state: Control state decided for the frame
+            timings_ms: Milliseconds spent per stage, keyed by FLIGHT_STAGES names
+
+        Returns:
+            Reason of an automatic dump triggered by this frame, None otherwise
+        """
+        now = self._clock()
+
+        with self._lock:
+            slot = self._count % self.capacity
+            cv2.resize(frame, self.thumbnail_size, dst=self._thumbnails[slot], interpolation=cv2.INTER_NEAREST)
+            pack_record(self._records[slot], self._count, now, landmarks, angle=angle, control_state=control_state)
+            timings = self._timings_ms[slot]
+            timings[:] = 0.0
+            if timings_ms:
+                for index, stage in enumerate(FLIGHT_STAGES):
+                    timings[index] = timings_ms.get(stage, 0.0)
+            self._count += 1
+            total_ms = float(timings.sum())
+
+        previous = self._last_timestamp
+        self._last_timestamp = now
+
+        if self._count <= self.warmup_frames:
+            return None
+        if previous is not None and now - previous > self.stall_threshold:
+            return 'stall' if self.report_anomaly('stall') else None
+        if total_ms > self.latency_spike_ms:
+            return 'latency_spike' if self.report_anomaly('latency_spike') else None
+        return None
+
+    def trigger(self, reason: str) -> bool:
+        """Snapshot the ring and write it to disk on a background thread.
+
+        Args:
+            reason: Short label stored in the dump and its file name
+
+        Returns:
+            bool: True if a dump was started, False if the ring is empty or a dump is in progress
+        """
+        if self._count == 0:
+            return False
+        if self._dump_thread is not None and self._dump_thread.is_alive():
+            logger.debug(f"Flight recorder dump in progress, skipping '{reason}'")
+            return False
+
+        with self._lock:
+            order = np.arange(self._count - min(self._count, self.capacity), self._count) % self.capacity
+            snapshot = {
+                'thumbnails': self._thumbnails[order],
+                'records': self._records[order],
+                'timings_ms': self._timings_ms[order],
+            }
+
+        self._last_dump_time = self._clock()
+        self._dump_count += 1
+        filename = f"flight_{time.strftime('%Y%m%d-%H%M%S')}_{self._dump_count:03d}_{reason}.npz"
+        path = os.path.join(self.output_dir, filename)
+
+        self._dump_thread = threading.Thread(
+            target=self._write_dump,
+            args=(path, reason, snapshot),
+            name='flight-recorder-dump',
+            daemon=True
+        )
+        self._dump_thread.start()
+        logger.warning(f"Flight recorder dump triggered ({reason}): {path}")
+        return True
+
+    def wait_for_dump(self, timeout: Optional[float] = None) -> bool:
+        """Wait for an in-progress dump to finish.
+
+        Returns:
+            bool: True if no dump is still running
+        """
+        if self._dump_thread is not None:
+            self._dump_thread.join(timeout)
+            return not self._dump_thread.is_alive()
+        return True
+
+    def close(self, timeout: float = 5.0) -> None:
+        """Wait for a pending dump so it is not lost at shutdown."""
+        if not self.wait_for_dump(timeout):
+            logger.error("Flight recorder dump did not finish before shutdown")
+
+    def report_anomaly(self, reason: str) -> bool:
+        """Trigger a dump unless one was triggered within min_dump_interval.
+
+        Used for automatic triggers so a persistent fault does not write a dump
+        per frame; trigger() is for explicit requests such as the hotkey.
+
+        Returns:
+            bool: True if a dump was started
+        """
+        if self._last_dump_time is not None and self._clock() - self._last_dump_time < self.min_dump_interval:
+            return False
+        return self.trigger(reason)
+
+    def _write_dump(self, path: str, reason: str, snapshot: dict) -> None:
+        """Write a snapshot to an .npz file, with landmarks delta encoded.
+
+        last_dump_path moves to the file only once it is complete; a failed
+        dump is counted and its partial file removed.
+        """
+        apply_thread_role(ROLE_BACKGROUND)
+        try:
+            records = snapshot.pop('records')
+            headers = create_records(len(records), HEADER_ONLY_DTYPE)
+            for name in HEADER_ONLY_DTYPE.names:
+                headers[name] = records[name]
+            encoded = encode_landmark_sequence(records['landmarks'][:, 0], records['pose_count'] > 0)
+
+            os.makedirs(self.output_dir, exist_ok=True)
+            np.savez(
+                path,
+                reason=np.array(reason),
+                stages=np.array(FLIGHT_STAGES),
+                headers=headers,
+                landmarks_encoded=np.frombuffer(encoded, dtype=np.uint8),
+                **snapshot
+            )
+        except Exception as e:
+            # Runs on its own thread, so an error would otherwise be lost
+            logger.error(f"Failed to write flight recorder dump {path}: {e}")
+            self._failed_dumps += 1
+            try:
+                os.remove(path)
+            except OSError:
+                pass
+            return
+        self._last_dump_path = path
+
+
+def load_flight_dump(path: str) -> dict:
+    """Load a dump written by FlightRecorder.
+
+    Args:
+        path: Dump file path
+
+    Returns:
+        dict: reason, stages, thumbnails (N, H, W, 3), records (landmark records,
+              oldest first) and timings_ms (N, stages)
+    """
+    with np.load(path, allow_pickle=False) as dump:
+        headers = dump['headers']
+        landmarks, present = decode_landmark_sequence(dump['landmarks_encoded'].tobytes())
+        records = create_records(len(headers))
+        for name in HEADER_ONLY_DTYPE.names:
+            records[name] = headers[name]
+        records['landmarks'][present, 0] = landmarks[present]
+
+        return {
+            'reason': str(dump['reason']),
+            'stages': tuple(str(stage) for stage in dump['stages']),
+            'thumbnails': dump['thumbnails'],
+            'records': records,
+            'timings_ms': dump['timings_ms'],
+        }
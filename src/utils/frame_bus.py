@@ -0,0 +1,353 @@
+"""
+Reference-counted frame fan-out for the OpenCV Minecraft Controller.
+
+Several consumers can want the same captured frame: the detector, the
+display, a recorder, a preview stream. Handing each one its own frame.copy()
+costs a full-frame allocation and copy per consumer per frame. FrameBus
+instead keeps a pool of preallocated frame buffers. The capture stage writes
+each frame into one buffer, either in place (claim() / commit(), e.g.
+cv2.VideoCapture.read(image=...)) or with one copy (publish()), and every
+subscriber receives a reference to that same buffer.
+
+Each subscriber has its own rate limit and queue:
+
+- max_fps: frames arriving sooner than 1 / max_fps after the last frame the
+  subscriber accepted are skipped for it
+- depth and drop policy: when its queue already holds depth frames, policy
+  'oldest' drops the oldest queued frame for the new one (the freshest frame
+  wins) and 'newest' drops the new frame (frames already queued are kept)
+
+A buffer is shared read-only and returns to the pool when its last reference
+is released: a FrameRef is released explicitly or by leaving a with block,
+and dropped frames are released by the bus. Adding a subscriber therefore
+adds a reference, not a copy. A consumer that holds many references starves
+the pool; publish() then drops the frame and counts it as pool_exhausted.
+
+One thread publishes (the capture stage); subscribers may get() and release
+on any thread.
+"""
+
+import logging
+import threading
+import time
+from collections import deque
+from typing import List, Optional, Sequence
+
+import numpy as np
+
+
+logger = logging.getLogger(__name__)
+
+
+DROP_POLICIES = ('oldest', 'newest')
+
+
+class _PooledBuffer:
+    """One pool slot: a writable frame, its read-only view and a reference count."""
+
+    __slots__ = ('array', 'view', 'refs', 'generation')
+
+    def __init__(self, shape: Sequence[int], dtype, generation: int):
+        self.array = np.empty(shape, dtype=dtype)
+        self.view = self.array.view()
+        self.view.flags.writeable = False
+        self.refs = 0
+        self.generation = generation
+
+
+class FrameRef:
+    """A subscriber's reference to a published frame; release it when done."""
+
+    __slots__ = ('frame', 'sequence', 'timestamp', '_buffer', '_bus')
+
+    def __init__(self, bus: 'FrameBus', buffer: _PooledBuffer, sequence: int, timestamp: float):
+        self.frame = buffer.view
+        self.sequence = sequence
+        self.timestamp = timestamp
+        self._buffer = buffer
+        self._bus = bus
+
+    def release(self) -> None:
+        """Drop this reference; the frame must not be used afterwards. Idempotent."""
+        if self._buffer is not None:
+            buffer, self._buffer = self._buffer, None
+            self.frame = None
+            self._bus._release(buffer)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.release()
+
+
+class FrameSubscription:
+    """A consumer's queue of frame references, filled by FrameBus.publish()."""
+
+    def __init__(self, bus: 'FrameBus', name: str, max_fps: Optional[float], depth: int, policy: str):
+        self.name = name
+        self.max_fps = max_fps
+        self.depth = depth
+        self.policy = policy
+
+        self._bus = bus
+        self._min_interval = 1.0 / max_fps if max_fps else 0.0
+        self._last_accepted: Optional[float] = None
+        self._queue: deque = deque()
+        self._ready = threading.Condition()
+        self._closed = False
+
+        self._delivered = 0
+        self._dropped = 0
+        self._rate_skipped = 0
+
+    def get(self, timeout: Optional[float] = 0.0) -> Optional[FrameRef]:
+        """Take the next queued frame.
+
+        Args:
+            timeout: Seconds to wait for a frame; 0 returns at once, None waits
+
+        Returns:
+            FrameRef the caller must release, or None if no frame arrived or the
+            subscription is closed
+        """
+        with self._ready:
+            if not self._queue and timeout != 0.0 and not self._closed:
+                self._ready.wait_for(lambda: self._queue or self._closed, timeout)
+            if not self._queue:
+                return None
+            return self._queue.popleft()
+
+    def close(self) -> None:
+        """Unsubscribe and release every queued frame."""
+        self._bus._unsubscribe(self)
+        with self._ready:
+            self._closed = True
+            pending, self._queue = list(self._queue), deque()
+            self._ready.notify_all()
+        for ref in pending:
+            ref.release()
+
+    def get_stats(self) -> dict:
+        """Get delivery counters.
+
+        Returns:
+            dict: frames delivered, dropped by the queue policy, skipped by the
+            rate limit, and currently queued
+        """
+        with self._ready:
+            return {
+                'delivered': self._delivered,
+                'dropped': self._dropped,
+                'rate_skipped': self._rate_skipped,
+                'queued': len(self._queue),
+            }
+
+    def _offer(self, buffer: _PooledBuffer, sequence: int, timestamp: float) -> None:
+        """Queue a reference to a published frame if the rate limit and policy allow."""
+        if self._last_accepted is not None and timestamp - self._last_accepted < self._min_interval:
+            self._rate_skipped += 1
+            return
+
+        evicted = None
+        with self._ready:
+            if self._closed:
+                return
+            if len(self._queue) >= self.depth:
+                self._dropped += 1
+                if self.policy == 'newest':
+                    return
+                evicted = self._queue.popleft()
+            self._queue.append(FrameRef(self._bus, self._bus._retain(buffer), sequence, timestamp))
+            self._last_accepted = timestamp
+            self._delivered += 1
+            self._ready.notify()
+        if evicted is not None:
+            evicted.release()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        self.close()
+
+
+class FrameBus:
+    """Publishes pooled frame buffers to any number of subscribers without copying."""
+
+    def __init__(self, pool_size: int = 8):
+        """Initialize the bus; buffers are allocated for the first frame's shape.
+
+        Args:
+            pool_size: Frame buffers in the pool; it bounds the frames held by
+                all subscribers together, plus one being written
+
+        Raises:
+            ValueError: If pool_size is less than 2
+        """
+        if pool_size < 2:
+            raise ValueError("pool_size must be at least 2")
+
+        self.pool_size = pool_size
+
+        self._lock = threading.Lock()
+        self._subscriptions: List[FrameSubscription] = []
+        self._free: List[_PooledBuffer] = []
+        self._shape: Optional[tuple] = None
+        self._dtype: Optional[np.dtype] = None
+        self._generation = 0
+        self._claimed: Optional[_PooledBuffer] = None
+        self._sequence = 0
+        self._pool_exhausted = 0
+
+    def subscribe(self, name: str, max_fps: Optional[float] = None, depth: int = 1,
+                  policy: str = 'oldest') -> FrameSubscription:
+        """Subscribe a consumer.
+
+        Args:
+            name: Consumer name for statistics
+            max_fps: Highest frame rate delivered to this consumer (None: every frame)
+            depth: Frames queued for this consumer before the policy drops one
+            policy: 'oldest' or 'newest', the frame dropped when the queue is full
+
+        Returns:
+            FrameSubscription to get() frames from and close() when done
+
+        Raises:
+            ValueError: If max_fps, depth or policy is invalid
+        """
+        if max_fps is not None and max_fps <= 0:
+            raise ValueError("max_fps must be positive")
+        if depth < 1:
+            raise ValueError("depth must be positive")
+        if policy not in DROP_POLICIES:
+            raise ValueError(f"policy must be one of {DROP_POLICIES}")
+
+        subscription = FrameSubscription(self, name, max_fps, depth, policy)
+        with self._lock:
+            self._subscriptions = self._subscriptions + [subscription]
+        logger.debug(f"Frame bus subscriber {name} added (max_fps={max_fps}, depth={depth}, policy={policy})")
+        return subscription
+
+    def has_subscribers(self) -> bool:
+        """Check whether publishing a frame would deliver it anywhere."""
+        return bool(self._subscriptions)
+
+    def claim(self, shape: Sequence[int], dtype=np.uint8) -> Optional[np.ndarray]:
+        """Take a free buffer for the producer to write the next frame into.
+
+        Args:
+            shape: Frame shape; a new shape or dtype replaces the pool
+            dtype: Frame dtype
+
+        Returns:
+            Writable buffer to fill and then commit(), or None if the pool is exhausted
+        """
+        with self._lock:
+            if self._claimed is not None:
+                return self._claimed.array
+            buffer = self._acquire(tuple(shape), np.dtype(dtype))
+            if buffer is None:
+                self._pool_exhausted += 1
+                return None
+            self._claimed = buffer
+            return buffer.array
+
+    def commit(self, timestamp: Optional[float] = None) -> int:
+        """Publish the claimed buffer to every subscriber.
+
+        Args:
+            timestamp: Capture time in seconds (default: time.perf_counter())
+
+        Returns:
+            int: Sequence number of the frame
+
+        Raises:
+            RuntimeError: If no buffer is claimed
+        """
+        with self._lock:
+            buffer, self._claimed = self._claimed, None
+        if buffer is None:
+            raise RuntimeError("commit() without claim()")
+        return self._deliver(buffer, time.perf_counter() if timestamp is None else timestamp)
+
+    def publish(self, frame: np.ndarray, timestamp: Optional[float] = None) -> Optional[int]:
+        """Copy a frame into a pooled buffer and publish it.
+
+        Nothing is copied while there are no subscribers.
+
+        Args:
+            frame: Frame to publish; the caller keeps ownership
+            timestamp: Capture time in seconds (default: time.perf_counter())
+
+        Returns:
+            Sequence number of the frame, or None if nobody is subscribed or the
+            pool is exhausted
+        """
+        if not self._subscriptions:
+            return None
+        buffer = self.claim(frame.shape, frame.dtype)
+        if buffer is None:
+            return None
+        np.copyto(buffer, frame)
+        return self.commit(timestamp)
+
+    def get_stats(self) -> dict:
+        """Get pool and per-subscriber counters.
+
+        Returns:
+            dict: frames published, frames dropped because the pool was exhausted,
+            pool size, free buffers, and each subscriber's statistics by name
+        """
+        with self._lock:
+            subscriptions = list(self._subscriptions)
+            stats = {
+                'published': self._sequence,
+                'pool_exhausted': self._pool_exhausted,
+                'pool_size': self.pool_size,
+                'free_buffers': len(self._free),
+            }
+        stats['subscribers'] = {subscription.name: subscription.get_stats() for subscription in subscriptions}
+        return stats
+
+    def _acquire(self, shape: tuple, dtype: np.dtype) -> Optional[_PooledBuffer]:
+        """Take a free buffer, replacing the pool on a new frame format; holds the lock."""
+        if shape != self._shape or dtype != self._dtype:
+            # Buffers of the old format still referenced are discarded on release
+            self._generation += 1
+            self._shape, self._dtype = shape, dtype
+            self._free = [_PooledBuffer(shape, dtype, self._generation) for _ in range(self.pool_size)]
+            logger.debug(f"Frame bus pool allocated: {self.pool_size} x {shape} {dtype}")
+        if not self._free:
+            return None
+        buffer = self._free.pop()
+        buffer.refs = 1
+        return buffer
+
+    def _deliver(self, buffer: _PooledBuffer, timestamp: float) -> int:
+        """Offer a filled buffer to every subscriber, then drop the bus's own reference."""
+        with self._lock:
+            sequence = self._sequence
+            self._sequence += 1
+        for subscription in self._subscriptions:
+            subscription._offer(buffer, sequence, timestamp)
+        self._release(buffer)
+        return sequence
+
+    def _retain(self, buffer: _PooledBuffer) -> _PooledBuffer:
+        """Add a reference to a buffer."""
+        with self._lock:
+            buffer.refs += 1
+        return buffer
+
+    def _release(self, buffer: _PooledBuffer) -> None:
+        """Drop a reference; the last one returns the buffer to the pool."""
+        with self._lock:
+            buffer.refs -= 1
+            if buffer.refs == 0 and buffer.generation == self._generation:
+                self._free.append(buffer)
+
+    def _unsubscribe(self, subscription: FrameSubscription) -> None:
+        """Stop offering frames to a subscription."""
+        with self._lock:
+            self._subscriptions = [other for other in self._subscriptions if other is not subscription]
@@ -0,0 +1,128 @@
+"""
+Decision-aware inference scheduling for the OpenCV Minecraft Controller.
+
+Running pose inference on every frame only matters while the control state
+could change. When the elbow angle sits far from every threshold (deep in the
+neutral band, or well past a click threshold) and barely moves, the next few
+frames cannot plausibly produce a different state, so inference can wait.
+
+After each inference, InferenceScheduler takes the angle's margin to the
+nearest state-changing threshold (AngleCalculator.get_threshold_margin) and
+the recent angular velocity, and estimates how long the angle would need to
+cover that margin if it moved safety_factor times faster than it does now,
+or at least at idle_speed from rest. The next inference is due after that
+time, at most max_interval later. Frames before then reuse the last decision.
+
+The cost is decision latency: a movement starting right after an inference
+is seen up to one interval late. benchmarks/inference_schedule_benchmark.py
+reports the inference rate saved and this added latency.
+"""
+
+from typing import Optional
+
+
+class InferenceScheduler:
+    """Decides whether a frame needs pose inference from the current decision margin."""
+
+    def __init__(
+        self,
+        max_interval: float = 0.2,
+        safety_factor: float = 2.0,
+        idle_speed: float = 120.0,
+        velocity_smoothing: float = 0.5
+    ):
+        """Initialize the scheduler.
+
+        Args:
+            max_interval: Longest time in seconds between inferences
+            safety_factor: Multiple of the measured angular speed assumed when
+                predicting how soon a threshold can be reached
+            idle_speed: Angular speed in degrees per second a still arm is assumed
+                able to reach, so a resting arm is still checked regularly
+            velocity_smoothing: Weight of the newest velocity measurement (0-1]
+
+        Raises:
+            ValueError: If a parameter is out of range
+        """
+        if max_interval < 0:
+            raise ValueError("max_interval must not be negative")
+        if safety_factor < 1.0:
+            raise ValueError("safety_factor must be at least 1")
+        if idle_speed <= 0:
+            raise ValueError("idle_speed must be positive")
+        if not 0.0 < velocity_smoothing <= 1.0:
+            raise ValueError("velocity_smoothing must be in (0, 1]")
+
+        self.max_interval = max_interval
+        self.safety_factor = safety_factor
+        self.idle_speed = idle_speed
+        self.velocity_smoothing = velocity_smoothing
+
+        self._last_time: Optional[float] = None
+        self._last_angle = 0.0
+        self._velocity = 0.0
+        self._next_inference = 0.0
+        self._frames = 0
+        self._inferences = 0
+
+    def should_infer(self, now: float) -> bool:
+        """Check whether the frame at time now needs inference; counts the frame.
+
+        Args:
+            now: Frame time in seconds (monotonic)
+
+        Returns:
+            bool: True to run inference, False to reuse the last decision
+        """
+        self._frames += 1
+        if now >= self._next_inference:
+            self._inferences += 1
+            return True
+        return False
+
+    def record(self, now: float, angle: float, margin: float) -> float:
+        """Schedule the next inference from a fresh measurement.
+
+        Args:
+            now: Time of the inferred frame in seconds
+            angle: Measured elbow angle in degrees
+            margin: Degrees to the nearest threshold that would change the state
+
+        Returns:
+            float: Seconds until the next inference is due
+        """
+        if self._last_time is not None and now > self._last_time:
+            velocity = (angle - self._last_angle) / (now - self._last_time)
+            self._velocity += self.velocity_smoothing * (velocity - self._velocity)
+        self._last_time = now
+        self._last_angle = angle
+
+        speed = abs(self._velocity) * self.safety_factor + self.idle_speed
+        interval = min(margin / speed, self.max_interval)
+        self._next_inference = now + interval
+        return interval
+
+    def invalidate(self) -> None:
+        """Require inference on the next frame and forget the motion history.
+
+        Call when no angle was measured (no pose, invalid keypoints) or when the
+        thresholds or control state changed outside the schedule.
+        """
+        self._last_time = None
+        self._velocity = 0.0
+        self._next_inference = 0.0
+
+    def get_stats(self) -> dict:
+        """Get scheduling counters.
+
+        Returns:
+            dict: frames seen, inferences run, skipped frames, inference rate
+            (inferences per frame) and the current angular velocity estimate
+        """
+        return {
+            'frames': self._frames,
+            'inferences': self._inferences,
+            'skipped': self._frames - self._inferences,
+            'inference_rate': self._inferences / self._frames if self._frames else 1.0,
+            'velocity_dps': self._velocity,
+        }
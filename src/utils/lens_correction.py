@@ -0,0 +1,250 @@
+"""
+Lens distortion correction for the OpenCV Minecraft Controller.
+
+Wide-angle webcams bend straight lines near the frame edges, so an extended
+arm at the side of the image measures as bent. A checkerboard calibration
+(calibrate_camera.py) stores the camera intrinsics as JSON; two correction
+strategies use them:
+
+- FrameUndistorter remaps whole frames with maps computed once by
+  cv2.initUndistortRectifyMap into preallocated buffers, so pose detection and
+  the display see a rectified image.
+- KeypointUndistorter leaves the frame alone and undistorts only the three
+  arm keypoints with cv2.undistortPoints before the elbow angle is computed,
+  which costs microseconds instead of a full-frame remap.
+"""
+
+import json
+import logging
+from dataclasses import dataclass
+from typing import List, Optional, Sequence, Tuple
+
+import cv2
+import numpy as np
+
+from ..models.data_models import ArmKeypoints, Point
+
+
+logger = logging.getLogger(__name__)
+
+
+UNDISTORT_MODES = ('frame', 'keypoints')
+MIN_CALIBRATION_VIEWS = 5
+
+
+@dataclass
+class CameraCalibration:
+    """Camera intrinsics and distortion coefficients for one image size."""
+    camera_matrix: np.ndarray
+    dist_coeffs: np.ndarray
+    image_size: Tuple[int, int]
+    rms_error: float = 0.0
+
+    def scaled_to(self, image_size: Tuple[int, int]) -> 'CameraCalibration':
+        """Return the calibration for frames of another resolution.
+
+        Focal lengths and the principal point scale with the image; distortion
+        coefficients are resolution independent.
+
+        Args:
+            image_size: Target (width, height)
+
+        Returns:
+            CameraCalibration for the target size (self if it already matches)
+        """
+        if tuple(image_size) == tuple(self.image_size):
+            return self
+        scale_x = image_size[0] / self.image_size[0]
+        scale_y = image_size[1] / self.image_size[1]
+        camera_matrix = self.camera_matrix.copy()
+        camera_matrix[0, :] *= scale_x
+        camera_matrix[1, :] *= scale_y
+        return CameraCalibration(camera_matrix, self.dist_coeffs.copy(), tuple(image_size), self.rms_error)
+
+
+def save_calibration(path: str, calibration: CameraCalibration) -> None:
+    """Write a calibration to a JSON file.
+
+    Raises:
+        OSError: If the file cannot be written
+    """
+    data = {
+        'image_size': list(calibration.image_size),
+        'camera_matrix': calibration.camera_matrix.tolist(),
+        'dist_coeffs': calibration.dist_coeffs.ravel().tolist(),
+        'rms_error': calibration.rms_error,
+    }
+    with open(path, 'w', encoding='utf-8') as calibration_file:
+        json.dump(data, calibration_file, indent=2)
+
+
+def load_calibration(path: str) -> CameraCalibration:
+    """Load a calibration written by save_calibration().
+
+    Raises:
+        OSError: If the file cannot be read
+        ValueError: If the file is malformed
+    """
+    with open(path, 'r', encoding='utf-8') as calibration_file:
+        data = json.load(calibration_file)
+    try:
+        camera_matrix = np.array(data['camera_matrix'], dtype=np.float64)
+        dist_coeffs = np.array(data['dist_coeffs'], dtype=np.float64).reshape(1, -1)
+        width, height = (int(value) for value in data['image_size'])
+    except (KeyError, TypeError) as e:
+        raise ValueError(f"invalid calibration file {path}: {e}") from None
+    if camera_matrix.shape != (3, 3) or dist_coeffs.size not in (4, 5, 8, 12, 14):
+        raise ValueError(f"invalid calibration file {path}: unexpected matrix shapes")
+    if width < 1 or height < 1:
+        raise ValueError(f"invalid calibration file {path}: bad image size")
+    return CameraCalibration(camera_matrix, dist_coeffs, (width, height), float(data.get('rms_error', 0.0)))
+
+
+def find_checkerboard_corners(frame: np.ndarray, pattern_size: Tuple[int, int]) -> Optional[np.ndarray]:
+    """Locate the inner corners of a checkerboard with sub-pixel accuracy.
+
+    Args:
+        frame: BGR or grayscale image
+        pattern_size: Inner corners as (columns, rows), e.g. (9, 6)
+
+    Returns:
+        (N, 1, 2) float32 corner array, None if the board was not found
+    """
+    gray = cv2.cvtColor(frame, cv2.COLOR_BGR2GRAY) if frame.ndim == 3 else frame
+    found, corners = cv2.findChessboardCorners(
+        gray, pattern_size, flags=cv2.CALIB_CB_ADAPTIVE_THRESH | cv2.CALIB_CB_NORMALIZE_IMAGE
+    )
+    if not found:
+        return None
+    criteria = (cv2.TERM_CRITERIA_EPS + cv2.TERM_CRITERIA_MAX_ITER, 30, 0.001)
+    return cv2.cornerSubPix(gray, corners, (11, 11), (-1, -1), criteria).reshape(-1, 1, 2)
+
+
+def calibrate_camera(
+    corner_sets: Sequence[np.ndarray],
+    pattern_size: Tuple[int, int],
+    image_size: Tuple[int, int],
+    square_size: float = 1.0
+) -> CameraCalibration:
+    """Estimate intrinsics from checkerboard corners seen in several views.
+
+    Args:
+        corner_sets: Corner arrays from find_checkerboard_corners(), one per view
+        pattern_size: Inner corners as (columns, rows)
+        image_size: (width, height) of the calibration images
+        square_size: Checkerboard square size (units do not affect the intrinsics)
+
+    Returns:
+        CameraCalibration with the RMS reprojection error in pixels
+
+    Raises:
+        ValueError: If fewer than MIN_CALIBRATION_VIEWS views are given
+    """
+    if len(corner_sets) < MIN_CALIBRATION_VIEWS:
+        raise ValueError(f"at least {MIN_CALIBRATION_VIEWS} checkerboard views are required")
+
+    board = np.zeros((pattern_size[0] * pattern_size[1], 3), dtype=np.float32)
+    board[:, :2] = np.mgrid[0:pattern_size[0], 0:pattern_size[1]].T.reshape(-1, 2) * square_size
+    object_points: List[np.ndarray] = [board] * len(corner_sets)
+
+    rms, camera_matrix, dist_coeffs, _, _ = cv2.calibrateCamera(
+        object_points, [np.asarray(corners, dtype=np.float32) for corners in corner_sets],
+        tuple(image_size), None, None
+    )
+    return CameraCalibration(camera_matrix, dist_coeffs.reshape(1, -1), tuple(image_size), float(rms))
+
+
+class FrameUndistorter:
+    """Rectifies whole frames with remap maps computed once per frame size."""
+
+    def __init__(self, calibration: CameraCalibration, frame_size: Tuple[int, int]):
+        """Precompute the remap maps and the output buffer.
+
+        Args:
+            calibration: Camera calibration (rescaled if its size differs)
+            frame_size: (width, height) of the frames to rectify
+        """
+        self.frame_size = (int(frame_size[0]), int(frame_size[1]))
+        calibration = calibration.scaled_to(self.frame_size)
+        # Fixed-point maps (CV_16SC2) remap faster than float maps
+        self._map1, self._map2 = cv2.initUndistortRectifyMap(
+            calibration.camera_matrix, calibration.dist_coeffs, None,
+            calibration.camera_matrix, self.frame_size, cv2.CV_16SC2
+        )
+        self._output: Optional[np.ndarray] = None
+
+    def undistort(self, frame: np.ndarray) -> np.ndarray:
+        """Rectify a frame into the preallocated buffer.
+
+        The returned array is reused by the next call; copy it to keep it.
+
+        Args:
+            frame: Frame of frame_size
+
+        Returns:
+            Rectified frame
+
+        Raises:
+            ValueError: If the frame size does not match
+        """
+        height, width = frame.shape[:2]
+        if (width, height) != self.frame_size:
+            raise ValueError(f"frame size {(width, height)} does not match undistorter size {self.frame_size}")
+        if self._output is None or self._output.shape != frame.shape or self._output.dtype != frame.dtype:
+            self._output = np.empty_like(frame)
+        cv2.remap(frame, self._map1, self._map2, cv2.INTER_LINEAR, dst=self._output)
+        return self._output
+
+
+class KeypointUndistorter:
+    """Undistorts the arm keypoints instead of the frame."""
+
+    def __init__(self, calibration: CameraCalibration, frame_size: Tuple[int, int]):
+        """Prepare the intrinsics for one frame size.
+
+        Args:
+            calibration: Camera calibration (rescaled if its size differs)
+            frame_size: (width, height) of the frames the keypoints were detected in
+        """
+        self.frame_size = (int(frame_size[0]), int(frame_size[1]))
+        calibration = calibration.scaled_to(self.frame_size)
+        self._camera_matrix = calibration.camera_matrix
+        self._dist_coeffs = calibration.dist_coeffs
+        self._scale = np.array(self.frame_size, dtype=np.float64)
+        self._points = np.empty((3, 1, 2), dtype=np.float64)
+
+    def undistort_points(self, points: np.ndarray) -> np.ndarray:
+        """Undistort normalized (x, y) image coordinates.
+
+        Args:
+            points: (N, 2) coordinates in [0, 1] image units
+
+        Returns:
+            (N, 2) undistorted coordinates in the same units
+        """
+        pixels = np.asarray(points, dtype=np.float64).reshape(-1, 1, 2) * self._scale
+        corrected = cv2.undistortPoints(pixels, self._camera_matrix, self._dist_coeffs, P=self._camera_matrix)
+        return corrected.reshape(-1, 2) / self._scale
+
+    def undistort_arm(self, arm: ArmKeypoints) -> ArmKeypoints:
+        """Return the arm keypoints with lens distortion removed (z is unchanged).
+
+        Args:
+            arm: Keypoints in normalized image coordinates
+
+        Returns:
+            Corrected ArmKeypoints with the same confidence
+        """
+        points = self._points
+        points[0, 0] = arm.shoulder.x, arm.shoulder.y
+        points[1, 0] = arm.elbow.x, arm.elbow.y
+        points[2, 0] = arm.wrist.x, arm.wrist.y
+        points *= self._scale
+        corrected = cv2.undistortPoints(points, self._camera_matrix, self._dist_coeffs, P=self._camera_matrix)
+        (sx, sy), (ex, ey), (wx, wy) = corrected.reshape(3, 2) / self._scale
+        return ArmKeypoints.trusted(
+            Point.trusted(float(sx), float(sy), arm.shoulder.z),
+            Point.trusted(float(ex), float(ey), arm.elbow.z),
+            Point.trusted(float(wx), float(wy), arm.wrist.z),
+            arm.confidence
+        )
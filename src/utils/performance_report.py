@@ -0,0 +1,300 @@
+"""
+Performance measurement helpers for the OpenCV Minecraft Controller.
+
+This module provides the hardware classification, process resource sampling,
+per-stage wall and CPU time accounting and benchmark summary storage shared by
+the application, the benchmark scripts and the usage instructions printed by
+main.py.
+"""
+
+import json
+import os
+import platform
+import time
+from typing import Dict, Iterable, Optional, Tuple
+
+import numpy as np
+
+try:
+    import resource
+except ImportError:  # POSIX only; Windows has no getrusage
+    resource = None
+
+
+DEFAULT_SUMMARY_PATH = os.path.join('benchmark_report', 'summary.json')
+USAGE_COUNTERS = (
+    'voluntary_ctx_switches', 'involuntary_ctx_switches', 'minor_page_faults', 'major_page_faults'
+)
+
+
+def hardware_class() -> str:
+    """Describe the current machine as a coarse hardware class.
+
+    Returns:
+        str: Class label such as 'x86_64-8c'
+    """
+    machine = platform.machine() or 'unknown'
+    cores = os.cpu_count() or 1
+    return f"{machine}-{cores}c"
+
+
+def current_rss_mb() -> float:
+    """Return the current resident set size in megabytes.
+
+    Falls back to the peak RSS reported by getrusage where /proc is unavailable,
+    and returns 0.0 where neither is (Windows).
+    """
+    try:
+        with open('/proc/self/statm', 'r') as statm:
+            resident_pages = int(statm.read().split()[1])
+        return resident_pages * os.sysconf('SC_PAGE_SIZE') / (1024 * 1024)
+    except (OSError, ValueError, IndexError, AttributeError):
+        if resource is None:
+            return 0.0
+        peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # ru_maxrss is in kilobytes on Linux and bytes on macOS
+        return peak / (1024 * 1024) if platform.system() == 'Darwin' else peak / 1024
+
+
+def process_memory_mb(pid: Optional[int] = None) -> Dict[str, float]:
+    """Break down a process's memory into shared and private pages.
+
+    After a fork, pages inherited from the parent stay shared until written, so
+    PSS (shared pages divided among their users) and private memory show what a
+    worker really costs, while RSS counts the shared model in every worker.
+
+    Args:
+        pid: Process ID (default: this process)
+
+    Returns:
+        dict: rss_mb, pss_mb, shared_mb and private_mb; empty where
+              /proc/<pid>/smaps_rollup is unavailable (non-Linux)
+    """
+    path = f"/proc/{pid or 'self'}/smaps_rollup"
+    fields = {}
+    try:
+        with open(path, 'r') as smaps:
+            for line in smaps:
+                parts = line.split()
+                if len(parts) == 3 and parts[2] == 'kB':
+                    fields[parts[0].rstrip(':')] = int(parts[1]) / 1024.0
+    except (OSError, ValueError):
+        return {}
+    return {
+        'rss_mb': fields.get('Rss', 0.0),
+        'pss_mb': fields.get('Pss', 0.0),
+        'shared_mb': fields.get('Shared_Clean', 0.0) + fields.get('Shared_Dirty', 0.0),
+        'private_mb': fields.get('Private_Clean', 0.0) + fields.get('Private_Dirty', 0.0),
+    }
+
+
+def resource_usage() -> Dict[str, float]:
+    """Sample process-wide resource usage through getrusage.
+
+    Returns:
+        dict: user_cpu_s, system_cpu_s, rss_mb, peak_rss_mb and the cumulative
+              context switch and page fault counters in USAGE_COUNTERS; empty
+              where getrusage is unavailable (non-POSIX)
+    """
+    if resource is None:
+        return {}
+    usage = resource.getrusage(resource.RUSAGE_SELF)
+    peak_divisor = 1024 * 1024 if platform.system() == 'Darwin' else 1024
+    return {
+        'user_cpu_s': usage.ru_utime,
+        'system_cpu_s': usage.ru_stime,
+        'rss_mb': current_rss_mb(),
+        'peak_rss_mb': usage.ru_maxrss / peak_divisor,
+        'voluntary_ctx_switches': usage.ru_nvcsw,
+        'involuntary_ctx_switches': usage.ru_nivcsw,
+        'minor_page_faults': usage.ru_minflt,
+        'major_page_faults': usage.ru_majflt,
+    }
+
+
+def latency_percentiles(latencies_ms) -> Dict[str, float]:
+    """Summarize a sequence of latencies.
+
+    Args:
+        latencies_ms: Latencies in milliseconds
+
+    Returns:
+        dict: Mean, p50 and p99 in milliseconds (zeros if empty)
+    """
+    if len(latencies_ms) == 0:
+        return {'mean': 0.0, 'p50': 0.0, 'p99': 0.0}
+    values = np.asarray(latencies_ms, dtype=np.float64)
+    return {
+        'mean': float(values.mean()),
+        'p50': float(np.percentile(values, 50)),
+        'p99': float(np.percentile(values, 99)),
+    }
+
+
+class ResourceSampler:
+    """Measures wall time, process CPU utilisation, RSS, context switches and
+    page faults over an interval."""
+
+    def __init__(self):
+        """Initialize the sampler; call start() to begin an interval."""
+        self._wall_start = 0.0
+        self._cpu_start = 0.0
+        self._peak_rss_mb = 0.0
+        self._usage_start: Dict[str, float] = {}
+
+    def start(self) -> None:
+        """Begin a measurement interval."""
+        self._wall_start = time.perf_counter()
+        self._cpu_start = time.process_time()
+        self._peak_rss_mb = current_rss_mb()
+        self._usage_start = resource_usage()
+
+    def sample(self) -> None:
+        """Record the current RSS so the peak over the interval is tracked."""
+        self._peak_rss_mb = max(self._peak_rss_mb, current_rss_mb())
+
+    def stop(self) -> Dict[str, float]:
+        """End the interval.
+
+        Returns:
+            dict: wall_s, cpu_s, cpu_percent (of one core), rss_mb (peak) and the
+                  USAGE_COUNTERS incurred during the interval, where getrusage
+                  reports them
+        """
+        self.sample()
+        wall = time.perf_counter() - self._wall_start
+        cpu = time.process_time() - self._cpu_start
+        usage = resource_usage()
+        result = {
+            'wall_s': wall,
+            'cpu_s': cpu,
+            'cpu_percent': 100.0 * cpu / wall if wall > 0 else 0.0,
+            'rss_mb': self._peak_rss_mb,
+        }
+        for counter in USAGE_COUNTERS:
+            if counter in usage:
+                result[counter] = usage[counter] - self._usage_start.get(counter, 0)
+        return result
+
+
+class StageProfiler:
+    """Accumulates wall time and calling-thread CPU time per pipeline stage.
+
+    Thread CPU time (time.thread_time_ns) shows how much of a stage's latency
+    is spent computing on the pipeline thread rather than waiting. Work done on
+    other threads, such as MediaPipe's internal graph threads, is not included;
+    get_stats() reports it as the difference to process CPU time.
+
+    Usage:
+        token = profiler.begin()
+        ...  # stage work
+        wall_ms = profiler.end('inference', token)
+    """
+
+    def __init__(self, stages: Iterable[str] = ()):
+        """Initialize the profiler.
+
+        Args:
+            stages: Stage names reported even before they are first measured
+        """
+        self._totals: Dict[str, list] = {stage: [0, 0, 0] for stage in stages}
+        self.reset()
+
+    def begin(self) -> Tuple[int, int]:
+        """Start measuring a stage.
+
+        Returns:
+            Token to pass to end()
+        """
+        return time.perf_counter_ns(), time.thread_time_ns()
+
+    def end(self, stage: str, token: Tuple[int, int]) -> float:
+        """Finish measuring a stage.
+
+        Args:
+            stage: Stage name
+            token: Value returned by begin()
+
+        Returns:
+            float: Wall time of this measurement in milliseconds
+        """
+        wall_ns = time.perf_counter_ns() - token[0]
+        cpu_ns = time.thread_time_ns() - token[1]
+        totals = self._totals.get(stage)
+        if totals is None:
+            totals = self._totals[stage] = [0, 0, 0]
+        totals[0] += wall_ns
+        totals[1] += cpu_ns
+        totals[2] += 1
+        return wall_ns / 1e6
+
+    def reset(self) -> None:
+        """Clear accumulated times and restart the process CPU baseline."""
+        for totals in self._totals.values():
+            totals[:] = [0, 0, 0]
+        self._process_cpu_start = time.process_time_ns()
+        self._wall_start = time.perf_counter_ns()
+
+    def get_stats(self) -> dict:
+        """Summarize accumulated stage times.
+
+        Returns:
+            dict: 'stages' mapping each stage to count, wall_ms_mean, cpu_ms_mean,
+                  cpu_ms_total and cpu_share (thread CPU / wall); plus
+                  process_cpu_ms (all threads since reset), stage_cpu_ms (sum over
+                  stages), other_threads_cpu_ms and process_cpu_percent
+        """
+        stages = {}
+        stage_cpu_ns = 0
+        for stage, (wall_ns, cpu_ns, count) in self._totals.items():
+            stage_cpu_ns += cpu_ns
+            stages[stage] = {
+                'count': count,
+                'wall_ms_mean': wall_ns / count / 1e6 if count else 0.0,
+                'cpu_ms_mean': cpu_ns / count / 1e6 if count else 0.0,
+                'cpu_ms_total': cpu_ns / 1e6,
+                'cpu_share': cpu_ns / wall_ns if wall_ns else 0.0,
+            }
+
+        process_cpu_ns = time.process_time_ns() - self._process_cpu_start
+        elapsed_ns = time.perf_counter_ns() - self._wall_start
+        return {
+            'stages': stages,
+            'process_cpu_ms': process_cpu_ns / 1e6,
+            'stage_cpu_ms': stage_cpu_ns / 1e6,
+            'other_threads_cpu_ms': max(process_cpu_ns - stage_cpu_ns, 0) / 1e6,
+            'process_cpu_percent': 100.0 * process_cpu_ns / elapsed_ns if elapsed_ns else 0.0,
+        }
+
+
+def write_summary(path: str, summary: dict) -> None:
+    """Write a benchmark summary as JSON, merging with existing hardware classes.
+
+    Args:
+        path: Destination JSON path
+        summary: Mapping of hardware class to its recommendation data
+    """
+    existing = load_summary(path) or {}
+    existing.update(summary)
+    directory = os.path.dirname(path)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(path, 'w', encoding='utf-8') as summary_file:
+        json.dump(existing, summary_file, indent=2, sort_keys=True)
+
+
+def load_summary(path: str = DEFAULT_SUMMARY_PATH) -> Optional[dict]:
+    """Load a benchmark summary written by write_summary().
+
+    Args:
+        path: JSON summary path
+
+    Returns:
+        The summary mapping, or None if the file is missing or unreadable
+    """
+    try:
+        with open(path, 'r', encoding='utf-8') as summary_file:
+            data = json.load(summary_file)
+    except (OSError, ValueError):
+        return None
+    return data if isinstance(data, dict) else None
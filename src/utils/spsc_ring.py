@@ -0,0 +1,299 @@
+"""
+Single-producer/single-consumer ring buffer for pipeline stage handoffs.
+
+queue.Queue takes a lock and signals a condition variable on every put and
+get, and the producer allocates a new array for every item it hands over.
+SPSCRing instead copies items into numpy slots preallocated at construction
+and hands the consumer a view of the slot; one thread writes and one thread
+reads, each owning its own counters, so neither takes a lock. Waiting is
+only signalled through an Event when the other side is actually blocked.
+
+Two modes are available:
+
+- 'lossless': a bounded FIFO. put() fails (or waits) while the ring is full,
+  so nothing is lost; use it where every item matters (records, results).
+- 'latest': latest-wins. put() never blocks and get() returns the newest
+  item, skipping older unread ones; use it for frames, where a stale frame
+  is worth less than a new one.
+
+The slot returned by get() belongs to the consumer until its next get() or
+release(); the producer never writes to it, so it can be read without a copy.
+Producers can likewise fill a slot in place with claim() and commit().
+
+The lock-free handoff relies on the interpreter's global lock making
+attribute reads and writes sequentially consistent.
+"""
+
+import threading
+import time
+from typing import Optional, Sequence
+
+import numpy as np
+
+
+RING_MODES = ('lossless', 'latest')
+
+
+class SPSCRing:
+    """Preallocated ring handing fixed-shape arrays from one thread to another."""
+
+    def __init__(
+        self,
+        shape: Sequence[int],
+        dtype=np.uint8,
+        capacity: int = 4,
+        mode: str = 'lossless',
+        meta_dtype=None
+    ):
+        """Allocate the slots.
+
+        Args:
+            shape: Shape of every item
+            dtype: Item dtype
+            capacity: Number of slots; one is held by the consumer, so a lossless
+                ring buffers capacity - 1 unread items
+            mode: 'lossless' or 'latest'
+            meta_dtype: Optional structured dtype of a metadata record stored with
+                each item, e.g. timestamps
+
+        Raises:
+            ValueError: If the mode is unknown, capacity is too small for it or
+                meta_dtype is not structured
+        """
+        if mode not in RING_MODES:
+            raise ValueError(f"mode must be one of {RING_MODES}")
+        if meta_dtype is not None and np.dtype(meta_dtype).names is None:
+            raise ValueError("meta_dtype must be a structured dtype")
+        minimum = 2 if mode == 'lossless' else 3
+        if capacity < minimum:
+            raise ValueError(f"a {mode} ring needs a capacity of at least {minimum}")
+
+        self.shape = tuple(shape)
+        self.dtype = np.dtype(dtype)
+        self.capacity = capacity
+        self.mode = mode
+
+        self._slots = np.zeros((capacity,) + self.shape, dtype=self.dtype)
+        self._views = [self._slots[index] for index in range(capacity)]
+        self._meta = np.zeros(capacity, dtype=meta_dtype) if meta_dtype is not None else None
+        self._meta_views = [self._meta[index] for index in range(capacity)] if self._meta is not None else None
+        self._slot_sequences = [-1] * capacity
+
+        # Producer-owned state
+        self._head = 0
+        self._claimed = -1
+        self._writing = -1
+        self._published = -1
+        self._dropped = 0
+
+        # Consumer-owned state
+        self._tail = 0
+        self._held = -1
+        self._skipped = 0
+        self._got = 0
+        self.sequence = -1
+        self.meta = None
+
+        # Wakeups, only signalled while the other side waits
+        self._readable = threading.Event()
+        self._writable = threading.Event()
+        self._consumer_waiting = False
+        self._producer_waiting = False
+
+    # Producer side
+
+    def claim(self, timeout: Optional[float] = 0.0) -> Optional[np.ndarray]:
+        """Reserve the next free slot for writing in place.
+
+        Args:
+            timeout: Seconds to wait for a free slot in lossless mode (0 does not
+                wait, None waits indefinitely); latest mode never waits
+
+        Returns:
+            Writable slot view, None if a lossless ring stayed full
+        """
+        if self.mode == 'latest':
+            slot = self._claim_latest()
+        else:
+            if self._head - self._tail >= self.capacity and not self._wait_writable(timeout):
+                self._dropped += 1
+                return None
+            slot = self._head % self.capacity
+        self._claimed = slot
+        return self._views[slot]
+
+    def commit(self, meta=None) -> None:
+        """Publish the claimed slot to the consumer.
+
+        Args:
+            meta: Metadata record (tuple matching meta_dtype) stored with the item
+        """
+        slot = self._claimed
+        if slot < 0:
+            raise RuntimeError("commit() without a claimed slot")
+        if meta is not None:
+            self._meta[slot] = meta
+        sequence = self._head
+        self._slot_sequences[slot] = sequence
+        self._claimed = -1
+        if self.mode == 'latest':
+            self._writing = -1
+            # One int reference: the consumer sees the new slot and sequence together
+            self._published = sequence * self.capacity + slot
+        self._head = sequence + 1
+        if self._consumer_waiting:
+            self._readable.set()
+
+    def put(self, item: np.ndarray, meta=None, timeout: Optional[float] = 0.0) -> bool:
+        """Copy an item into the ring.
+
+        Args:
+            item: Array of the ring's shape (cast to its dtype)
+            meta: Metadata record stored with the item
+            timeout: Seconds to wait for space in lossless mode (0 does not wait,
+                None waits indefinitely)
+
+        Returns:
+            bool: True if the item was queued, False if a lossless ring stayed full
+        """
+        slot = self.claim(timeout)
+        if slot is None:
+            return False
+        np.copyto(slot, item, casting='unsafe')
+        self.commit(meta)
+        return True
+
+    def _claim_latest(self) -> int:
+        """Pick a slot that is neither the published one nor held by the consumer."""
+        published = self._published % self.capacity if self._published >= 0 else -1
+        for offset in range(1, self.capacity + 1):
+            slot = (published + offset) % self.capacity
+            if slot == published or slot == self._held:
+                continue
+            self._writing = slot
+            # The consumer may have taken this slot from a stale publication;
+            # it checks _writing after setting _held, so one of us backs off
+            if self._held != slot:
+                return slot
+        raise RuntimeError("no free slot in latest ring")
+
+    def _wait_writable(self, timeout: Optional[float]) -> bool:
+        """Wait until a lossless ring has a free slot."""
+        if timeout is not None and timeout <= 0:
+            return False
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            self._writable.clear()
+            self._producer_waiting = True
+            try:
+                if self._head - self._tail < self.capacity:
+                    return True
+                remaining = None if deadline is None else deadline - time.monotonic()
+                if remaining is not None and remaining <= 0:
+                    return False
+                self._writable.wait(remaining)
+            finally:
+                self._producer_waiting = False
+
+    # Consumer side
+
+    def get(self, timeout: Optional[float] = 0.0) -> Optional[np.ndarray]:
+        """Return the next item (lossless) or the newest item (latest).
+
+        Releases the slot returned by the previous call. The returned view stays
+        valid until the next get() or release(); sequence holds the item's
+        producer sequence number and meta its metadata record.
+
+        Args:
+            timeout: Seconds to wait for an item (0 does not wait, None waits indefinitely)
+
+        Returns:
+            Slot view (not to be written), None if no new item arrived in time
+        """
+        if self.mode == 'latest':
+            slot = self._get_latest()
+            if slot < 0 and self._wait_readable(timeout):
+                slot = self._get_latest()
+        else:
+            self.release()
+            if self._tail == self._head and not self._wait_readable(timeout):
+                return None
+            slot = self._tail % self.capacity
+            self._held = slot
+        if slot < 0:
+            return None
+
+        sequence = self._slot_sequences[slot]
+        self._skipped += sequence - self.sequence - 1
+        self.sequence = sequence
+        self.meta = self._meta_views[slot] if self._meta_views is not None else None
+        self._got += 1
+        return self._views[slot]
+
+    def release(self) -> None:
+        """Hand the slot returned by the last get() back to the producer."""
+        if self._held < 0:
+            return
+        if self.mode == 'lossless':
+            self._tail += 1
+            if self._producer_waiting:
+                self._writable.set()
+        self._held = -1
+
+    def _get_latest(self) -> int:
+        """Take the newest published slot, or return -1 if nothing new was published."""
+        while True:
+            published = self._published
+            if published < 0 or published // self.capacity <= self.sequence:
+                return -1
+            slot = published % self.capacity
+            self._held = slot
+            # The producer checks _held after setting _writing, so one of us sees the other
+            if self._writing != slot:
+                return slot
+
+    def _wait_readable(self, timeout: Optional[float]) -> bool:
+        """Wait until the producer publishes a new item."""
+        if timeout is not None and timeout <= 0:
+            return False
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            self._readable.clear()
+            self._consumer_waiting = True
+            try:
+                if self._has_new_item():
+                    return True
+                remaining = None if deadline is None else deadline - time.monotonic()
+                if remaining is not None and remaining <= 0:
+                    return False
+                self._readable.wait(remaining)
+            finally:
+                self._consumer_waiting = False
+
+    def _has_new_item(self) -> bool:
+        """Check for an item the consumer has not seen yet."""
+        if self.mode == 'latest':
+            return self._published >= 0 and self._published // self.capacity > self.sequence
+        return self._tail != self._head
+
+    def __len__(self) -> int:
+        """Return the number of unread items (at most 1 in latest mode)."""
+        if self.mode == 'latest':
+            return int(self._has_new_item())
+        return self._head - self._tail - (1 if self._held >= 0 else 0)
+
+    def get_stats(self) -> dict:
+        """Get handoff counters.
+
+        Returns:
+            dict: put (items published), got (items returned), dropped (lossless puts
+            rejected while full) and skipped (items the consumer never saw)
+        """
+        return {
+            'mode': self.mode,
+            'capacity': self.capacity,
+            'put': self._head,
+            'got': self._got,
+            'dropped': self._dropped,
+            'skipped': self._skipped,
+        }
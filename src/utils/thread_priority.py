@@ -0,0 +1,186 @@
+"""
+Opt-in real-time thread priority for the OpenCV Minecraft Controller.
+
+Under a busy game the OS scheduler can delay a ready thread by several
+milliseconds, which shows up as late frames and late clicks. With a priority
+mode configured, the latency-critical threads raise their own priority when
+they start:
+
+- capture: camera reader threads (CameraManager deadline reads,
+  CaptureMultiplexer readers, the remote client's frame encoder)
+- decision: the frame loop, which decides the control state and dispatches
+  mouse input, and the remote client's result receiver
+
+Background threads (landmark publishing, flight recorder dumps) drop back to
+normal priority, since Linux threads inherit the priority of the thread that
+started them. Logging has no thread of its own. The preview window is drawn
+on the frame loop thread and so shares its priority; it is a few
+milliseconds of drawing per frame and blocks on nothing but the display.
+
+Modes: 'nice' lowers the thread's nice value; 'fifo' and 'rr' use the
+SCHED_FIFO and SCHED_RR real-time policies, and fall back to 'nice' when not
+permitted. Both need privileges (root, CAP_SYS_NICE, or an RLIMIT_NICE /
+RLIMIT_RTPRIO allowance in /etc/security/limits.conf); without them the
+thread keeps normal priority and a warning is logged. Priorities are set
+per thread, which needs Linux; elsewhere the mode is logged and ignored.
+
+benchmarks/priority_benchmark.py measures wakeup latency and jitter with
+each mode under CPU load.
+"""
+
+import logging
+import os
+import sys
+import threading
+from typing import Dict, Optional
+
+
+logger = logging.getLogger(__name__)
+
+
+PRIORITY_MODES = ('off', 'nice', 'fifo', 'rr')
+
+ROLE_CAPTURE = 'capture'
+ROLE_DECISION = 'decision'
+ROLE_BACKGROUND = 'background'
+THREAD_ROLES = (ROLE_CAPTURE, ROLE_DECISION, ROLE_BACKGROUND)
+
+
+def per_thread_priority_supported() -> bool:
+    """Check whether priorities can be set for a single thread."""
+    return sys.platform.startswith('linux') and hasattr(os, 'sched_setscheduler')
+
+
+class ThreadPriority:
+    """Raises latency-critical threads to the configured priority mode."""
+
+    def __init__(self, mode: str = 'off', realtime_priority: int = 10, nice: int = -10):
+        """Initialize the priority policy.
+
+        Args:
+            mode: One of PRIORITY_MODES; 'off' leaves every thread unchanged
+            realtime_priority: SCHED_FIFO/SCHED_RR priority (1-99) for 'fifo' and 'rr'
+            nice: Nice value (-20 to 0) for 'nice' and as the real-time fallback
+
+        Raises:
+            ValueError: If a parameter is out of range
+        """
+        if mode not in PRIORITY_MODES:
+            raise ValueError(f"mode must be one of {PRIORITY_MODES}")
+        if not 1 <= realtime_priority <= 99:
+            raise ValueError("realtime_priority must be between 1 and 99")
+        if not -20 <= nice <= 0:
+            raise ValueError("nice must be between -20 and 0")
+
+        self.mode = mode
+        self.realtime_priority = realtime_priority
+        self.nice = nice
+
+        # Background threads return to the nice value the process started with
+        self._base_nice = os.getpriority(os.PRIO_PROCESS, 0) if hasattr(os, 'getpriority') else 0
+        self._lock = threading.Lock()
+        self._levels: Dict[str, str] = {}
+        self._degraded: Optional[str] = None
+        self._warned = set()
+
+    def apply(self, role: str) -> str:
+        """Set the calling thread's priority for its role.
+
+        Args:
+            role: One of THREAD_ROLES
+
+        Returns:
+            str: Level in effect, e.g. 'fifo:10', 'nice:-10' or 'normal'
+
+        Raises:
+            ValueError: If role is unknown
+        """
+        if role not in THREAD_ROLES:
+            raise ValueError(f"role must be one of {THREAD_ROLES}")
+        if self.mode == 'off':
+            return 'normal'
+        if not per_thread_priority_supported():
+            self._degrade(f"per-thread priority needs Linux, not {sys.platform}")
+            return 'normal'
+
+        thread_id = threading.get_native_id()
+        level = self._reset(thread_id) if role == ROLE_BACKGROUND else self._raise(thread_id)
+        name = threading.current_thread().name
+        with self._lock:
+            self._levels[name] = level
+        logger.debug(f"Thread {name} ({role}) priority: {level}")
+        return level
+
+    def get_stats(self) -> dict:
+        """Get the configured mode and the level each thread ended up with.
+
+        Returns:
+            dict: mode, per-thread levels, and the latest reason the mode was
+            degraded (or None)
+        """
+        with self._lock:
+            return {'mode': self.mode, 'threads': dict(self._levels), 'degraded': self._degraded}
+
+    def _raise(self, thread_id: int) -> str:
+        """Raise a thread to the real-time policy, or the nice value as fallback."""
+        if self.mode in ('fifo', 'rr'):
+            policy = os.SCHED_FIFO if self.mode == 'fifo' else os.SCHED_RR
+            try:
+                os.sched_setscheduler(thread_id, policy, os.sched_param(self.realtime_priority))
+                return f"{self.mode}:{self.realtime_priority}"
+            except OSError as e:
+                self._degrade(f"SCHED_{self.mode.upper()} not permitted ({e.strerror}), using nice {self.nice}")
+        try:
+            os.setpriority(os.PRIO_PROCESS, thread_id, self.nice)
+            return f"nice:{self.nice}"
+        except OSError as e:
+            self._degrade(f"nice {self.nice} not permitted ({e.strerror}), running at normal priority")
+            return 'normal'
+
+    def _reset(self, thread_id: int) -> str:
+        """Return a thread that inherited a raised priority to normal."""
+        try:
+            if os.sched_getscheduler(thread_id) != os.SCHED_OTHER:
+                os.sched_setscheduler(thread_id, os.SCHED_OTHER, os.sched_param(0))
+            if os.getpriority(os.PRIO_PROCESS, thread_id) < self._base_nice:
+                os.setpriority(os.PRIO_PROCESS, thread_id, self._base_nice)
+        except OSError as e:
+            logger.warning(f"Could not reset thread priority: {e}")
+        return 'normal'
+
+    def _degrade(self, reason: str) -> None:
+        """Record why the mode could not be applied as asked, logging each reason once."""
+        with self._lock:
+            first = reason not in self._warned
+            self._warned.add(reason)
+            self._degraded = reason
+        if first:
+            logger.warning(f"Real-time priority mode '{self.mode}' degraded: {reason}")
+
+
+# Process-wide policy; threads apply it to themselves when they start
+_thread_priority = ThreadPriority()
+
+
+def configure_thread_priority(policy: ThreadPriority) -> None:
+    """Set the priority policy used by threads started from now on."""
+    global _thread_priority
+    _thread_priority = policy
+    logger.info(f"Thread priority mode: {policy.mode}")
+
+
+def get_thread_priority() -> ThreadPriority:
+    """Get the process-wide priority policy."""
+    return _thread_priority
+
+
+def apply_thread_role(role: str) -> str:
+    """Set the calling thread's priority for its role under the process-wide policy.
+
+    Args:
+        role: One of THREAD_ROLES
+
+    Returns:
+        str: Level in effect
+    """
+    return _thread_priority.apply(role)
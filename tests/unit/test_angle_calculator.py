@@ -218,4 +218,40 @@ class TestAngleCalculatorEdgeCases:
         wrist = Point(0.0, 1.0, 0.0)
         
         angle = AngleCalculator.calculate_elbow_angle(shoulder, elbow, wrist)
-        assert abs(angle - 90.0) < 0.001
\ No newline at end of file
+        assert abs(angle - 90.0) < 0.001
+
+class TestAngleCalculatorConfiguration:
+    """Test cases for per-instance thresholds used by runtime configuration."""
+    
+    def test_custom_thresholds(self):
+        """Test constructor overrides apply to state mapping."""
+        calculator = AngleCalculator(right_click_threshold=40.0, left_click_threshold=120.0,
+                                     hysteresis_margin=0.0)
+        assert calculator.get_control_state(50.0) == ControlState.NEUTRAL
+        assert calculator.get_control_state(39.0) == ControlState.RIGHT_CLICK
+        assert calculator.get_control_state(121.0) == ControlState.LEFT_CLICK
+    
+    def test_custom_thresholds_do_not_change_class_defaults(self):
+        """Test overrides are per instance."""
+        AngleCalculator(right_click_threshold=40.0)
+        assert AngleCalculator().RIGHT_CLICK_THRESHOLD == 60.0
+    
+    def test_seed_last_state(self):
+        """Test seeding hysteresis state keeps a held button held."""
+        calculator = AngleCalculator()
+        calculator.set_last_state(ControlState.LEFT_CLICK)
+        # 89 is inside the hysteresis margin of the left-click threshold
+        assert calculator.get_control_state(89.0) == ControlState.LEFT_CLICK
+        assert calculator.get_last_state() == ControlState.LEFT_CLICK
+    
+    def test_threshold_margin(self):
+        """Test the margin follows the thresholds of the current state, including hysteresis."""
+        calculator = AngleCalculator()
+        calculator.get_control_state(70.0)
+        assert calculator.get_threshold_margin(70.0) == pytest.approx(10.0)
+        calculator.get_control_state(150.0)
+        # Leaving left-click needs the angle to drop below 90 - 2
+        assert calculator.get_threshold_margin(150.0) == pytest.approx(62.0)
+        calculator.get_control_state(30.0)
+        assert calculator.get_threshold_margin(30.0) == pytest.approx(32.0)
+        assert calculator.get_threshold_margin(65.0) == 0.0
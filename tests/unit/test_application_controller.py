@@ -12,6 +12,10 @@ import numpy as np
 from src.controllers.application_controller import ApplicationController
 from src.models.enums import ControlState
 from src.models.data_models import SystemState
+from src.utils.clock import VirtualClock
+from src.utils.config_manager import ControllerConfig
+from src.utils.lens_correction import CameraCalibration
+from src.models.data_models import ArmKeypoints, Point
 
 
 class TestApplicationController:
@@ -217,7 +221,7 @@ class TestApplicationController:
         self.app_controller.mouse_controller = mock_mouse
         
         # Set error count high
-        self.app_controller.system_state.error_count = 5
+        self.app_controller.system_state = SystemState(error_count=5)
         
         # Test updating with error
         self.app_controller._update_mouse_control(ControlState.LEFT_CLICK)
@@ -225,11 +229,26 @@ class TestApplicationController:
         assert self.app_controller.system_state.error_count == 6
         assert self.app_controller.system_state.pose_control_enabled is False
     
+    def test_state_snapshots_replaced_only_on_change(self):
+        """Test transitions publish a new snapshot and leave the old one untouched."""
+        self.app_controller.mouse_controller = Mock()
+        initial = self.app_controller.system_state
+        
+        self.app_controller._update_mouse_control(ControlState.LEFT_CLICK)
+        clicked = self.app_controller.system_state
+        assert clicked is not initial
+        assert initial.current_control_state == ControlState.NEUTRAL
+        assert clicked.current_control_state == ControlState.LEFT_CLICK
+        
+        # An unchanged frame keeps the same snapshot, so it allocates nothing
+        self.app_controller._update_mouse_control(ControlState.LEFT_CLICK)
+        assert self.app_controller.system_state is clicked
+    
     def test_set_neutral_state(self):
         """Test setting neutral state."""
         mock_mouse = Mock()
         self.app_controller.mouse_controller = mock_mouse
-        self.app_controller.system_state.current_control_state = ControlState.LEFT_CLICK
+        self.app_controller.system_state = SystemState(current_control_state=ControlState.LEFT_CLICK)
         
         # Test setting neutral state
         self.app_controller._set_neutral_state()
@@ -241,7 +260,7 @@ class TestApplicationController:
         """Test setting neutral state when already neutral."""
         mock_mouse = Mock()
         self.app_controller.mouse_controller = mock_mouse
-        self.app_controller.system_state.current_control_state = ControlState.NEUTRAL
+        self.app_controller.system_state = SystemState(current_control_state=ControlState.NEUTRAL)
         
         # Test setting neutral state
         self.app_controller._set_neutral_state()
@@ -258,6 +277,7 @@ class TestApplicationController:
         
         # Test ESC key handling
         self.app_controller._handle_keyboard_input()
+        self.app_controller._handle_pending_actions()
         
         assert self.app_controller._running is False
     
@@ -269,8 +289,10 @@ class TestApplicationController:
         
         initial_state = self.app_controller.system_state.pose_control_enabled
         
-        # Test SPACE key handling
+        # Test SPACE key handling; the hotkey is applied as a pending command
         self.app_controller._handle_keyboard_input()
+        assert self.app_controller.system_state.pose_control_enabled == initial_state
+        self.app_controller._handle_pending_actions()
         
         assert self.app_controller.system_state.pose_control_enabled != initial_state
     
@@ -284,11 +306,11 @@ class TestApplicationController:
         self.app_controller.mouse_controller = mock_mouse
         
         # Set some error state
-        self.app_controller.system_state.error_count = 3
-        self.app_controller.system_state.pose_control_enabled = False
+        self.app_controller.system_state = SystemState(pose_control_enabled=False, error_count=3)
         
         # Test R key handling
         self.app_controller._handle_keyboard_input()
+        self.app_controller._handle_pending_actions()
         
         assert self.app_controller.system_state.error_count == 0
         assert self.app_controller.system_state.pose_control_enabled is True
@@ -299,8 +321,8 @@ class TestApplicationController:
         # Setup some state
         self.app_controller._running = True
         self.app_controller._frame_count = 100
-        self.app_controller.system_state.last_valid_angle = 75.5
-        self.app_controller.system_state.error_count = 2
+        self.app_controller.last_valid_angle = 75.5
+        self.app_controller.system_state = SystemState(error_count=2)
         
         # Setup mock components
         mock_camera = Mock()
@@ -322,6 +344,8 @@ class TestApplicationController:
         assert status['camera_available'] is True
         assert status['mouse_controller_healthy'] is True
         assert status['frame_count'] == 100
+        assert 'inference' in status['stage_timing']['stages']
+        assert status['resource_usage']['voluntary_ctx_switches'] >= 0
     
     def test_handle_frame_error_camera_unavailable(self):
         """Test handling frame error when camera is unavailable."""
@@ -385,4 +409,282 @@ class TestApplicationController:
         
         # Should return a frame (even if drawing fails)
         assert result_frame is not None
-        assert result_frame.shape == frame.shape
\ No newline at end of file
+        assert result_frame.shape == frame.shape
+    
+    def test_apply_config_updates_angle_only(self):
+        """Test a threshold change swaps only the angle calculator."""
+        from src.utils.angle_calculator import AngleCalculator
+        from src.utils.config_manager import ControllerConfig
+        
+        old_calculator = AngleCalculator()
+        old_calculator.set_last_state(ControlState.LEFT_CLICK)
+        self.app_controller.angle_calculator = old_calculator
+        camera = Mock()
+        detector = Mock()
+        mouse = Mock()
+        self.app_controller.camera_manager = camera
+        self.app_controller.pose_detector = detector
+        self.app_controller.mouse_controller = mouse
+        self.app_controller.display_manager = Mock()
+        
+        watcher = Mock()
+        watcher.poll.return_value = ControllerConfig.from_dict({'angle': {'left_click_threshold': 100.0}})
+        self.app_controller.config_watcher = watcher
+        
+        self.app_controller._apply_config_updates()
+        
+        new_calculator = self.app_controller.angle_calculator
+        assert new_calculator is not old_calculator
+        assert new_calculator.LEFT_CLICK_THRESHOLD == 100.0
+        assert new_calculator.get_last_state() == ControlState.LEFT_CLICK
+        assert self.app_controller.camera_manager is camera
+        assert self.app_controller.pose_detector is detector
+        assert self.app_controller.mouse_controller is mouse
+        assert self.app_controller.config.angle.left_click_threshold == 100.0
+        mouse.release_all.assert_not_called()
+    
+    def test_apply_config_updates_display(self):
+        """Test overlay options are applied to the existing display manager."""
+        from src.utils.config_manager import ControllerConfig
+        
+        display = Mock()
+        self.app_controller.display_manager = display
+        watcher = Mock()
+        watcher.poll.return_value = ControllerConfig.from_dict({'display': {'show_pose_overlay': False}})
+        self.app_controller.config_watcher = watcher
+        
+        self.app_controller._apply_config_updates()
+        
+        assert display.show_pose_overlay is False
+        assert self.app_controller.display_manager is display
+    
+    def test_apply_config_updates_no_change(self):
+        """Test nothing is rebuilt when the watcher reports no change."""
+        calculator = Mock()
+        self.app_controller.angle_calculator = calculator
+        watcher = Mock()
+        watcher.poll.return_value = None
+        self.app_controller.config_watcher = watcher
+        
+        self.app_controller._apply_config_updates()
+        
+        assert self.app_controller.angle_calculator is calculator
+    
+    def test_handle_keyboard_input_flight_dump(self):
+        """Test the F key dumps the flight recorder."""
+        display = Mock()
+        display.handle_key_input.return_value = 'f'
+        self.app_controller.display_manager = display
+        recorder = Mock()
+        self.app_controller.flight_recorder = recorder
+        
+        self.app_controller._handle_keyboard_input()
+        self.app_controller._handle_pending_actions()
+        
+        recorder.trigger.assert_called_once_with('hotkey')
+    
+    def test_process_frame_records_flight_data(self):
+        """Test a processed frame is written to the flight recorder with stage timings."""
+        frame = np.zeros((48, 64, 3), dtype=np.uint8)
+        self.app_controller.camera_manager = Mock()
+        self.app_controller.camera_manager.get_frame.return_value = frame
+        self.app_controller.display_manager = Mock()
+        self.app_controller.display_manager.draw_control_state_indicator.side_effect = lambda f, s: f
+        self.app_controller.pose_detector = Mock()
+        self.app_controller.pose_detector.detect_pose.return_value = None
+        self.app_controller.mouse_controller = Mock()
+        recorder = Mock()
+        self.app_controller.flight_recorder = recorder
+        
+        assert self.app_controller._process_frame() is True
+        
+        recorder.record.assert_called_once()
+        kwargs = recorder.record.call_args.kwargs
+        assert kwargs['landmarks'] is None
+        assert kwargs['angle'] is None
+        assert set(kwargs['timings_ms']) == {'capture', 'inference', 'decision', 'display'}
+        stages = self.app_controller.stage_profiler.get_stats()['stages']
+        assert all(stages[stage]['count'] == 1 for stage in ('capture', 'inference', 'decision', 'display'))
+    
+    def test_process_frame_publishes_to_frame_bus(self):
+        """Test captured frames reach frame bus subscribers."""
+        frame = np.full((48, 64, 3), 9, dtype=np.uint8)
+        self.app_controller.camera_manager = Mock()
+        self.app_controller.camera_manager.get_frame.return_value = frame
+        self.app_controller.display_manager = Mock()
+        self.app_controller.display_manager.draw_control_state_indicator.side_effect = lambda f, s: f
+        self.app_controller.pose_detector = Mock()
+        self.app_controller.pose_detector.detect_pose.return_value = None
+        self.app_controller.mouse_controller = Mock()
+        preview = self.app_controller.frame_bus.subscribe('preview')
+        
+        assert self.app_controller._process_frame() is True
+        
+        with preview.get() as shared:
+            assert shared.frame.shape == frame.shape and shared.frame.max() == 9
+        assert self.app_controller.get_system_status()['frame_bus']['subscribers']['preview']['delivered'] == 1
+    
+    def test_request_action_runs_between_frames(self):
+        """Test actions requested from another thread run when pending actions are handled."""
+        self.app_controller._running = True
+        
+        self.app_controller.request_action('toggle')
+        assert self.app_controller.system_state.pose_control_enabled is True
+        self.app_controller.request_action('stop')
+        self.app_controller._handle_pending_actions()
+        
+        assert self.app_controller.system_state.pose_control_enabled is False
+        assert self.app_controller._running is False
+        with pytest.raises(ValueError):
+            self.app_controller.request_action('explode')
+    
+    def test_apply_config_without_watcher(self):
+        """Test a configuration pushed with apply_config is applied without a config file."""
+        self.app_controller.angle_calculator = Mock()
+        self.app_controller.angle_calculator.get_last_state.return_value = None
+        self.app_controller.display_manager = Mock()
+        config = ControllerConfig.from_dict({'display': {'show_angle_info': False}})
+        
+        self.app_controller.apply_config(config)
+        self.app_controller._apply_config_updates()
+        
+        assert self.app_controller.config is config
+        self.app_controller._apply_config_updates()
+        assert self.app_controller.config is config
+    
+    def test_initialize_uses_provided_detector(self):
+        """Test a warm detector passed in is used instead of building a new one."""
+        detector = Mock()
+        controller = ApplicationController(pose_detector=detector)
+        with patch('src.controllers.application_controller.CameraManager') as camera_class, \
+             patch('src.controllers.application_controller.PoseDetector') as detector_class, \
+             patch('src.controllers.application_controller.MouseController'), \
+             patch('src.controllers.application_controller.DisplayManager'):
+            camera_class.return_value.start_capture.return_value = True
+            assert controller.initialize() is True
+        
+        assert controller.pose_detector is detector
+        detector_class.assert_not_called()
+    
+    def test_process_frame_publishes_record(self):
+        """Test a processed frame is handed to the landmark publisher."""
+        frame = np.zeros((48, 64, 3), dtype=np.uint8)
+        self.app_controller.camera_manager = Mock()
+        self.app_controller.camera_manager.get_frame.return_value = frame
+        self.app_controller.display_manager = Mock()
+        self.app_controller.display_manager.draw_control_state_indicator.side_effect = lambda f, s: f
+        self.app_controller.pose_detector = Mock()
+        self.app_controller.pose_detector.detect_pose.return_value = None
+        self.app_controller.mouse_controller = Mock()
+        publisher = Mock()
+        self.app_controller.publisher = publisher
+        
+        assert self.app_controller._process_frame() is True
+        
+        publisher.publish.assert_called_once()
+        kwargs = publisher.publish.call_args.kwargs
+        assert kwargs['landmarks'] is None
+        assert kwargs['control_state'] == self.app_controller.system_state.current_control_state
+        assert 'publisher' in self.app_controller.get_system_status()
+    
+    def test_handle_frame_error_frozen_camera_releases_buttons(self):
+        """Test an unavailable (e.g. frozen) camera releases held buttons before reconnecting."""
+        self.app_controller.camera_manager = Mock()
+        self.app_controller.camera_manager.is_available.return_value = False
+        self.app_controller.camera_manager.reconnect.return_value = True
+        self.app_controller.mouse_controller = Mock()
+        self.app_controller.system_state = SystemState(current_control_state=ControlState.LEFT_CLICK)
+        
+        assert self.app_controller._handle_frame_error() is True
+        
+        self.app_controller.mouse_controller.set_state.assert_called_once_with(ControlState.NEUTRAL)
+        assert self.app_controller.system_state.current_control_state == ControlState.NEUTRAL
+        self.app_controller.camera_manager.reconnect.assert_called_once()
+    
+    def test_keypoint_undistortion_feeds_angle(self):
+        """Test calibrated keypoint mode computes the angle on corrected keypoints."""
+        camera_matrix = np.array([[400.0, 0.0, 320.0], [0.0, 400.0, 240.0], [0.0, 0.0, 1.0]])
+        self.app_controller.calibration = CameraCalibration(camera_matrix, np.array([[-0.3, 0.1, 0, 0, 0]]), (640, 480))
+        arm = ArmKeypoints(Point(0.7, 0.15), Point(0.8, 0.45), Point(0.9, 0.75), 0.9)
+        self.app_controller.pose_detector = Mock()
+        self.app_controller.pose_detector.get_arm_keypoints.return_value = arm
+        self.app_controller.angle_calculator = Mock()
+        self.app_controller.angle_calculator.calculate_elbow_angle.return_value = 120.0
+        self.app_controller.angle_calculator.get_control_state.return_value = ControlState.LEFT_CLICK
+        self.app_controller.display_manager = Mock()
+        self.app_controller.mouse_controller = Mock()
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        
+        self.app_controller._process_pose_detection(frame, frame)
+        
+        shoulder, elbow, wrist = self.app_controller.angle_calculator.calculate_elbow_angle.call_args.args
+        assert elbow != arm.elbow
+        assert elbow.x > arm.elbow.x  # Barrel distortion pulls edge points inwards
+        self.app_controller.display_manager.draw_pose_overlay.assert_called_once_with(frame, arm)
+    
+    def test_adaptive_inference_skips_steady_frames(self):
+        """Test a steady arm far from the thresholds is not inferred every frame."""
+        from src.utils.angle_calculator import AngleCalculator
+        from src.utils.inference_scheduler import InferenceScheduler
+        
+        clock = VirtualClock()
+        controller = ApplicationController(clock=clock)
+        controller.inference_scheduler = InferenceScheduler(max_interval=0.2)
+        controller.angle_calculator = AngleCalculator()
+        controller.pose_detector = Mock()
+        controller.pose_detector.get_arm_keypoints.return_value = ArmKeypoints(
+            Point(0.2, 0.5), Point(0.4, 0.5), Point(0.6, 0.5), 0.9
+        )
+        controller.display_manager = Mock()
+        controller.mouse_controller = Mock()
+        frame = np.zeros((24, 32, 3), dtype=np.uint8)
+        
+        for _ in range(30):
+            controller._process_pose_detection(frame, frame)
+            assert controller._frame_angle == pytest.approx(180.0)
+            clock.advance(1 / 30)
+        
+        inferences = controller.pose_detector.detect_pose.call_count
+        assert inferences < 10
+        assert controller.mouse_controller.set_state.call_count == inferences
+        assert controller.system_state.current_control_state == ControlState.LEFT_CLICK
+        
+        # Once a lost pose is seen, every frame infers until an angle is measured again
+        controller.inference_scheduler.invalidate()
+        controller.pose_detector.detect_pose.return_value = None
+        calls = controller.pose_detector.detect_pose.call_count
+        for _ in range(3):
+            controller._process_pose_detection(frame, frame)
+            clock.advance(1 / 30)
+        assert controller.pose_detector.detect_pose.call_count == calls + 3
+        assert controller.system_state.current_control_state == ControlState.NEUTRAL
+    
+    def test_invalid_undistort_mode(self):
+        """Test unknown lens correction modes are rejected."""
+        with pytest.raises(ValueError):
+            ApplicationController(undistort_mode='fisheye')
+    
+    def test_fps_tracking_follows_replayed_time(self, tmp_path):
+        """Test an hour of replayed 30 fps video measures 30 FPS in seconds of real time."""
+        import cv2
+        from src.controllers.replay_source import ReplaySource
+        
+        path = str(tmp_path / 'clip.avi')
+        writer = cv2.VideoWriter(path, cv2.VideoWriter_fourcc(*'MJPG'), 30, (32, 24))
+        for _ in range(30):
+            writer.write(np.zeros((24, 32, 3), dtype=np.uint8))
+        writer.release()
+        
+        clock = VirtualClock()
+        controller = ApplicationController(clock=clock)
+        controller.camera_manager = ReplaySource(path, capture_mode='preload', loop=True, clock=clock)
+        assert controller.camera_manager.start_capture()
+        controller._fps_start_time = clock.now()
+        
+        while clock.now() < 3600.0:
+            assert controller.camera_manager.get_frame() is not None
+            controller._frame_count += 1
+            controller._update_fps_tracking()
+        
+        assert controller._frame_count == 108001
+        assert controller._current_fps == pytest.approx(30.0)
@@ -1,11 +1,14 @@
 """Unit tests for CameraManager class."""
 
+import threading
+import time
+
 import pytest
 from unittest.mock import Mock, patch, MagicMock
 import numpy as np
 import cv2
 
-from src.controllers.camera_manager import CameraManager
+from src.controllers.camera_manager import CameraManager, frame_fingerprint, gstreamer_camera_pipeline
 
 
 class TestCameraManager:
@@ -286,6 +289,7 @@ class TestCameraManager:
             cv2.CAP_PROP_FRAME_HEIGHT: 480,
             cv2.CAP_PROP_FPS: 30.0
         }[prop]
+        mock_cap.getBackendName.return_value = 'V4L2'
         mock_video_capture.return_value = mock_cap
         
         self.camera_manager.start_capture()
@@ -297,7 +301,10 @@ class TestCameraManager:
             'height': 480,
             'fps': 30.0,
             'camera_id': 0,
-            'is_available': True
+            'backend': 'V4L2',
+            'is_available': True,
+            'frozen_events': 0,
+            'read_timeouts': 0
         }
         assert result == expected
     
@@ -314,4 +321,254 @@ class TestCameraManager:
         
         result = self.camera_manager.get_camera_info()
         
-        assert result == {'is_available': False}
\ No newline at end of file
+        assert result == {'is_available': False}
+
+
+class TestFrozenCameraDetection:
+    """Test cases for frozen frame detection."""
+    
+    def setup_method(self):
+        """Set up a camera manager driven by a fake clock."""
+        self.now = 0.0
+        self.camera_manager = CameraManager(camera_id=0, freeze_timeout=0.1, clock=lambda: self.now)
+        self.rng = np.random.default_rng(0)
+    
+    def noisy_frame(self):
+        return self.rng.integers(0, 256, (480, 640, 3), dtype=np.uint8)
+    
+    def start(self, mock_video_capture, frames):
+        mock_cap = Mock()
+        mock_cap.isOpened.return_value = True
+        mock_cap.read.side_effect = [(True, frame) for frame in frames]
+        mock_video_capture.return_value = mock_cap
+        assert self.camera_manager.start_capture() is True
+        return mock_cap
+    
+    def test_fingerprint(self):
+        """Test the fingerprint is stable for equal frames and sensitive to sampled pixels."""
+        frame = self.noisy_frame()
+        assert frame_fingerprint(frame) == frame_fingerprint(frame.copy())
+        changed = frame.copy()
+        changed[15, 20] += 1  # A sampled pixel of the 16x16 grid
+        assert frame_fingerprint(changed) != frame_fingerprint(frame)
+        assert isinstance(frame_fingerprint(np.zeros((4, 4), dtype=np.uint8)), int)
+    
+    @patch('cv2.VideoCapture')
+    def test_changing_frames_not_frozen(self, mock_video_capture):
+        """Test a live camera with changing frames is never flagged."""
+        self.start(mock_video_capture, [self.noisy_frame() for _ in range(11)])
+        for _ in range(10):
+            self.now += 0.5
+            assert self.camera_manager.get_frame() is not None
+        assert self.camera_manager.is_available() is True
+        assert self.camera_manager.frozen_events == 0
+    
+    @patch('cv2.VideoCapture')
+    def test_repeated_frame_detected_within_timeout(self, mock_video_capture):
+        """Test identical frames for freeze_timeout flag the camera as unavailable once."""
+        stale = self.noisy_frame()
+        self.start(mock_video_capture, [stale] * 5 + [self.noisy_frame()])
+        
+        self.now = 0.033
+        assert self.camera_manager.get_frame() is not None
+        self.now = 0.066
+        assert self.camera_manager.get_frame() is not None
+        self.now = 0.1
+        assert self.camera_manager.get_frame() is None
+        assert self.camera_manager.is_frozen() is True
+        assert self.camera_manager.is_available() is False
+        self.now = 0.133
+        assert self.camera_manager.get_frame() is None
+        assert self.camera_manager.frozen_events == 1
+        
+        # A new image clears the frozen state
+        assert self.camera_manager.get_frame() is not None
+        assert self.camera_manager.is_frozen() is False
+    
+    @patch('cv2.VideoCapture')
+    def test_reconnect_clears_frozen_state(self, mock_video_capture):
+        """Test a reconnect resets detection but keeps the event count."""
+        stale = self.noisy_frame()
+        self.start(mock_video_capture, [stale, stale])
+        self.now = 0.2
+        assert self.camera_manager.get_frame() is None
+        
+        self.start(mock_video_capture, [self.noisy_frame()])
+        assert self.camera_manager.is_available() is True
+        assert self.camera_manager.frozen_events == 1
+    
+    @patch('cv2.VideoCapture')
+    def test_detection_disabled(self, mock_video_capture):
+        """Test freeze_timeout=None turns detection off."""
+        self.camera_manager = CameraManager(freeze_timeout=None, clock=lambda: self.now)
+        stale = self.noisy_frame()
+        self.start(mock_video_capture, [stale] * 3)
+        self.now = 10.0
+        assert self.camera_manager.get_frame() is not None
+        assert self.camera_manager.get_frame() is not None
+        assert self.camera_manager.frozen_events == 0
+
+
+class TestDeadlineBoundedReads:
+    """Test cases for deadline-bounded frame reads."""
+    
+    def start(self, mock_video_capture, read):
+        mock_cap = Mock()
+        mock_cap.isOpened.return_value = True
+        mock_cap.read.side_effect = read
+        mock_video_capture.return_value = mock_cap
+        self.camera_manager = CameraManager(freeze_timeout=None, read_timeout=0.05)
+        assert self.camera_manager.start_capture() is True
+        return mock_cap
+    
+    @patch('cv2.VideoCapture')
+    def test_reads_recorded_in_distribution(self, mock_video_capture):
+        """Test timely reads return frames and are counted in the histogram."""
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        self.start(mock_video_capture, lambda: (True, frame))
+        
+        for _ in range(5):
+            assert self.camera_manager.get_frame() is frame
+        
+        stats = self.camera_manager.get_read_stats()
+        assert stats['reads'] == 5
+        assert stats['timeouts'] == 0
+        assert stats['histogram_ms']['<=10'] == 5
+        assert 0.0 <= stats['p50_ms'] <= stats['p99_ms'] <= stats['max_ms']
+        self.camera_manager.release()
+    
+    @patch('cv2.VideoCapture')
+    def test_missed_deadline(self, mock_video_capture):
+        """Test a blocked read returns None, flags the camera and releases it once unblocked."""
+        unblock = threading.Event()
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        reads = iter([True, False])
+        
+        def read():
+            if not next(reads, True):
+                unblock.wait(2.0)
+            return True, frame
+        
+        mock_cap = self.start(mock_video_capture, read)
+        
+        start = time.perf_counter()
+        assert self.camera_manager.get_frame() is None
+        assert time.perf_counter() - start < 0.5
+        assert self.camera_manager.is_available() is False
+        assert self.camera_manager.get_read_stats()['timeouts'] == 1
+        assert self.camera_manager.get_read_stats()['histogram_ms']['<=50'] == 1
+        
+        # Releasing while the read is stuck must not block; the capture is released later
+        self.camera_manager.release()
+        mock_cap.release.assert_not_called()
+        unblock.set()
+        for _ in range(100):
+            if mock_cap.release.called:
+                break
+            time.sleep(0.01)
+        mock_cap.release.assert_called_once()
+    
+    @patch('src.controllers.camera_manager.START_READ_TIMEOUT', 0.1)
+    @patch('cv2.VideoCapture')
+    def test_reconnect_to_hung_device_fails_within_deadline(self, mock_video_capture):
+        """Test the test read of a (re)started capture is bounded by a deadline too."""
+        unblock = threading.Event()
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        reads = iter([True])
+        
+        def read():
+            if not next(reads, False):
+                unblock.wait(2.0)
+            return True, frame
+        
+        self.start(mock_video_capture, read)
+        
+        start = time.perf_counter()
+        assert self.camera_manager.reconnect() is False
+        assert time.perf_counter() - start < 0.5
+        assert self.camera_manager.is_available() is False
+        assert self.camera_manager.read_timeouts == 1
+        unblock.set()
+    
+    @patch('cv2.VideoCapture')
+    def test_no_deadline_reads_inline(self, mock_video_capture):
+        """Test read_timeout=None reads on the calling thread."""
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        threads = []
+        mock_cap = Mock()
+        mock_cap.isOpened.return_value = True
+        mock_cap.read.side_effect = lambda: (threads.append(threading.current_thread()), (True, frame))[1]
+        mock_video_capture.return_value = mock_cap
+        camera_manager = CameraManager(freeze_timeout=None, read_timeout=None)
+        camera_manager.start_capture()
+        
+        assert camera_manager.get_frame() is frame
+        assert threads[-1] is threading.current_thread()
+        assert camera_manager.get_read_stats()['reads'] == 1
+
+
+class TestCaptureBackends:
+    """Test cases for capture backend selection."""
+    
+    def open_with(self, mock_video_capture, **kwargs):
+        mock_cap = Mock()
+        mock_cap.isOpened.return_value = True
+        mock_cap.read.return_value = (True, np.zeros((480, 640, 3), dtype=np.uint8))
+        mock_video_capture.return_value = mock_cap
+        camera_manager = CameraManager(camera_id=2, **kwargs)
+        assert camera_manager.start_capture() is True
+        camera_manager.release()
+        return mock_cap
+    
+    @patch('cv2.VideoCapture')
+    def test_auto_backend_uses_default(self, mock_video_capture):
+        """Test the default backend opens the camera index without an API preference."""
+        self.open_with(mock_video_capture)
+        mock_video_capture.assert_called_once_with(2)
+    
+    @patch('cv2.VideoCapture')
+    def test_named_backend(self, mock_video_capture):
+        """Test a named backend is passed as the API preference and properties are set."""
+        mock_cap = self.open_with(mock_video_capture, backend='v4l2')
+        mock_video_capture.assert_called_once_with(2, cv2.CAP_V4L2)
+        mock_cap.set.assert_any_call(cv2.CAP_PROP_FRAME_WIDTH, 640)
+    
+    @patch('cv2.VideoCapture')
+    def test_gstreamer_builds_pipeline(self, mock_video_capture):
+        """Test the gstreamer backend without a source opens a v4l2src appsink pipeline."""
+        mock_cap = self.open_with(mock_video_capture, backend='gstreamer')
+        pipeline = mock_video_capture.call_args.args[0]
+        assert mock_video_capture.call_args.args[1] == cv2.CAP_GSTREAMER
+        assert pipeline == gstreamer_camera_pipeline(2, 640, 480)
+        assert 'device=/dev/video2' in pipeline and 'drop=true max-buffers=1' in pipeline
+        mock_cap.set.assert_not_called()
+    
+    @patch('cv2.VideoCapture')
+    def test_source_overrides_camera(self, mock_video_capture):
+        """Test a file or pipeline source is opened instead of the camera index."""
+        self.open_with(mock_video_capture, backend='ffmpeg', source='clip.mp4')
+        mock_video_capture.assert_called_once_with('clip.mp4', cv2.CAP_FFMPEG)
+    
+    def test_unknown_backend(self):
+        """Test unknown backends are rejected."""
+        with pytest.raises(ValueError):
+            CameraManager(backend='directx')
+    
+    def test_video_file_source(self, tmp_path):
+        """Test a real video file plays through the FFmpeg backend."""
+        path = str(tmp_path / 'clip.avi')
+        writer = cv2.VideoWriter(path, cv2.VideoWriter_fourcc(*'MJPG'), 30, (64, 48))
+        if not writer.isOpened():
+            pytest.skip("no video writer available")
+        rng = np.random.default_rng(0)
+        for _ in range(5):
+            writer.write(rng.integers(0, 256, (48, 64, 3), dtype=np.uint8))
+        writer.release()
+        
+        camera_manager = CameraManager(backend='ffmpeg', source=path)
+        if not camera_manager.start_capture():
+            pytest.skip("FFmpeg backend unavailable")
+        frame = camera_manager.get_frame()
+        camera_manager.release()
+        
+        assert frame is not None and frame.shape == (48, 64, 3)
\ No newline at end of file
@@ -0,0 +1,130 @@
+"""
+Unit tests for the multi-source capture multiplexer.
+"""
+
+import threading
+import time
+from unittest.mock import patch
+
+import cv2
+import numpy as np
+import pytest
+
+from src.controllers.capture_multiplexer import CaptureMultiplexer, waitany_supported
+
+
+class PacedSource:
+    """Frame source delivering frames filled with its ID at a fixed interval."""
+    def __init__(self, value, interval, limit=None):
+        self.value = value
+        self.interval = interval
+        self.limit = limit
+        self.reads = 0
+
+    def get_frame(self):
+        if self.limit is not None and self.reads >= self.limit:
+            time.sleep(0.005)
+            return None
+        time.sleep(self.interval)
+        self.reads += 1
+        return np.full((4, 4, 3), self.value, dtype=np.uint8)
+
+
+class TestCaptureMultiplexer:
+    """Test cases for CaptureMultiplexer."""
+
+    def test_invalid_arguments(self):
+        """Test sources, mode and queue size are validated."""
+        with pytest.raises(ValueError):
+            CaptureMultiplexer([])
+        with pytest.raises(ValueError):
+            CaptureMultiplexer([PacedSource(1, 0.01)], mode='select')
+        with pytest.raises(ValueError):
+            CaptureMultiplexer([PacedSource(1, 0.01)], queue_size=0)
+
+    def test_auto_falls_back_to_threads(self):
+        """Test sources without V4L2 captures are read by one thread each."""
+        with CaptureMultiplexer([PacedSource(1, 0.01), PacedSource(2, 0.01)]) as multiplexer:
+            assert multiplexer.mode == 'threads'
+            assert multiplexer.get(timeout=1.0) is not None
+
+    def test_waitany_required(self):
+        """Test forcing waitany on unsupported sources fails at start."""
+        multiplexer = CaptureMultiplexer([PacedSource(1, 0.01)], mode='waitany')
+        with pytest.raises(RuntimeError):
+            multiplexer.start()
+
+    def test_frames_tagged_in_ready_order(self):
+        """Test a fast source is not held back by a slow one."""
+        fast, slow = PacedSource(10, 0.01), PacedSource(20, 0.1)
+        with CaptureMultiplexer([fast, slow], mode='threads', queue_size=64) as multiplexer:
+            frames = [multiplexer.get(timeout=1.0) for _ in range(12)]
+
+        assert all(item is not None for item in frames)
+        fast_frames = [item for item in frames if item.source_id == 0]
+        # Round-robin reading would deliver at most one fast frame per slow frame
+        assert len(fast_frames) >= 8
+        assert all(item.frame[0, 0, 0] == 10 * (item.source_id + 1) for item in frames)
+        assert [item.sequence for item in fast_frames] == list(range(len(fast_frames)))
+        timestamps = [item.timestamp for item in frames]
+        assert timestamps == sorted(timestamps)
+
+    def test_overflow_drops_oldest(self):
+        """Test an idle consumer only loses the oldest frames."""
+        multiplexer = CaptureMultiplexer([PacedSource(1, 0.0, limit=10)], mode='threads', queue_size=3)
+        multiplexer.start()
+        deadline = time.perf_counter() + 2.0
+        while multiplexer.get_stats()['frames'][0] < 10 and time.perf_counter() < deadline:
+            time.sleep(0.01)
+        sequences = [multiplexer.get(timeout=0.1).sequence for _ in range(3)]
+        stats = multiplexer.get_stats()
+        multiplexer.close()
+
+        assert sequences == [7, 8, 9]
+        assert stats['dropped'] == 7
+        assert stats['read_failures'][0] > 0
+
+    def test_waitany_retrieves_ready_sources(self):
+        """Test the waitAny loop retrieves only the captures reported ready."""
+        captures = [cv2.VideoCapture(), cv2.VideoCapture()]
+        sources = [type('Source', (), {'cap': cap})() for cap in captures]
+        calls = []
+        ready_once = threading.Event()
+
+        def fake_wait_any(streams, timeout_ns):
+            calls.append(timeout_ns)
+            if timeout_ns == 1:
+                return False, []
+            if ready_once.is_set():
+                time.sleep(0.01)
+                return False, []
+            ready_once.set()
+            return True, [1]
+
+        retrieved = np.full((4, 4, 3), 7, dtype=np.uint8)
+        with patch.object(cv2.VideoCapture, 'waitAny', side_effect=fake_wait_any), \
+                patch.object(cv2.VideoCapture, 'retrieve', return_value=(True, retrieved)):
+            assert waitany_supported(captures)
+            with CaptureMultiplexer(sources, mode='waitany', wait_timeout=0.05) as multiplexer:
+                item = multiplexer.get(timeout=1.0)
+
+        assert multiplexer.mode == 'waitany'
+        assert item.source_id == 1 and item.sequence == 0
+        assert item.frame is retrieved
+        assert calls[0] == 1 and 50_000_000 in calls
+
+    def test_waitany_supported_rejects_files(self, tmp_path):
+        """Test captures on non-V4L2 backends are reported unsupported."""
+        path = str(tmp_path / 'clip.avi')
+        writer = cv2.VideoWriter(path, cv2.VideoWriter_fourcc(*'MJPG'), 30, (32, 24))
+        for _ in range(3):
+            writer.write(np.zeros((24, 32, 3), dtype=np.uint8))
+        writer.release()
+
+        capture = cv2.VideoCapture(path)
+        try:
+            assert not waitany_supported([capture])
+            assert not waitany_supported([])
+            assert not waitany_supported([None])
+        finally:
+            capture.release()
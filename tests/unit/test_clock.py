@@ -0,0 +1,73 @@
+"""
+Unit tests for the injectable clocks.
+"""
+
+import time
+
+import pytest
+
+from src.utils.clock import SystemClock, VirtualClock
+from src.utils.config_manager import ConfigWatcher
+
+
+class TestSystemClock:
+    """Test cases for SystemClock."""
+    
+    def test_reads_real_time(self):
+        """Test the system clock follows the monotonic and wall clocks."""
+        clock = SystemClock()
+        
+        assert abs(clock.now() - time.monotonic()) < 0.1
+        assert abs(clock.wall() - time.time()) < 0.1
+        assert abs(clock() - time.monotonic()) < 0.1
+        
+        start = clock.now()
+        clock.sleep(0.01)
+        assert clock.now() - start >= 0.009
+
+
+class TestVirtualClock:
+    """Test cases for VirtualClock."""
+    
+    def test_only_moves_when_told(self):
+        """Test time stands still until advanced."""
+        clock = VirtualClock(start=10.0, wall_start=1000.0)
+        
+        assert clock.now() == clock() == 10.0
+        assert clock.wall() == 1000.0
+        assert clock.advance(2.5) == 12.5
+        assert clock.wall() == 1002.5
+    
+    def test_sleep_advances_instantly(self):
+        """Test an hour of sleeping returns immediately."""
+        clock = VirtualClock()
+        start = time.perf_counter()
+        
+        for _ in range(3600):
+            clock.sleep(1.0)
+        
+        assert clock.now() == 3600.0
+        assert time.perf_counter() - start < 1.0
+    
+    def test_never_moves_backwards(self):
+        """Test negative advances fail and earlier targets are ignored."""
+        clock = VirtualClock(start=5.0)
+        
+        with pytest.raises(ValueError):
+            clock.advance(-1.0)
+        assert clock.advance_to(3.0) == 5.0
+        assert clock.advance_to(7.0) == 7.0
+        clock.sleep(-1.0)
+        assert clock.now() == 7.0
+    
+    def test_drives_config_polling(self, tmp_path):
+        """Test a clock passed as a time function controls the config check interval."""
+        path = tmp_path / 'config.json'
+        path.write_text('{}')
+        clock = VirtualClock()
+        watcher = ConfigWatcher(str(path), check_interval=0.5, clock=clock)
+        path.write_text('{"angle": {"hysteresis_margin": 9.0}}')
+        
+        assert watcher.poll() is None
+        clock.advance(0.5)
+        assert watcher.poll().angle.hysteresis_margin == 9.0
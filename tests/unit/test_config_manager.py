@@ -0,0 +1,148 @@
+"""
+Unit tests for runtime configuration loading and watching.
+
+Tests ControllerConfig validation, section diffing and ConfigWatcher change
+detection using temporary files and a fake clock.
+"""
+
+import json
+import os
+import pytest
+
+from src.utils.config_manager import (
+    AngleConfig, ConfigWatcher, ControllerConfig, DisplayConfig, load_config
+)
+
+
+class FakeClock:
+    """Manually advanced clock for deterministic polling."""
+    def __init__(self):
+        self.now = 0.0
+    
+    def __call__(self):
+        return self.now
+
+
+def write_config(path, data, mtime_ns=None):
+    """Write a JSON config and optionally force its modification time."""
+    with open(path, 'w', encoding='utf-8') as config_file:
+        json.dump(data, config_file)
+    if mtime_ns is not None:
+        os.utime(path, ns=(mtime_ns, mtime_ns))
+
+
+class TestControllerConfig:
+    """Test cases for ControllerConfig parsing and validation."""
+    
+    def test_defaults(self):
+        """Test empty configuration uses component defaults."""
+        config = ControllerConfig.from_dict({})
+        assert config.angle == AngleConfig(60.0, 90.0, 2.0)
+        assert config.display == DisplayConfig()
+    
+    def test_partial_section(self):
+        """Test missing keys fall back to defaults."""
+        config = ControllerConfig.from_dict({'angle': {'right_click_threshold': 50}})
+        assert config.angle.right_click_threshold == 50
+        assert config.angle.left_click_threshold == 90.0
+    
+    def test_unknown_section(self):
+        """Test unknown sections are rejected."""
+        with pytest.raises(ValueError, match="unknown configuration sections"):
+            ControllerConfig.from_dict({'camera': {}})
+    
+    def test_unknown_key(self):
+        """Test unknown keys are rejected."""
+        with pytest.raises(ValueError, match="unknown keys in 'display'"):
+            ControllerConfig.from_dict({'display': {'colour': 'red'}})
+    
+    def test_invalid_threshold_order(self):
+        """Test thresholds must leave a neutral band."""
+        with pytest.raises(ValueError, match="thresholds must satisfy"):
+            AngleConfig(right_click_threshold=95.0, left_click_threshold=90.0)
+    
+    def test_invalid_hysteresis(self):
+        """Test hysteresis must fit inside the neutral band."""
+        with pytest.raises(ValueError, match="hysteresis_margin must be less"):
+            AngleConfig(right_click_threshold=60.0, left_click_threshold=70.0, hysteresis_margin=5.0)
+        with pytest.raises(ValueError, match="non-negative"):
+            AngleConfig(hysteresis_margin=-1.0)
+    
+    def test_invalid_types(self):
+        """Test wrong value types are rejected."""
+        with pytest.raises(TypeError, match="right_click_threshold must be a number"):
+            AngleConfig(right_click_threshold="60")
+        with pytest.raises(TypeError, match="show_pose_overlay must be a boolean"):
+            DisplayConfig(show_pose_overlay=1)
+    
+    def test_changed_sections(self):
+        """Test only differing sections are reported."""
+        base = ControllerConfig()
+        changed = ControllerConfig.from_dict({'angle': {'hysteresis_margin': 3.0}})
+        assert changed.changed_sections(base) == ['angle']
+        assert base.changed_sections(ControllerConfig()) == []
+
+
+class TestConfigWatcher:
+    """Test cases for ConfigWatcher change detection."""
+    
+    def setup_method(self):
+        """Set up test fixtures."""
+        self.clock = FakeClock()
+    
+    def test_load_config_file(self, tmp_path):
+        """Test loading a configuration file from disk."""
+        path = tmp_path / 'config.json'
+        write_config(path, {'display': {'show_angle_info': False}})
+        assert load_config(str(path)).display.show_angle_info is False
+    
+    def test_initial_load_invalid(self, tmp_path):
+        """Test watcher construction fails on an invalid file."""
+        path = tmp_path / 'config.json'
+        path.write_text('{not json')
+        with pytest.raises(ValueError):
+            ConfigWatcher(str(path), clock=self.clock)
+    
+    def test_poll_detects_change(self, tmp_path):
+        """Test a modified file is reloaded after the check interval."""
+        path = tmp_path / 'config.json'
+        write_config(path, {}, mtime_ns=1_000_000_000)
+        watcher = ConfigWatcher(str(path), check_interval=0.5, clock=self.clock)
+        
+        write_config(path, {'angle': {'left_click_threshold': 100.0}}, mtime_ns=2_000_000_000)
+        
+        # Not yet time to check
+        self.clock.now = 0.1
+        assert watcher.poll() is None
+        
+        self.clock.now = 0.6
+        new_config = watcher.poll()
+        assert new_config is not None
+        assert new_config.angle.left_click_threshold == 100.0
+        assert watcher.config is new_config
+        assert watcher.reload_count == 1
+        
+        # Unchanged file is not reparsed
+        self.clock.now = 1.2
+        assert watcher.poll() is None
+    
+    def test_poll_ignores_invalid_edit(self, tmp_path):
+        """Test an invalid edit keeps the last good configuration."""
+        path = tmp_path / 'config.json'
+        write_config(path, {'angle': {'hysteresis_margin': 1.0}}, mtime_ns=1_000_000_000)
+        watcher = ConfigWatcher(str(path), check_interval=0.0, clock=self.clock)
+        
+        write_config(path, {'angle': {'hysteresis_margin': -1.0}}, mtime_ns=2_000_000_000)
+        
+        assert watcher.poll() is None
+        assert watcher.config.angle.hysteresis_margin == 1.0
+        assert watcher.reload_count == 0
+    
+    def test_poll_missing_file(self, tmp_path):
+        """Test a deleted file is ignored until it reappears."""
+        path = tmp_path / 'config.json'
+        write_config(path, {})
+        watcher = ConfigWatcher(str(path), check_interval=0.0, clock=self.clock)
+        
+        os.remove(path)
+        assert watcher.poll() is None
@@ -5,6 +5,9 @@ Tests the Point, ArmKeypoints, and SystemState dataclasses for proper
 validation and behavior.
 """
 
+import dataclasses
+import pickle
+
 import pytest
 from src.models import Point, ArmKeypoints, SystemState, ControlState
 
@@ -154,7 +157,6 @@ class TestSystemState:
         state = SystemState()
         assert state.pose_control_enabled is True
         assert state.current_control_state == ControlState.NEUTRAL
-        assert state.last_valid_angle is None
         assert state.error_count == 0
     
     def test_system_state_creation_with_values(self):
@@ -162,12 +164,10 @@ class TestSystemState:
         state = SystemState(
             pose_control_enabled=False,
             current_control_state=ControlState.LEFT_CLICK,
-            last_valid_angle=75.5,
             error_count=3
         )
         assert state.pose_control_enabled is False
         assert state.current_control_state == ControlState.LEFT_CLICK
-        assert state.last_valid_angle == 75.5
         assert state.error_count == 3
     
     def test_system_state_invalid_pose_control_type(self):
@@ -180,23 +180,11 @@ class TestSystemState:
         with pytest.raises(TypeError, match="current_control_state must be a ControlState enum"):
             SystemState(current_control_state="invalid")
     
-    def test_system_state_invalid_angle_type(self):
-        """Test SystemState raises TypeError for invalid last_valid_angle type."""
-        with pytest.raises(TypeError, match="last_valid_angle must be a number or None"):
-            SystemState(last_valid_angle="invalid")
-    
-    def test_system_state_valid_angle_none(self):
-        """Test SystemState accepts None for last_valid_angle."""
-        state = SystemState(last_valid_angle=None)
-        assert state.last_valid_angle is None
-    
-    def test_system_state_valid_angle_number(self):
-        """Test SystemState accepts numeric values for last_valid_angle."""
-        state = SystemState(last_valid_angle=45.0)
-        assert state.last_valid_angle == 45.0
-        
-        state_int = SystemState(last_valid_angle=90)
-        assert state_int.last_valid_angle == 90
+    def test_system_state_has_no_angle(self):
+        """Test the per-frame angle is not part of the snapshot."""
+        with pytest.raises(TypeError):
+            SystemState(last_valid_angle=45.0)
+        assert not hasattr(SystemState(), 'last_valid_angle')
     
     def test_system_state_invalid_error_count_type(self):
         """Test SystemState raises TypeError for invalid error_count type."""
@@ -206,4 +194,71 @@ class TestSystemState:
     def test_system_state_negative_error_count(self):
         """Test SystemState raises ValueError for negative error_count."""
         with pytest.raises(ValueError, match="error_count must be non-negative"):
-            SystemState(error_count=-1)
\ No newline at end of file
+            SystemState(error_count=-1)
+
+
+class TestSlottedModels:
+    """Test cases for slotted models and trusted construction."""
+    
+    def test_models_have_no_instance_dict(self):
+        """Test all models use __slots__."""
+        point = Point(1.0, 2.0)
+        keypoints = ArmKeypoints(point, point, point, 0.5)
+        state = SystemState()
+        for instance in (point, keypoints, state):
+            assert not hasattr(instance, '__dict__')
+    
+    def test_point_and_keypoints_are_frozen(self):
+        """Test value models cannot be mutated."""
+        point = Point(1.0, 2.0)
+        keypoints = ArmKeypoints(point, point, point, 0.5)
+        with pytest.raises(dataclasses.FrozenInstanceError):
+            point.x = 5.0
+        with pytest.raises(dataclasses.FrozenInstanceError):
+            keypoints.confidence = 0.1
+    
+    def test_system_state_is_frozen(self):
+        """Test SystemState snapshots cannot be updated in place."""
+        state = SystemState()
+        with pytest.raises(dataclasses.FrozenInstanceError):
+            state.error_count = 3
+        with pytest.raises(dataclasses.FrozenInstanceError):
+            SystemState.trusted().pose_control_enabled = False
+    
+    def test_point_trusted_matches_validated(self):
+        """Test trusted Point equals a validated Point."""
+        assert Point.trusted(1.0, 2.0, 3.0) == Point(1.0, 2.0, 3.0)
+        assert Point.trusted(1.0, 2.0).z == 0.0
+    
+    def test_point_trusted_skips_validation(self):
+        """Test trusted construction does not type-check."""
+        point = Point.trusted("a", "b")
+        assert point.x == "a"
+    
+    def test_arm_keypoints_trusted_matches_validated(self):
+        """Test trusted ArmKeypoints equals validated ArmKeypoints."""
+        shoulder = Point.trusted(0.1, 0.2)
+        elbow = Point.trusted(0.3, 0.4)
+        wrist = Point.trusted(0.5, 0.6)
+        trusted = ArmKeypoints.trusted(shoulder, elbow, wrist, 0.9)
+        assert trusted == ArmKeypoints(shoulder, elbow, wrist, 0.9)
+        with pytest.raises(dataclasses.FrozenInstanceError):
+            trusted.wrist = shoulder
+    
+    def test_system_state_trusted_defaults(self):
+        """Test trusted SystemState uses the same defaults."""
+        assert SystemState.trusted() == SystemState()
+        state = SystemState.trusted(False, ControlState.LEFT_CLICK, 2)
+        assert state.current_control_state == ControlState.LEFT_CLICK
+        assert state.error_count == 2
+    
+    def test_models_are_picklable(self):
+        """Test slotted models survive pickling for multiprocess use."""
+        keypoints = ArmKeypoints.trusted(Point.trusted(0.1, 0.2), Point.trusted(0.3, 0.4),
+                                         Point.trusted(0.5, 0.6), 0.9)
+        assert pickle.loads(pickle.dumps(keypoints)) == keypoints
+        assert pickle.loads(pickle.dumps(SystemState())) == SystemState()
+    
+    def test_points_are_hashable(self):
+        """Test frozen points can be used as dictionary keys."""
+        assert len({Point(1.0, 2.0), Point.trusted(1.0, 2.0)}) == 1
@@ -0,0 +1,118 @@
+"""
+Unit tests for the pre-fork detector worker pool.
+"""
+
+import os
+import sys
+
+import numpy as np
+import pytest
+
+from src.controllers.detector_pool import DetectorWorkerPool
+from src.controllers.pose_detector import landmarks_from_array
+
+
+pytestmark = pytest.mark.skipif(sys.platform == 'win32', reason="the pool forks its workers")
+
+FRAME_SHAPE = (24, 32, 3)
+
+
+class FakeDetector:
+    """Detector whose landmarks encode the frame mean and the serving process."""
+    def __init__(self, fail_on=None):
+        self.loaded_in = os.getpid()
+        self.fail_on = fail_on
+    
+    def detect_pose(self, frame):
+        value = float(frame.mean())
+        if value == 0.0:
+            return None
+        if value == self.fail_on:
+            raise RuntimeError("inference failed")
+        array = np.zeros((33, 4), dtype=np.float32)
+        array[:, 0] = value
+        array[0, 1] = os.getpid()
+        array[0, 2] = self.loaded_in
+        return landmarks_from_array(array)
+
+
+class TestDetectorWorkerPool:
+    """Test cases for DetectorWorkerPool."""
+    
+    def setup_method(self):
+        """Count detector constructions in this process."""
+        self.constructed = 0
+    
+    def factory(self):
+        self.constructed += 1
+        return FakeDetector(fail_on=7.0)
+    
+    def frame(self, value):
+        return np.full(FRAME_SHAPE, value, dtype=np.uint8)
+    
+    def test_streams_served_by_forked_workers(self):
+        """Test every stream gets its own frame's result from a worker process."""
+        with DetectorWorkerPool(self.factory, workers=2, streams=4, frame_shape=FRAME_SHAPE,
+                                share_detector=True) as pool:
+            results = [pool.detect(stream, self.frame(10 + stream)) for stream in range(4)]
+            pids = pool.worker_pids
+        
+        assert self.constructed == 1
+        assert len(set(pids)) == 2 and os.getpid() not in pids
+        for stream, result in enumerate(results):
+            landmarks = result['landmarks']
+            assert landmarks.shape == (33, 4)
+            assert landmarks[1, 0] == pytest.approx(10 + stream)
+            # Served by the stream's worker with the detector loaded in the parent
+            assert int(landmarks[0, 1]) == pids[pool.worker_for_stream(stream)]
+            assert int(landmarks[0, 2]) == os.getpid()
+            assert result['latency_ms'] >= result['inference_ms'] >= 0.0
+    
+    def test_sequences_and_no_pose(self):
+        """Test sequence numbers advance per stream and no pose yields None landmarks."""
+        with DetectorWorkerPool(self.factory, workers=1, streams=2, frame_shape=FRAME_SHAPE) as pool:
+            first = pool.detect(0, self.frame(0))
+            second = pool.detect(0, self.frame(5))
+            other = pool.detect(1, self.frame(5))
+        
+        assert first['landmarks'] is None
+        assert (first['sequence'], second['sequence'], other['sequence']) == (0, 1, 0)
+    
+    def test_detector_per_worker(self):
+        """Test by default each worker builds its own detector after the fork."""
+        with DetectorWorkerPool(self.factory, workers=2, streams=2, frame_shape=FRAME_SHAPE) as pool:
+            result = pool.detect(1, self.frame(3))
+            pids = pool.worker_pids
+        
+        assert self.constructed == 0
+        assert int(result['landmarks'][0, 2]) == pids[1]
+    
+    def test_worker_error_returns_none(self):
+        """Test an inference exception in a worker is reported as a failed result."""
+        with DetectorWorkerPool(self.factory, workers=1, streams=1, frame_shape=FRAME_SHAPE) as pool:
+            assert pool.detect(0, self.frame(7)) is None
+            assert pool.detect(0, self.frame(8))['landmarks'] is not None
+    
+    def test_worker_memory(self):
+        """Test worker memory is reported per worker where /proc is available."""
+        with DetectorWorkerPool(self.factory, workers=2, streams=2, frame_shape=FRAME_SHAPE) as pool:
+            memory = pool.worker_memory()
+        
+        assert len(memory) == 2
+        if memory[0]:
+            assert memory[0]['rss_mb'] >= memory[0]['private_mb'] > 0.0
+    
+    def test_invalid_arguments(self):
+        """Test invalid pool sizes, stream IDs and frame shapes are rejected."""
+        with pytest.raises(ValueError):
+            DetectorWorkerPool(self.factory, workers=0)
+        with DetectorWorkerPool(self.factory, workers=1, streams=1, frame_shape=FRAME_SHAPE) as pool:
+            with pytest.raises(ValueError):
+                pool.detect(1, self.frame(1))
+            with pytest.raises(ValueError):
+                pool.detect(0, np.zeros((2, 2, 3), dtype=np.uint8))
+    
+    def test_workers_capped_by_streams(self):
+        """Test no idle workers are forked for fewer streams."""
+        pool = DetectorWorkerPool(self.factory, workers=8, streams=3)
+        assert pool.workers == 3
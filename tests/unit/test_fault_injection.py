@@ -0,0 +1,171 @@
+"""
+Unit tests for the fault and latency injection wrappers.
+"""
+
+from unittest.mock import Mock
+
+import numpy as np
+import pytest
+
+from src.controllers.camera_manager import CameraManager
+from src.controllers.fault_injection import (
+    NO_FAULT, FaultSchedule, FaultSpec, FaultyCamera, FaultyMouseController, FaultyPoseDetector
+)
+from src.controllers.mouse_controller import MouseControlError
+from src.models.enums import ControlState
+from src.utils.clock import VirtualClock
+
+
+class CountingCapture:
+    """Capture returning a new frame every 1/30 s of virtual time."""
+    def __init__(self, clock):
+        self.clock = clock
+        self.count = 0
+
+    def read(self):
+        self.clock.advance(1 / 30)
+        self.count += 1
+        return True, np.full((24, 32, 3), self.count % 256, dtype=np.uint8)
+
+    def isOpened(self):
+        return True
+
+    def set(self, prop, value):
+        return False
+
+    def release(self):
+        pass
+
+
+def make_camera(clock, spec, seed=0):
+    """Return a started FaultyCamera around a CameraManager reading a CountingCapture."""
+    camera = CameraManager(read_timeout=None, clock=clock)
+    capture = CountingCapture(clock)
+    camera._open_capture = lambda: capture
+    faulty = FaultyCamera(camera, FaultSchedule(spec, seed=seed, clock=clock))
+    assert faulty.start_capture()
+    return faulty, capture
+
+
+class TestFaultSchedule:
+    """Test cases for FaultSpec and FaultSchedule."""
+
+    def test_invalid_spec(self):
+        """Test probabilities, durations and windows are validated."""
+        with pytest.raises(ValueError):
+            FaultSpec(failure_probability=1.5)
+        with pytest.raises(ValueError):
+            FaultSpec(delay_s=-0.1)
+        with pytest.raises(ValueError):
+            FaultSpec(start_s=5.0, end_s=1.0)
+
+    def test_same_seed_same_faults(self):
+        """Test a seed reproduces the fault sequence and another seed changes it."""
+        spec = FaultSpec(delay_s=0.1, delay_probability=0.3, failure_probability=0.2)
+
+        def draw(seed):
+            schedule = FaultSchedule(spec, seed=seed, clock=VirtualClock())
+            return [schedule.next_fault() for _ in range(200)]
+
+        assert draw(7) == draw(7)
+        assert draw(7) != draw(8)
+        faults = draw(7)
+        assert 20 < sum(fault.fail for fault in faults) < 60
+        assert all(fault.delay_s in (0.0, 0.1) for fault in faults)
+
+    def test_window(self):
+        """Test faults are only injected while the window is open."""
+        clock = VirtualClock()
+        schedule = FaultSchedule(FaultSpec(failure_probability=1.0, start_s=1.0, end_s=2.0), clock=clock)
+
+        assert schedule.next_fault() == NO_FAULT
+        clock.advance(1.5)
+        assert schedule.next_fault().fail
+        clock.advance(1.0)
+        assert schedule.next_fault() == NO_FAULT
+        assert schedule.get_stats() == {'calls': 3, 'delays': 0, 'failures': 1, 'freezes': 0}
+
+
+class TestFaultyCamera:
+    """Test cases for FaultyCamera."""
+
+    def test_slow_reads_take_virtual_time(self):
+        """Test injected read delays advance the clock."""
+        clock = VirtualClock()
+        camera, _ = make_camera(clock, FaultSpec(delay_s=0.2))
+        start = clock.now()
+
+        assert camera.get_frame() is not None
+
+        assert clock.now() - start == pytest.approx(0.2 + 1 / 30)
+
+    def test_failed_reads(self):
+        """Test injected failures surface as failed CameraManager reads."""
+        clock = VirtualClock()
+        camera, capture = make_camera(clock, FaultSpec(failure_probability=1.0))
+        reads = capture.count
+
+        assert camera.get_frame() is None
+        assert capture.count == reads + 1
+        assert camera.is_available()
+
+    def test_freeze_detected_and_outlives_reconnect(self):
+        """Test a frozen feed trips frozen detection and stays frozen after reconnecting."""
+        clock = VirtualClock()
+        camera, _ = make_camera(clock, FaultSpec(freeze_probability=1.0, freeze_s=1.0, start_s=0.05))
+
+        frames = [camera.get_frame() for _ in range(10)]
+
+        assert frames[0] is not None
+        assert frames[-1] is None
+        assert camera.is_frozen() and not camera.is_available()
+        assert camera.frozen_events == 1
+
+        assert camera.reconnect()
+        assert camera.is_frozen_by_fault()
+        for _ in range(10):
+            camera.get_frame()
+        assert camera.frozen_events == 2
+
+        clock.advance(1.0)
+        camera.schedule.spec.freeze_probability = 0.0
+        assert camera.reconnect()
+        assert camera.get_frame() is not None
+
+
+class TestFaultyComponents:
+    """Test cases for FaultyPoseDetector and FaultyMouseController."""
+
+    def test_detector_spike_and_failure(self):
+        """Test detector calls are delayed or fail and other methods pass through."""
+        clock = VirtualClock()
+        detector = Mock()
+        detector.detect_pose.return_value = 'pose'
+        faulty = FaultyPoseDetector(detector, FaultSchedule(FaultSpec(delay_s=0.15), clock=clock))
+
+        assert faulty.detect_pose(None) == 'pose'
+        assert clock.now() == pytest.approx(0.15)
+        faulty.get_arm_keypoints('pose')
+        detector.get_arm_keypoints.assert_called_once_with('pose')
+
+        failing = FaultyPoseDetector(detector, FaultSchedule(FaultSpec(failure_probability=1.0), clock=clock))
+        with pytest.raises(RuntimeError):
+            failing.detect_pose(None)
+
+    def test_mouse_blocks_and_fails(self):
+        """Test mouse state changes are delayed or fail before reaching the backend."""
+        clock = VirtualClock()
+        mouse = Mock()
+        blocking = FaultyMouseController(mouse, FaultSchedule(FaultSpec(delay_s=0.3), clock=clock))
+
+        blocking.set_state(ControlState.LEFT_CLICK)
+
+        assert clock.now() == pytest.approx(0.3)
+        mouse.set_state.assert_called_once_with(ControlState.LEFT_CLICK)
+
+        failing = FaultyMouseController(mouse, FaultSchedule(FaultSpec(failure_probability=1.0), clock=clock))
+        with pytest.raises(MouseControlError):
+            failing.set_state(ControlState.NEUTRAL)
+        assert mouse.set_state.call_count == 1
+        failing.release_all()
+        mouse.release_all.assert_called_once()
@@ -0,0 +1,173 @@
+"""
+Unit tests for the flight recorder.
+
+Tests the fixed memory footprint, ring wrap-around order, automatic triggers
+for stalls and latency spikes, rate limiting and the dump file contents.
+"""
+
+import os
+import tempfile
+
+import numpy as np
+import pytest
+
+from src.models.enums import ControlState
+from src.models.landmark_record import record_angle, record_control_state, record_landmarks
+from src.utils.flight_recorder import FLIGHT_STAGES, FlightRecorder, load_flight_dump
+
+
+class FakeClock:
+    """Manually advanced monotonic clock."""
+    
+    def __init__(self):
+        self.now = 100.0
+    
+    def __call__(self):
+        return self.now
+
+
+def solid_frame(value):
+    """Create a 48x64 BGR frame filled with value."""
+    return np.full((48, 64, 3), value, dtype=np.uint8)
+
+
+class TestFlightRecorder:
+    """Test cases for FlightRecorder."""
+    
+    def setup_method(self):
+        """Set up a small recorder writing to a temporary directory."""
+        self.temp_dir = tempfile.TemporaryDirectory()
+        self.clock = FakeClock()
+        self.recorder = FlightRecorder(
+            capacity=4,
+            thumbnail_size=(16, 12),
+            output_dir=self.temp_dir.name,
+            stall_threshold=0.5,
+            latency_spike_ms=100.0,
+            min_dump_interval=5.0,
+            warmup_frames=0,
+            clock=self.clock
+        )
+    
+    def teardown_method(self):
+        """Wait for dumps and remove the temporary directory."""
+        self.recorder.close()
+        self.temp_dir.cleanup()
+    
+    def record_frames(self, count, start=0):
+        """Record count frames 33 ms apart with frame index as pixel value."""
+        for index in range(start, start + count):
+            self.clock.now += 0.033
+            self.recorder.record(solid_frame(index), angle=float(index), control_state=ControlState.NEUTRAL)
+    
+    def test_memory_is_fixed(self):
+        """Test memory is allocated up front and does not grow with frames."""
+        before = self.recorder.memory_bytes
+        assert before >= 4 * 16 * 12 * 3
+        self.record_frames(10)
+        assert self.recorder.memory_bytes == before
+        assert self.recorder.frame_count == 10
+    
+    def test_for_duration(self):
+        """Test capacity is derived from seconds of history and FPS."""
+        recorder = FlightRecorder.for_duration(2.0, fps=15.0, thumbnail_size=(8, 8))
+        assert recorder.capacity == 30
+    
+    def test_invalid_parameters(self):
+        """Test invalid sizes raise ValueError."""
+        with pytest.raises(ValueError):
+            FlightRecorder(capacity=0)
+        with pytest.raises(ValueError):
+            FlightRecorder(thumbnail_size=(0, 10))
+        with pytest.raises(ValueError):
+            FlightRecorder(latency_spike_ms=0)
+        with pytest.raises(ValueError):
+            FlightRecorder(warmup_frames=-1)
+    
+    def test_trigger_on_empty_ring(self):
+        """Test nothing is dumped before any frame is recorded."""
+        assert self.recorder.trigger('hotkey') is False
+    
+    def test_dump_is_oldest_first_after_wrap(self):
+        """Test a dump after wrap-around holds the last capacity frames in order."""
+        self.record_frames(6)
+        assert self.recorder.trigger('hotkey') is True
+        assert self.recorder.wait_for_dump(5.0)
+        
+        dump = load_flight_dump(self.recorder.last_dump_path)
+        assert dump['reason'] == 'hotkey'
+        assert dump['stages'] == FLIGHT_STAGES
+        assert dump['thumbnails'].shape == (4, 12, 16, 3)
+        assert [int(thumbnail[0, 0, 0]) for thumbnail in dump['thumbnails']] == [2, 3, 4, 5]
+        assert list(dump['records']['sequence']) == [2, 3, 4, 5]
+        assert record_angle(dump['records'][0]) == 2.0
+        assert record_control_state(dump['records'][0]) == ControlState.NEUTRAL
+    
+    def test_landmarks_and_timings_recorded(self):
+        """Test landmarks (to codec precision) and stage timings are stored per frame."""
+        landmarks = np.random.default_rng(0).random((33, 4), dtype=np.float32)
+        self.recorder.record(solid_frame(1), landmarks=landmarks, timings_ms={'capture': 1.5, 'inference': 20.0})
+        self.recorder.trigger('hotkey')
+        self.recorder.wait_for_dump(5.0)
+        
+        dump = load_flight_dump(self.recorder.last_dump_path)
+        np.testing.assert_allclose(record_landmarks(dump['records'][0])[0], landmarks, atol=1e-4)
+        np.testing.assert_allclose(dump['timings_ms'][0], [1.5, 20.0, 0.0, 0.0])
+    
+    def test_stall_triggers_dump(self):
+        """Test a gap between frames longer than the threshold triggers a dump."""
+        self.record_frames(2)
+        self.clock.now += 1.0
+        assert self.recorder.record(solid_frame(0)) == 'stall'
+        assert self.recorder.wait_for_dump(5.0)
+        assert os.path.exists(self.recorder.last_dump_path)
+    
+    def test_latency_spike_triggers_dump(self):
+        """Test a frame whose stages exceed the spike threshold triggers a dump."""
+        self.record_frames(1)
+        reason = self.recorder.record(solid_frame(0), timings_ms={'inference': 80.0, 'display': 30.0})
+        assert reason == 'latency_spike'
+    
+    def test_triggers_armed_after_warmup(self):
+        """Test a slow first inference or a startup gap does not dump during the warm-up."""
+        recorder = FlightRecorder(capacity=4, output_dir=self.temp_dir.name, stall_threshold=0.5,
+                                  latency_spike_ms=100.0, warmup_frames=2, clock=self.clock)
+        assert recorder.record(solid_frame(0), timings_ms={'inference': 400.0}) is None
+        self.clock.now += 1.0
+        assert recorder.record(solid_frame(1)) is None
+        assert recorder.dump_count == 0
+        
+        assert recorder.record(solid_frame(2), timings_ms={'inference': 400.0}) == 'latency_spike'
+        recorder.close()
+    
+    def test_automatic_dumps_are_rate_limited(self):
+        """Test repeated anomalies within min_dump_interval write a single dump."""
+        self.record_frames(1)
+        assert self.recorder.report_anomaly('exception') is True
+        self.recorder.wait_for_dump(5.0)
+        self.clock.now += 1.0
+        assert self.recorder.report_anomaly('exception') is False
+        self.clock.now += 5.0
+        assert self.recorder.report_anomaly('exception') is True
+        assert self.recorder.dump_count == 2
+    
+    def test_failed_dump_is_counted_and_not_reported(self, monkeypatch):
+        """Test a dump that fails to write leaves last_dump_path on the last complete dump."""
+        self.record_frames(2)
+        self.recorder.trigger('hotkey')
+        self.recorder.wait_for_dump(5.0)
+        written = self.recorder.last_dump_path
+        
+        def failing_savez(path, **arrays):
+            with open(path, 'wb') as partial:
+                partial.write(b'PK')
+            raise ValueError("cannot serialize")
+        
+        monkeypatch.setattr(np, 'savez', failing_savez)
+        assert self.recorder.trigger('hotkey') is True
+        assert self.recorder.wait_for_dump(5.0)
+        
+        assert self.recorder.failed_dumps == 1
+        assert self.recorder.dump_count == 2
+        assert self.recorder.last_dump_path == written
+        assert os.listdir(self.temp_dir.name) == [os.path.basename(written)]
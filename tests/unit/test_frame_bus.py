@@ -0,0 +1,149 @@
+"""
+Unit tests for the reference-counted frame bus.
+"""
+
+import threading
+
+import numpy as np
+import pytest
+
+from src.utils.frame_bus import FrameBus
+
+
+def frame(value, shape=(4, 6, 3)):
+    """Create a uniformly filled frame."""
+    return np.full(shape, value, dtype=np.uint8)
+
+
+class TestFrameBus:
+    """Test cases for FrameBus."""
+    
+    def test_invalid_arguments(self):
+        """Test pool size and subscription parameters are validated."""
+        with pytest.raises(ValueError):
+            FrameBus(pool_size=1)
+        bus = FrameBus()
+        with pytest.raises(ValueError):
+            bus.subscribe('preview', max_fps=0)
+        with pytest.raises(ValueError):
+            bus.subscribe('preview', depth=0)
+        with pytest.raises(ValueError):
+            bus.subscribe('preview', policy='random')
+        with pytest.raises(RuntimeError):
+            bus.commit()
+    
+    def test_publish_without_subscribers_copies_nothing(self):
+        """Test frames are not copied or pooled while nobody listens."""
+        bus = FrameBus()
+        
+        assert bus.publish(frame(1)) is None
+        assert bus.get_stats()['published'] == 0
+        assert bus.get_stats()['free_buffers'] == 0
+    
+    def test_subscribers_share_one_read_only_buffer(self):
+        """Test every subscriber gets the same buffer, returned to the pool on the last release."""
+        bus = FrameBus(pool_size=2)
+        display = bus.subscribe('display')
+        recorder = bus.subscribe('recorder')
+        source = frame(7)
+        
+        assert bus.publish(source, timestamp=1.0) == 0
+        source[:] = 0
+        first, second = display.get(), recorder.get()
+        
+        assert first.frame is second.frame
+        assert first.frame.max() == 7 and first.sequence == 0 and first.timestamp == 1.0
+        with pytest.raises(ValueError):
+            first.frame[0, 0, 0] = 1
+        assert bus.get_stats()['free_buffers'] == 1
+        
+        first.release()
+        first.release()
+        assert bus.get_stats()['free_buffers'] == 1
+        with second:
+            pass
+        assert bus.get_stats()['free_buffers'] == 2
+    
+    def test_drop_policies(self):
+        """Test a full queue drops its oldest frame or the new one, by policy."""
+        bus = FrameBus(pool_size=4)
+        latest = bus.subscribe('detector', depth=1, policy='oldest')
+        queued = bus.subscribe('recorder', depth=2, policy='newest')
+        for value in range(4):
+            bus.publish(frame(value), timestamp=float(value))
+        
+        assert latest.get().frame.max() == 3
+        assert [queued.get().sequence, queued.get().sequence] == [0, 1]
+        assert latest.get() is None
+        assert latest.get_stats()['dropped'] == 3
+        assert queued.get_stats() == {'delivered': 2, 'dropped': 2, 'rate_skipped': 0, 'queued': 0}
+    
+    def test_rate_limit_per_subscriber(self):
+        """Test max_fps thins one subscriber's frames without affecting another."""
+        bus = FrameBus()
+        detector = bus.subscribe('detector', depth=8)
+        preview = bus.subscribe('preview', max_fps=10, depth=8)
+        for index in range(6):
+            bus.publish(frame(index), timestamp=index / 30)
+        
+        sequences = []
+        while (ref := preview.get()) is not None:
+            sequences.append(ref.sequence)
+            ref.release()
+        
+        assert sequences == [0, 3]
+        assert preview.get_stats()['rate_skipped'] == 4
+        assert detector.get_stats()['queued'] == 6
+    
+    def test_exhausted_pool_drops_frames(self):
+        """Test held references starve the pool and close() releases them."""
+        bus = FrameBus(pool_size=2)
+        slow = bus.subscribe('slow', depth=2, policy='newest')
+        
+        assert bus.publish(frame(1)) == 0
+        assert bus.publish(frame(2)) == 1
+        assert bus.publish(frame(3)) is None
+        assert bus.get_stats()['pool_exhausted'] == 1
+        
+        slow.close()
+        assert bus.get_stats()['free_buffers'] == 2
+        assert not bus.has_subscribers()
+    
+    def test_claim_commit_in_place_and_format_change(self):
+        """Test producers fill buffers in place and a new frame shape replaces the pool."""
+        bus = FrameBus(pool_size=2)
+        consumer = bus.subscribe('consumer')
+        
+        buffer = bus.claim((4, 6, 3))
+        buffer[:] = 5
+        bus.commit(timestamp=2.0)
+        held = consumer.get()
+        
+        assert bus.publish(frame(9, shape=(2, 2, 3))) == 1
+        assert held.frame.shape == (4, 6, 3) and held.frame.max() == 5
+        held.release()
+        assert bus.get_stats()['free_buffers'] == 1
+        assert consumer.get().frame.shape == (2, 2, 3)
+    
+    def test_cross_thread_consumer(self):
+        """Test a consumer thread waiting in get() receives published frames."""
+        bus = FrameBus()
+        subscription = bus.subscribe('worker', depth=8)
+        received = []
+        
+        def consume():
+            while len(received) < 5:
+                ref = subscription.get(timeout=2.0)
+                if ref is None:
+                    return
+                with ref:
+                    received.append(int(ref.frame.max()))
+        
+        worker = threading.Thread(target=consume)
+        worker.start()
+        for value in range(5):
+            bus.publish(frame(value))
+        worker.join(timeout=5.0)
+        
+        assert received == [0, 1, 2, 3, 4]
+        assert bus.get_stats()['free_buffers'] == bus.pool_size
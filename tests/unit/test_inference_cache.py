@@ -0,0 +1,202 @@
+"""
+Unit tests for the content-addressed inference result cache.
+
+Tests frame hashing, store and lookup, persistence across reopen, recovery
+from a partially written tail and the CachedPoseDetector wrapper.
+"""
+
+import os
+import tempfile
+from unittest.mock import Mock
+
+import numpy as np
+import pytest
+
+from src.controllers.inference_cache import (
+    KEYS_FILE, RECORDS_FILE, CachedPoseDetector, InferenceCache, frame_hash, model_cache_key
+)
+from src.controllers.pose_detector import landmarks_from_array, landmarks_to_array
+
+
+def random_landmarks(seed=0):
+    """Create random float32 landmarks of shape (33, 4)."""
+    return np.random.default_rng(seed).random((33, 4), dtype=np.float32)
+
+
+def random_frame(seed=0):
+    """Create a random BGR frame."""
+    return np.random.default_rng(seed).integers(0, 256, (48, 64, 3), dtype=np.uint8)
+
+
+class TestFrameHash:
+    """Test cases for frame_hash."""
+    
+    def test_hash_is_stable_for_equal_content(self):
+        """Test equal frames hash equal even when one is a non-contiguous view."""
+        frame = random_frame()
+        padded = np.zeros((48, 128, 3), dtype=np.uint8)
+        padded[:, ::2] = frame
+        assert frame_hash(frame) == frame_hash(frame.copy())
+        assert frame_hash(frame) == frame_hash(padded[:, ::2])
+    
+    def test_hash_changes_with_content_and_shape(self):
+        """Test a single pixel or a different shape changes the hash."""
+        frame = random_frame()
+        changed = frame.copy()
+        changed[10, 10, 0] ^= 1
+        assert frame_hash(frame) != frame_hash(changed)
+        assert frame_hash(frame) != frame_hash(frame.reshape(64, 48, 3))
+        assert 0 <= frame_hash(frame) < 2 ** 64
+
+
+class TestInferenceCache:
+    """Test cases for InferenceCache."""
+    
+    def setup_method(self):
+        """Set up a temporary cache directory."""
+        self.temp_dir = tempfile.TemporaryDirectory()
+        self.model_key = model_cache_key('mediapipe', 1, 0.5)
+    
+    def teardown_method(self):
+        """Remove the temporary cache directory."""
+        self.temp_dir.cleanup()
+    
+    def test_store_and_lookup(self):
+        """Test stored landmarks and no-pose results are returned on lookup."""
+        landmarks = random_landmarks()
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            assert cache.lookup(1) == (False, None)
+            cache.store(1, landmarks)
+            cache.store(2, None)
+            
+            found, cached = cache.lookup(1)
+            assert found
+            np.testing.assert_array_equal(cached, landmarks)
+            assert cache.lookup(2) == (True, None)
+            assert len(cache) == 2
+            assert cache.get_stats() == {'hits': 2, 'misses': 1, 'hit_rate': 2 / 3, 'entries': 2}
+    
+    def test_entries_persist_across_reopen(self):
+        """Test a reopened cache serves entries from the memory-mapped file."""
+        landmarks = random_landmarks()
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            cache.store(7, landmarks)
+            cache.store(8, None)
+        
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            assert len(cache) == 2
+            np.testing.assert_array_equal(cache.lookup(7)[1], landmarks)
+            assert cache.lookup(8) == (True, None)
+            cache.store(9, landmarks)
+        
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            assert len(cache) == 3
+            assert cache.lookup(9)[0]
+    
+    def test_model_configurations_are_separate(self):
+        """Test results for one model configuration are not served for another."""
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            cache.store(1, random_landmarks())
+        
+        with InferenceCache(self.temp_dir.name, model_cache_key('mediapipe', 2, 0.5)) as cache:
+            assert len(cache) == 0
+            assert cache.lookup(1) == (False, None)
+    
+    def test_partial_tail_is_dropped(self):
+        """Test a cache with a torn last write keeps only complete entries."""
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            cache.store(1, random_landmarks())
+            cache.store(2, random_landmarks(seed=1))
+            directory = cache.directory
+        
+        with open(os.path.join(directory, RECORDS_FILE), 'ab') as records_file:
+            records_file.write(b'\x00' * 10)
+        keys_path = os.path.join(directory, KEYS_FILE)
+        os.truncate(keys_path, os.path.getsize(keys_path) - 8)
+        
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            assert len(cache) == 1
+            assert cache.lookup(1)[0]
+            assert not cache.lookup(2)[0]
+    
+    def test_duplicate_store_is_ignored(self):
+        """Test storing a key twice keeps the first result."""
+        first = random_landmarks()
+        with InferenceCache(self.temp_dir.name, self.model_key) as cache:
+            cache.store(1, first)
+            cache.store(1, random_landmarks(seed=1))
+            assert len(cache) == 1
+            np.testing.assert_array_equal(cache.lookup(1)[1], first)
+
+
+class TestCachedPoseDetector:
+    """Test cases for CachedPoseDetector."""
+    
+    def setup_method(self):
+        """Set up a cache and a mock detector factory."""
+        self.temp_dir = tempfile.TemporaryDirectory()
+        self.cache = InferenceCache(self.temp_dir.name, model_cache_key('mediapipe', 1, 0.5))
+        self.landmarks = landmarks_from_array(random_landmarks())
+        self.inner = Mock()
+        self.inner.detect_pose.return_value = self.landmarks
+        self.factory = Mock(return_value=self.inner)
+        self.detector = CachedPoseDetector(self.cache, self.factory)
+    
+    def teardown_method(self):
+        """Close the cache and remove the directory."""
+        self.cache.close()
+        self.temp_dir.cleanup()
+    
+    def test_model_not_created_until_miss(self):
+        """Test the wrapped detector is created lazily on the first miss."""
+        assert self.detector.detector is None
+        self.factory.assert_not_called()
+        
+        self.detector.detect_pose(random_frame())
+        self.factory.assert_called_once()
+        assert self.detector.detector is self.inner
+    
+    def test_repeated_frame_skips_inference(self):
+        """Test a repeated frame is answered from the cache."""
+        frame = random_frame()
+        first = self.detector.detect_pose(frame)
+        second = self.detector.detect_pose(frame.copy())
+        
+        assert self.inner.detect_pose.call_count == 1
+        assert first is self.landmarks
+        np.testing.assert_array_equal(landmarks_to_array(second), landmarks_to_array(self.landmarks))
+        assert self.detector.is_pose_detected()
+        assert self.cache.get_stats()['hits'] == 1
+    
+    def test_no_pose_result_is_cached(self):
+        """Test frames without a pose are cached as misses of the detector."""
+        self.inner.detect_pose.return_value = None
+        frame = random_frame()
+        assert self.detector.detect_pose(frame) is None
+        assert self.detector.detect_pose(frame) is None
+        assert self.inner.detect_pose.call_count == 1
+        assert not self.detector.is_pose_detected()
+    
+    def test_fully_cached_replay_never_loads_model(self):
+        """Test a second detector over cached frames never calls its factory."""
+        frames = [random_frame(seed) for seed in range(3)]
+        for frame in frames:
+            self.detector.detect_pose(frame)
+        
+        factory = Mock()
+        detector = CachedPoseDetector(self.cache, factory)
+        for frame in frames:
+            assert detector.detect_pose(frame) is not None
+        factory.assert_not_called()
+    
+    def test_invalid_frame(self):
+        """Test invalid frames raise ValueError before any lookup."""
+        with pytest.raises(ValueError):
+            self.detector.detect_pose("not a frame")
+        with pytest.raises(ValueError):
+            self.detector.detect_pose(np.zeros((10, 10), dtype=np.uint8))
+    
+    def test_invalid_confidence(self):
+        """Test an out-of-range confidence threshold is rejected."""
+        with pytest.raises(ValueError):
+            CachedPoseDetector(self.cache, self.factory, confidence_threshold=1.5)
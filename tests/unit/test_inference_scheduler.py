@@ -0,0 +1,59 @@
+"""
+Unit tests for decision-aware inference scheduling.
+"""
+
+import pytest
+
+from src.utils.inference_scheduler import InferenceScheduler
+
+
+class TestInferenceScheduler:
+    """Test cases for InferenceScheduler."""
+    
+    def test_invalid_arguments(self):
+        """Test parameters are validated."""
+        with pytest.raises(ValueError):
+            InferenceScheduler(max_interval=-1.0)
+        with pytest.raises(ValueError):
+            InferenceScheduler(safety_factor=0.5)
+        with pytest.raises(ValueError):
+            InferenceScheduler(idle_speed=0.0)
+        with pytest.raises(ValueError):
+            InferenceScheduler(velocity_smoothing=0.0)
+    
+    def test_steady_arm_far_from_thresholds_skips_frames(self):
+        """Test a still arm deep in a band is inferred at most every max_interval."""
+        scheduler = InferenceScheduler(max_interval=0.25, idle_speed=100.0)
+        inferred = []
+        for index in range(64):
+            now = index / 32
+            if scheduler.should_infer(now):
+                inferred.append(index)
+                scheduler.record(now, 150.0, 60.0)
+        
+        stats = scheduler.get_stats()
+        assert stats['frames'] == 64
+        assert stats['inferences'] == len(inferred) == 8
+        assert stats['inference_rate'] == pytest.approx(8 / 64)
+        assert all(b - a == 8 for a, b in zip(inferred, inferred[1:]))
+    
+    def test_interval_shrinks_with_margin_and_speed(self):
+        """Test small margins and fast movement bring the next inference closer."""
+        scheduler = InferenceScheduler(max_interval=1.0, safety_factor=2.0, idle_speed=100.0,
+                                       velocity_smoothing=1.0)
+        
+        assert scheduler.record(0.0, 75.0, 15.0) == pytest.approx(0.15)
+        assert scheduler.record(0.1, 75.0, 1.0) == pytest.approx(0.01)
+        # Moving at 100 deg/s, 20 degrees from a threshold: 20 / (100 * 2 + 100)
+        assert scheduler.record(0.2, 85.0, 20.0) == pytest.approx(20.0 / 300.0)
+        assert scheduler.record(0.3, 85.0, 0.0) == 0.0
+    
+    def test_invalidate_forces_inference(self):
+        """Test invalidation makes the next frame run inference."""
+        scheduler = InferenceScheduler()
+        assert scheduler.should_infer(0.0)
+        scheduler.record(0.0, 150.0, 60.0)
+        assert not scheduler.should_infer(0.05)
+        scheduler.invalidate()
+        assert scheduler.should_infer(0.06)
+        assert scheduler.get_stats()['skipped'] == 1
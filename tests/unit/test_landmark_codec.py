@@ -0,0 +1,159 @@
+"""
+Unit tests for the delta and quantized landmark codec.
+
+Tests quantization bounds, sequence round trips with missing poses and
+keyframes, the per-frame stream encoder and decoder, and the error report.
+"""
+
+import numpy as np
+import pytest
+
+from src.models.landmark_codec import (
+    QUANT_SCALE, LandmarkStreamDecoder, LandmarkStreamEncoder, codec_report,
+    decode_landmark_sequence, dequantize, elbow_angles, encode_landmark_sequence, quantize
+)
+from src.utils.angle_calculator import AngleCalculator
+from src.models.data_models import Point
+
+
+def landmark_walk(frames=100, seed=0):
+    """Create a smooth random walk of (frames, 33, 4) landmarks."""
+    rng = np.random.default_rng(seed)
+    base = rng.random((33, 4), dtype=np.float32) * 0.6 + 0.2
+    steps = rng.normal(0.0, 0.002, (frames, 33, 4)).astype(np.float32)
+    return base + np.cumsum(steps, axis=0)
+
+
+HALF_STEP = 0.5 / QUANT_SCALE + 1e-7
+
+
+class TestQuantization:
+    """Test cases for quantize and dequantize."""
+    
+    def test_round_trip_error_is_half_step(self):
+        """Test reconstruction error is at most half a quantization step."""
+        values = np.random.default_rng(0).uniform(-2.0, 2.0, 1000).astype(np.float32)
+        assert np.abs(dequantize(quantize(values)) - values).max() <= HALF_STEP
+    
+    def test_out_of_range_saturates(self):
+        """Test values beyond the int16 range saturate instead of wrapping."""
+        assert quantize(np.array([100.0, -100.0])).tolist() == [32767, -32768]
+
+
+class TestSequenceCodec:
+    """Test cases for encode_landmark_sequence and decode_landmark_sequence."""
+    
+    def setup_method(self):
+        """Set up a landmark sequence with a few missing poses."""
+        self.landmarks = landmark_walk(100)
+        self.present = np.ones(100, dtype=bool)
+        self.present[[0, 10, 11, 50]] = False
+    
+    @pytest.mark.parametrize("compress", [False, True])
+    @pytest.mark.parametrize("keyframe_interval", [1, 7, 30, 1000])
+    def test_round_trip(self, compress, keyframe_interval):
+        """Test decoded frames match to half a step and the mask is preserved."""
+        encoded = encode_landmark_sequence(self.landmarks, self.present, keyframe_interval, compress)
+        decoded, present = decode_landmark_sequence(encoded)
+        
+        assert decoded.shape == self.landmarks.shape
+        np.testing.assert_array_equal(present, self.present)
+        assert np.abs(decoded[present] - self.landmarks[present]).max() <= HALF_STEP
+    
+    def test_compression_beats_raw(self):
+        """Test a smooth sequence compresses well below float32 size."""
+        encoded = encode_landmark_sequence(self.landmarks, self.present, compress=True)
+        assert len(encoded) * 3 < self.landmarks.nbytes
+        assert len(encode_landmark_sequence(self.landmarks, compress=False)) < self.landmarks.nbytes
+    
+    def test_empty_sequence(self):
+        """Test a sequence without frames round-trips."""
+        decoded, present = decode_landmark_sequence(encode_landmark_sequence(np.zeros((0, 33, 4))))
+        assert decoded.shape == (0, 33, 4)
+        assert present.shape == (0,)
+    
+    def test_invalid_input(self):
+        """Test malformed input raises ValueError."""
+        with pytest.raises(ValueError):
+            encode_landmark_sequence(np.zeros((5, 33)))
+        with pytest.raises(ValueError):
+            encode_landmark_sequence(self.landmarks, np.ones(3, dtype=bool))
+        with pytest.raises(ValueError):
+            encode_landmark_sequence(self.landmarks, keyframe_interval=0)
+        with pytest.raises(ValueError):
+            decode_landmark_sequence(b'nope' * 10)
+        encoded = encode_landmark_sequence(self.landmarks, compress=True)
+        with pytest.raises(ValueError):
+            decode_landmark_sequence(encoded[:-10])
+
+
+class TestStreamCodec:
+    """Test cases for the per-frame stream encoder and decoder."""
+    
+    def setup_method(self):
+        """Set up an encoder and decoder pair."""
+        self.encoder = LandmarkStreamEncoder(keyframe_interval=4)
+        self.decoder = LandmarkStreamDecoder()
+    
+    @pytest.mark.parametrize("compress", [False, True])
+    def test_stream_round_trip(self, compress):
+        """Test frames with and without poses decode in order."""
+        self.encoder.compress = compress
+        landmarks = landmark_walk(20)
+        for index, frame in enumerate(landmarks):
+            pose = None if index % 6 == 5 else frame
+            decoded = self.decoder.decode(self.encoder.encode(pose))
+            if pose is None:
+                assert decoded is None
+            else:
+                assert np.abs(decoded - pose).max() <= HALF_STEP
+    
+    def test_deltas_are_smaller_than_keyframes(self):
+        """Test only keyframes carry full values; no-pose frames are one byte."""
+        landmarks = landmark_walk(5)
+        keyframe = self.encoder.encode(landmarks[0])
+        delta = self.encoder.encode(landmarks[1])
+        assert len(keyframe) == len(delta) == 1 + 33 * 4 * 2
+        assert np.abs(np.frombuffer(delta[1:], dtype='<i2')).max() < np.abs(np.frombuffer(keyframe[1:], dtype='<i2')).max()
+        assert self.encoder.encode(None) == b'\x00'
+    
+    def test_delta_without_keyframe(self):
+        """Test a decoder joining mid-stream rejects deltas until a keyframe."""
+        landmarks = landmark_walk(6)
+        frames = [self.encoder.encode(frame) for frame in landmarks]
+        late_decoder = LandmarkStreamDecoder()
+        with pytest.raises(ValueError, match="keyframe"):
+            late_decoder.decode(frames[1])
+        assert late_decoder.decode(frames[4]) is not None  # keyframe_interval=4
+    
+    def test_malformed_frame(self):
+        """Test empty and truncated frames raise ValueError."""
+        with pytest.raises(ValueError):
+            self.decoder.decode(b'')
+        with pytest.raises(ValueError):
+            self.decoder.decode(bytes((3,)) + b'\x00' * 10)
+
+
+class TestCodecReport:
+    """Test cases for the compression and angle error report."""
+    
+    def test_elbow_angles_match_angle_calculator(self):
+        """Test the vectorized angle matches AngleCalculator."""
+        landmarks = landmark_walk(3)
+        angles = elbow_angles(landmarks)
+        for frame, frame_angles in zip(landmarks, angles):
+            for column, (shoulder, elbow, wrist) in enumerate(((11, 13, 15), (12, 14, 16))):
+                expected = AngleCalculator.calculate_elbow_angle(
+                    Point(*map(float, frame[shoulder, :3])),
+                    Point(*map(float, frame[elbow, :3])),
+                    Point(*map(float, frame[wrist, :3]))
+                )
+                assert frame_angles[column] == pytest.approx(expected, abs=1e-3)
+    
+    def test_report(self):
+        """Test the report shows compression and sub-degree angle error."""
+        report = codec_report(landmark_walk(200))
+        assert report['frames'] == 200
+        assert report['compression_ratio'] > 2.0
+        assert report['angle_error_max_deg'] < 0.5
+        assert report['raw_bytes'] == 200 * 33 * 4 * 4
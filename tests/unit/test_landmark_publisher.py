@@ -0,0 +1,150 @@
+"""
+Unit tests for the landmark publisher.
+"""
+
+import os
+import socket
+import tempfile
+import time
+
+import numpy as np
+import pytest
+
+from src.controllers.landmark_publisher import LandmarkPublisher, LandmarkSubscriber, parse_destination
+from src.models.enums import ControlState
+from src.models.landmark_record import record_angle, record_control_state, record_landmarks
+
+
+def free_udp_port() -> int:
+    """Return a UDP port that is currently unused."""
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as probe:
+        probe.bind(('127.0.0.1', 0))
+        return probe.getsockname()[1]
+
+
+class TestParseDestination:
+    """Test cases for parse_destination."""
+    
+    def test_valid_destinations(self):
+        """Test UDP and Unix destinations are parsed."""
+        assert parse_destination('udp://239.255.77.77:5577') == (socket.AF_INET, ('239.255.77.77', 5577))
+        assert parse_destination('unix:///tmp/landmarks.sock') == (socket.AF_UNIX, '/tmp/landmarks.sock')
+    
+    @pytest.mark.parametrize('destination', [
+        'tcp://127.0.0.1:1', 'udp://127.0.0.1', 'udp://:5000', 'udp://127.0.0.1:port',
+        'udp://127.0.0.1:70000', 'unix://'
+    ])
+    def test_invalid_destinations(self, destination):
+        """Test malformed destinations are rejected."""
+        with pytest.raises(ValueError):
+            parse_destination(destination)
+
+
+class TestLandmarkPublisher:
+    """Test cases for LandmarkPublisher."""
+    
+    def setup_method(self):
+        """Set up a landmark array."""
+        self.landmarks = np.random.default_rng(0).random((33, 4), dtype=np.float32)
+        self.temp_dir = tempfile.TemporaryDirectory()
+    
+    def teardown_method(self):
+        """Remove temporary sockets."""
+        self.temp_dir.cleanup()
+    
+    def round_trip(self, destination):
+        with LandmarkSubscriber(destination, timeout=2.0) as subscriber, \
+             LandmarkPublisher(destination, source_id=3) as publisher:
+            publisher.publish(7, 123.5, self.landmarks, angle=95.0, control_state=ControlState.RIGHT_CLICK)
+            publisher.publish(8, 123.6)
+            first = subscriber.receive()
+            second = subscriber.receive()
+        return first, second
+    
+    def check_records(self, first, second):
+        assert first is not None and second is not None
+        assert int(first['sequence']) == 7 and int(first['source_id']) == 3
+        assert first['timestamp'] == pytest.approx(123.5)
+        np.testing.assert_array_equal(record_landmarks(first)[0], self.landmarks)
+        assert record_angle(first) == pytest.approx(95.0)
+        assert record_control_state(first) == ControlState.RIGHT_CLICK
+        assert int(second['sequence']) == 8
+        assert record_landmarks(second) is None
+        assert record_control_state(second) is None
+    
+    def test_unix_datagram_round_trip(self):
+        """Test records arrive intact over a Unix datagram socket."""
+        destination = 'unix://' + os.path.join(self.temp_dir.name, 'landmarks.sock')
+        self.check_records(*self.round_trip(destination))
+    
+    def test_udp_round_trip(self):
+        """Test records arrive intact over unicast UDP."""
+        self.check_records(*self.round_trip(f'udp://127.0.0.1:{free_udp_port()}'))
+    
+    def test_multicast_round_trip(self):
+        """Test records arrive over a loopback multicast group."""
+        try:
+            self.check_records(*self.round_trip(f'udp://239.255.77.78:{free_udp_port()}'))
+        except OSError as e:
+            pytest.skip(f"multicast unavailable: {e}")
+    
+    def test_no_subscriber_never_blocks(self):
+        """Test publishing without a bound subscriber only counts send errors."""
+        destination = 'unix://' + os.path.join(self.temp_dir.name, 'nobody.sock')
+        with LandmarkPublisher(destination) as publisher:
+            start = time.perf_counter()
+            for sequence in range(100):
+                publisher.publish(sequence, 0.0, self.landmarks)
+            assert time.perf_counter() - start < 0.5
+            time.sleep(0.2)
+            stats = publisher.get_stats()
+        
+        assert stats['published'] == 100
+        assert stats['sent'] == 0
+        assert stats['send_errors'] + stats['dropped'] == 100
+    
+    def test_full_queue_drops_oldest(self):
+        """Test a stalled sender drops the oldest records instead of blocking."""
+        publisher = LandmarkPublisher('udp://127.0.0.1:9', queue_size=2)
+        publisher._running = True  # Accept records without a sender thread
+        for sequence in range(5):
+            publisher.publish(sequence, 0.0)
+        
+        assert publisher.get_stats()['dropped'] == 3
+        assert publisher._pending.qsize() == 2
+    
+    def test_publish_before_start_ignored(self):
+        """Test publishing on a stopped publisher does nothing."""
+        publisher = LandmarkPublisher('udp://127.0.0.1:9')
+        publisher.publish(0, 0.0)
+        assert publisher.get_stats()['published'] == 0
+    
+    def test_invalid_queue_size(self):
+        """Test queue_size must be positive."""
+        with pytest.raises(ValueError):
+            LandmarkPublisher('udp://127.0.0.1:9', queue_size=0)
+    
+    def test_subscriber_ignores_invalid_datagram(self):
+        """Test datagrams that are not landmark records are skipped."""
+        path = os.path.join(self.temp_dir.name, 'landmarks.sock')
+        with LandmarkSubscriber('unix://' + path, timeout=1.0) as subscriber:
+            with socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM) as sender:
+                sender.sendto(b'garbage', path)
+            assert subscriber.receive() is None
+        assert not os.path.exists(path)
+    
+    def test_subscriber_replaces_stale_socket_only(self):
+        """Test a leftover socket file is replaced but a regular file at the path is kept."""
+        path = os.path.join(self.temp_dir.name, 'landmarks.sock')
+        stale = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        stale.bind(path)
+        stale.close()
+        with LandmarkSubscriber('unix://' + path, timeout=1.0):
+            pass
+        
+        with open(path, 'w') as notes:
+            notes.write('keep me')
+        with pytest.raises(OSError, match="not a socket"):
+            LandmarkSubscriber('unix://' + path)
+        with open(path) as notes:
+            assert notes.read() == 'keep me'
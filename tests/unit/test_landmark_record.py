@@ -0,0 +1,179 @@
+"""
+Unit tests for the fixed-size binary landmark record format.
+
+Tests dtype layout, packing, byte and file round trips, zero-copy views
+and validation of foreign or mismatched data.
+"""
+
+import numpy as np
+import pytest
+
+from src.models.enums import ControlState
+from src.models.landmark_record import (
+    HEADER_ONLY_DTYPE, HEADER_SIZE, LANDMARK_RECORD_DTYPE, LandmarkRecordWriter, RECORD_VERSION,
+    create_records, decode_records, encode_record, landmark_record_dtype, open_record_file,
+    pack_record, record_angle, record_control_state, record_dtype_for_size, record_landmarks
+)
+
+
+def random_landmarks(poses=None, seed=0):
+    """Create random float32 landmarks of shape (33, 4) or (poses, 33, 4)."""
+    shape = (33, 4) if poses is None else (poses, 33, 4)
+    return np.random.default_rng(seed).random(shape, dtype=np.float32)
+
+
+class TestRecordDtype:
+    """Test cases for the record dtype layout."""
+    
+    def test_default_layout(self):
+        """Test the default record holds one pose after a 40 byte header."""
+        assert HEADER_ONLY_DTYPE.itemsize == HEADER_SIZE
+        assert LANDMARK_RECORD_DTYPE.itemsize == HEADER_SIZE + 33 * 4 * 4
+        assert LANDMARK_RECORD_DTYPE.fields['landmarks'][1] == HEADER_SIZE
+        assert LANDMARK_RECORD_DTYPE.fields['sequence'][1] % 8 == 0
+        assert LANDMARK_RECORD_DTYPE.fields['timestamp'][1] % 8 == 0
+    
+    def test_multi_pose_dtype(self):
+        """Test capacity scales with max_poses."""
+        dtype = landmark_record_dtype(max_poses=3)
+        assert dtype['landmarks'].shape == (3, 33, 4)
+        assert record_dtype_for_size(dtype.itemsize) == dtype
+    
+    def test_invalid_dtype_arguments(self):
+        """Test invalid capacities are rejected."""
+        with pytest.raises(ValueError, match="max_poses"):
+            landmark_record_dtype(max_poses=-1)
+        with pytest.raises(ValueError, match="num_landmarks"):
+            landmark_record_dtype(num_landmarks=0)
+        with pytest.raises(ValueError, match="invalid landmark record size"):
+            record_dtype_for_size(HEADER_SIZE + 7)
+
+
+class TestRecordRoundTrip:
+    """Test cases for encoding and decoding records."""
+    
+    def test_bytes_round_trip(self):
+        """Test every field survives encode and decode."""
+        landmarks = random_landmarks()
+        data = encode_record(42, 123.5, landmarks, source_id=3, angle=75.25,
+                             control_state=ControlState.RIGHT_CLICK)
+        
+        assert len(data) == LANDMARK_RECORD_DTYPE.itemsize
+        record = decode_records(data)[0]
+        
+        assert record['version'] == RECORD_VERSION
+        assert record['sequence'] == 42
+        assert record['timestamp'] == 123.5
+        assert record['source_id'] == 3
+        assert record_angle(record) == pytest.approx(75.25)
+        assert record_control_state(record) == ControlState.RIGHT_CLICK
+        np.testing.assert_array_equal(record_landmarks(record)[0], landmarks)
+    
+    def test_no_pose_record(self):
+        """Test records without a pose decode to None values."""
+        record = decode_records(encode_record(1, 0.0))[0]
+        assert record['pose_count'] == 0
+        assert record_landmarks(record) is None
+        assert record_angle(record) is None
+        assert record_control_state(record) is None
+    
+    def test_header_only_record(self):
+        """Test header-only records carry state without landmarks."""
+        data = encode_record(5, 1.0, angle=30.0, control_state=ControlState.NEUTRAL, dtype=HEADER_ONLY_DTYPE)
+        record = decode_records(data, HEADER_ONLY_DTYPE)[0]
+        assert len(data) == HEADER_SIZE
+        assert record_control_state(record) == ControlState.NEUTRAL
+        assert record_landmarks(record) is None
+        
+        with pytest.raises(ValueError, match="no landmark capacity"):
+            encode_record(5, 1.0, random_landmarks(), dtype=HEADER_ONLY_DTYPE)
+    
+    def test_multi_pose_round_trip(self):
+        """Test several poses in one record."""
+        dtype = landmark_record_dtype(max_poses=4)
+        landmarks = random_landmarks(poses=2)
+        record = decode_records(encode_record(9, 2.0, landmarks, dtype=dtype), dtype)[0]
+        
+        assert record['pose_count'] == 2
+        np.testing.assert_array_equal(record_landmarks(record), landmarks)
+    
+    def test_landmarks_too_large(self):
+        """Test landmarks beyond capacity are rejected."""
+        with pytest.raises(ValueError, match="do not fit"):
+            encode_record(1, 0.0, random_landmarks(poses=2))
+        with pytest.raises(ValueError, match="do not fit"):
+            encode_record(1, 0.0, np.zeros((17, 4), dtype=np.float32))
+    
+    def test_pack_in_place(self):
+        """Test pack_record writes into a preallocated array."""
+        records = create_records(3)
+        pack_record(records[1], 7, 0.5, random_landmarks(), control_state=ControlState.LEFT_CLICK)
+        
+        assert records[1]['sequence'] == 7
+        assert record_control_state(records[1]) == ControlState.LEFT_CLICK
+        assert records[0]['pose_count'] == 0
+        assert record_control_state(records[0]) is None
+    
+    def test_decode_is_zero_copy(self):
+        """Test decoded records share memory with the source buffer."""
+        buffer = bytearray(create_records(2).tobytes())
+        records = decode_records(buffer)
+        
+        records['sequence'][1] = 99
+        
+        assert np.shares_memory(records, np.frombuffer(buffer, dtype=np.uint8))
+        assert decode_records(bytes(buffer))[1]['sequence'] == 99
+    
+    def test_decode_rejects_foreign_data(self):
+        """Test wrong magic, version and length are rejected."""
+        with pytest.raises(ValueError, match="not a multiple"):
+            decode_records(b'\x00' * 10)
+        with pytest.raises(ValueError, match="does not contain landmark records"):
+            decode_records(b'\x00' * LANDMARK_RECORD_DTYPE.itemsize)
+        
+        records = create_records(1)
+        records['version'] = RECORD_VERSION + 1
+        with pytest.raises(ValueError, match="unsupported landmark record version"):
+            decode_records(records.tobytes())
+
+
+class TestRecordFiles:
+    """Test cases for writing and memory-mapping record files."""
+    
+    def test_file_round_trip(self, tmp_path):
+        """Test records appended to a file are memory-mapped back."""
+        path = str(tmp_path / 'landmarks.klmr')
+        records = create_records(5)
+        for index in range(5):
+            pack_record(records[index], index, index / 30.0, random_landmarks(seed=index), angle=float(index))
+        
+        with LandmarkRecordWriter(path) as writer:
+            writer.write(records[:2])
+            writer.write(records[2:])
+            assert writer.count == 5
+        
+        mapped = open_record_file(path)
+        
+        assert isinstance(mapped, np.memmap)
+        assert len(mapped) == 5
+        np.testing.assert_array_equal(mapped['sequence'], np.arange(5))
+        np.testing.assert_array_equal(mapped['landmarks'], records['landmarks'])
+    
+    def test_empty_file(self, tmp_path):
+        """Test an empty file maps to zero records."""
+        path = tmp_path / 'empty.klmr'
+        path.write_bytes(b'')
+        assert len(open_record_file(str(path))) == 0
+    
+    def test_truncated_file(self, tmp_path):
+        """Test a partial trailing record is rejected."""
+        path = tmp_path / 'partial.klmr'
+        path.write_bytes(create_records(1).tobytes()[:-1])
+        with pytest.raises(ValueError, match="not a multiple"):
+            open_record_file(str(path))
+    
+    def test_writer_rejects_other_dtype(self, tmp_path):
+        """Test writer refuses records of another dtype."""
+        with LandmarkRecordWriter(str(tmp_path / 'x.klmr')) as writer:
+            with pytest.raises(ValueError, match="do not match"):
+                writer.write(create_records(1, HEADER_ONLY_DTYPE))
@@ -0,0 +1,171 @@
+"""
+Unit tests for lens distortion correction.
+"""
+
+import cv2
+import numpy as np
+import pytest
+
+from src.models.data_models import ArmKeypoints, Point
+from src.utils.angle_calculator import AngleCalculator
+from src.utils.lens_correction import (
+    CameraCalibration, FrameUndistorter, KeypointUndistorter, calibrate_camera,
+    find_checkerboard_corners, load_calibration, save_calibration
+)
+
+
+IMAGE_SIZE = (640, 480)
+
+
+def wide_angle_calibration() -> CameraCalibration:
+    """Return a calibration with strong barrel distortion."""
+    camera_matrix = np.array([[400.0, 0.0, 320.0], [0.0, 400.0, 240.0], [0.0, 0.0, 1.0]])
+    dist_coeffs = np.array([[-0.3, 0.1, 0.0, 0.0, 0.0]])
+    return CameraCalibration(camera_matrix, dist_coeffs, IMAGE_SIZE)
+
+
+def distort_normalized(calibration: CameraCalibration, points: np.ndarray) -> np.ndarray:
+    """Apply the lens model to ideal normalized image points."""
+    pixels = points * np.array(calibration.image_size, dtype=np.float64)
+    camera_matrix = calibration.camera_matrix
+    rays = np.column_stack([
+        (pixels[:, 0] - camera_matrix[0, 2]) / camera_matrix[0, 0],
+        (pixels[:, 1] - camera_matrix[1, 2]) / camera_matrix[1, 1],
+        np.ones(len(points)),
+    ])
+    projected, _ = cv2.projectPoints(rays, np.zeros(3), np.zeros(3), camera_matrix, calibration.dist_coeffs)
+    return projected.reshape(-1, 2) / np.array(calibration.image_size, dtype=np.float64)
+
+
+def checkerboard_image(pattern_size=(7, 5), square=40, margin=60) -> np.ndarray:
+    """Render a checkerboard with pattern_size inner corners."""
+    columns, rows = pattern_size[0] + 1, pattern_size[1] + 1
+    image = np.full((rows * square + 2 * margin, columns * square + 2 * margin), 255, dtype=np.uint8)
+    for row in range(rows):
+        for column in range(columns):
+            if (row + column) % 2 == 0:
+                y, x = margin + row * square, margin + column * square
+                image[y:y + square, x:x + square] = 0
+    return cv2.cvtColor(image, cv2.COLOR_GRAY2BGR)
+
+
+class TestCameraCalibration:
+    """Test cases for calibration storage and estimation."""
+
+    def test_save_and_load(self, tmp_path):
+        """Test a calibration round-trips through JSON."""
+        calibration = wide_angle_calibration()
+        path = str(tmp_path / 'calibration.json')
+        save_calibration(path, calibration)
+        loaded = load_calibration(path)
+
+        np.testing.assert_allclose(loaded.camera_matrix, calibration.camera_matrix)
+        np.testing.assert_allclose(loaded.dist_coeffs, calibration.dist_coeffs)
+        assert loaded.image_size == IMAGE_SIZE
+
+    def test_load_invalid(self, tmp_path):
+        """Test malformed calibration files are rejected."""
+        path = tmp_path / 'calibration.json'
+        path.write_text('{"camera_matrix": [[1, 0], [0, 1]], "dist_coeffs": [0, 0, 0, 0], "image_size": [640, 480]}')
+        with pytest.raises(ValueError):
+            load_calibration(str(path))
+        path.write_text('{}')
+        with pytest.raises(ValueError):
+            load_calibration(str(path))
+
+    def test_scaled_to(self):
+        """Test intrinsics scale with the frame size and distortion does not."""
+        scaled = wide_angle_calibration().scaled_to((1280, 960))
+        assert scaled.camera_matrix[0, 0] == pytest.approx(800.0)
+        assert scaled.camera_matrix[1, 2] == pytest.approx(480.0)
+        np.testing.assert_array_equal(scaled.dist_coeffs, wide_angle_calibration().dist_coeffs)
+
+    def test_find_checkerboard_corners(self):
+        """Test corners are found on a rendered board and not on a blank image."""
+        corners = find_checkerboard_corners(checkerboard_image(), (7, 5))
+        assert corners is not None and corners.shape == (35, 1, 2)
+        assert find_checkerboard_corners(np.full((200, 200, 3), 255, np.uint8), (7, 5)) is None
+
+    def test_calibrate_recovers_intrinsics(self):
+        """Test calibration from projected board views recovers the camera."""
+        truth = wide_angle_calibration()
+        pattern = (9, 6)
+        board = np.zeros((54, 3), dtype=np.float32)
+        board[:, :2] = np.mgrid[0:9, 0:6].T.reshape(-1, 2) - np.array([4, 2.5])
+        corner_sets = []
+        for rx, ry, tx, ty in [(0.3, 0, -2, -1), (-0.3, 0.2, 2, 1), (0, 0.4, 0, 0), (0.2, -0.3, -3, 2),
+                               (-0.2, -0.2, 3, -2), (0.4, 0.1, 1, 2), (0.1, 0.4, -1, -2)]:
+            projected, _ = cv2.projectPoints(board, np.array([rx, ry, 0.0]), np.array([tx, ty, 14.0]),
+                                             truth.camera_matrix, truth.dist_coeffs)
+            corner_sets.append(projected.astype(np.float32))
+
+        calibration = calibrate_camera(corner_sets, pattern, IMAGE_SIZE)
+
+        assert calibration.rms_error < 0.01
+        assert calibration.camera_matrix[0, 0] == pytest.approx(400.0, rel=0.01)
+        assert calibration.dist_coeffs[0, 0] == pytest.approx(-0.3, abs=0.02)
+
+    def test_calibrate_needs_views(self):
+        """Test calibration rejects too few views."""
+        with pytest.raises(ValueError):
+            calibrate_camera([np.zeros((54, 1, 2), np.float32)], (9, 6), IMAGE_SIZE)
+
+
+class TestUndistorters:
+    """Test cases for FrameUndistorter and KeypointUndistorter."""
+
+    def setup_method(self):
+        """Set up a wide-angle calibration."""
+        self.calibration = wide_angle_calibration()
+
+    def test_keypoints_restore_straight_arm(self):
+        """Test a straight arm bent by the lens at the frame edge measures straight again."""
+        ideal = np.array([[0.70, 0.15], [0.80, 0.45], [0.90, 0.75]])
+        distorted = distort_normalized(self.calibration, ideal)
+        arm = ArmKeypoints(*(Point(float(x), float(y), 0.1) for x, y in distorted), confidence=0.9)
+
+        raw_angle = AngleCalculator.calculate_elbow_angle(arm.shoulder, arm.elbow, arm.wrist)
+        corrected = KeypointUndistorter(self.calibration, IMAGE_SIZE).undistort_arm(arm)
+        corrected_angle = AngleCalculator.calculate_elbow_angle(corrected.shoulder, corrected.elbow, corrected.wrist)
+
+        assert raw_angle < 178.0
+        assert corrected_angle == pytest.approx(180.0, abs=0.1)
+        assert corrected.elbow.z == 0.1 and corrected.confidence == 0.9
+
+    def test_undistort_points_matches_arm(self):
+        """Test the array interface agrees with the keypoint interface."""
+        undistorter = KeypointUndistorter(self.calibration, IMAGE_SIZE)
+        points = np.array([[0.5, 0.5], [0.05, 0.9]])
+        corrected = undistorter.undistort_points(points)
+        np.testing.assert_allclose(corrected[0], [0.5, 0.5], atol=1e-9)
+        np.testing.assert_allclose(distort_normalized(self.calibration, corrected), points, atol=1e-4)
+
+    def test_frame_undistorter_reuses_buffer(self):
+        """Test frames are remapped into one preallocated buffer."""
+        undistorter = FrameUndistorter(self.calibration, IMAGE_SIZE)
+        frame = np.random.default_rng(0).integers(0, 256, (480, 640, 3), dtype=np.uint8)
+
+        first = undistorter.undistort(frame)
+        second = undistorter.undistort(frame)
+
+        assert first is second
+        assert first.shape == frame.shape
+        # The principal point does not move
+        np.testing.assert_allclose(first[240, 320], frame[240, 320], atol=2)
+        with pytest.raises(ValueError):
+            undistorter.undistort(np.zeros((240, 320, 3), dtype=np.uint8))
+
+    def test_frame_and_keypoint_modes_agree(self):
+        """Test a dot moved by the frame remap lands where undistortPoints puts it."""
+        point = np.array([[0.85, 0.2]])
+        distorted = distort_normalized(self.calibration, point)[0] * np.array(IMAGE_SIZE)
+        frame = np.zeros((480, 640, 3), dtype=np.uint8)
+        cv2.circle(frame, (int(round(distorted[0])), int(round(distorted[1]))), 2, (255, 255, 255), -1)
+
+        rectified = FrameUndistorter(self.calibration, IMAGE_SIZE).undistort(frame)
+        ys, xs = np.nonzero(rectified[:, :, 0] > 64)
+        expected = KeypointUndistorter(self.calibration, IMAGE_SIZE).undistort_points(
+            distorted / np.array(IMAGE_SIZE))[0] * np.array(IMAGE_SIZE)
+
+        assert abs(xs.mean() - expected[0]) < 1.5
+        assert abs(ys.mean() - expected[1]) < 1.5
@@ -0,0 +1,168 @@
+"""
+Unit tests for parallel offline video labeling.
+"""
+
+import math
+
+import cv2
+import numpy as np
+import pytest
+
+from src.controllers import offline_labeler
+from src.controllers.offline_labeler import OfflineLabeler, plan_chunks
+from src.controllers.pose_detector import LandmarkPoint, PoseDetector, PoseLandmarks
+from src.models.landmark_record import open_record_file, record_angle, record_control_state
+
+
+class BrightnessDetector(PoseDetector):
+    """Detector whose left elbow angle follows the frame brightness; dark frames have no pose."""
+    
+    def __init__(self):
+        self.confidence_threshold = 0.5
+        self._last_detection_successful = False
+    
+    def detect_pose(self, frame):
+        level = float(frame.mean())
+        if level < 20:
+            return None
+        angle = math.radians(level / 255.0 * 180.0)
+        landmarks = [LandmarkPoint(0.5, 0.5, 0.0, 0.9)] * 33
+        landmarks[11] = LandmarkPoint(0.2, 0.5, 0.0, 0.9)
+        landmarks[13] = LandmarkPoint(0.4, 0.5, 0.0, 0.9)
+        landmarks[15] = LandmarkPoint(0.4 - 0.2 * math.cos(angle), 0.5 + 0.2 * math.sin(angle), 0.0, 0.9)
+        return PoseLandmarks(landmarks=landmarks)
+    
+    def __del__(self):
+        pass
+
+
+def write_clip(path, levels, fourcc='MJPG'):
+    """Write a clip with one uniformly grey frame per brightness level."""
+    writer = cv2.VideoWriter(path, cv2.VideoWriter_fourcc(*fourcc), 30, (64, 48))
+    if not writer.isOpened():
+        pytest.skip(f"{fourcc} encoder unavailable")
+    for level in levels:
+        writer.write(np.full((48, 64, 3), level, dtype=np.uint8))
+    writer.release()
+
+
+class TestPlanChunks:
+    """Test cases for chunk planning."""
+    
+    def test_chunks_cover_every_frame_once(self):
+        """Test chunks are contiguous, balanced and warm up before their start."""
+        chunks = plan_chunks(100, 3, warmup_frames=10)
+        
+        assert [(c.start, c.end) for c in chunks] == [(0, 33), (33, 66), (66, 100)]
+        assert [c.warmup_start for c in chunks] == [0, 23, 56]
+        assert len(plan_chunks(2, 8, 0)) == 2
+    
+    def test_invalid_arguments(self):
+        """Test chunk count and warm-up are validated."""
+        with pytest.raises(ValueError):
+            plan_chunks(100, 0, 10)
+        with pytest.raises(ValueError):
+            plan_chunks(100, 2, -1)
+
+
+class TestOfflineLabeler:
+    """Test cases for OfflineLabeler."""
+    
+    def test_parallel_output_matches_single_worker(self, tmp_path):
+        """Test chunked parallel labeling writes the same records in frame order."""
+        levels = [0] * 5 + list(range(40, 250, 3)) + [0] * 5
+        video = str(tmp_path / 'clip.avi')
+        write_clip(video, levels)
+        
+        single = OfflineLabeler(video, str(tmp_path / 'single.klmr'), workers=1,
+                                warmup_frames=0, detector_factory=BrightnessDetector).run()
+        parallel = OfflineLabeler(video, str(tmp_path / 'parallel.klmr'), workers=2, chunks=3,
+                                  warmup_frames=4, detector_factory=BrightnessDetector).run()
+        
+        assert single['frames'] == parallel['frames'] == len(levels)
+        assert parallel['chunks'] == 3 and parallel['workers'] == 2
+        assert parallel['fps'] > 0
+        assert sum(result['warmup_frames'] for result in parallel['chunk_results']) == 8
+        
+        records = open_record_file(str(tmp_path / 'parallel.klmr'))
+        expected = open_record_file(str(tmp_path / 'single.klmr'))
+        assert records['sequence'].tolist() == list(range(len(levels)))
+        assert records['timestamp'][30] == pytest.approx(1.0)
+        assert np.array_equal(records['pose_count'], expected['pose_count'])
+        assert np.allclose(records['angle'], expected['angle'], equal_nan=True)
+        assert np.array_equal(records['control_state'], expected['control_state'])
+        assert not list(tmp_path.glob('*.part*'))
+        
+        assert record_angle(records[0]) is None
+        assert str(record_control_state(records[0])) == str(record_control_state(records[-1]))
+        states = {record_control_state(record) for record in records}
+        assert len(states) == 3
+    
+    def test_inter_coded_clip_matches_single_worker(self, tmp_path):
+        """Test chunks of a clip with predicted frames start on the right frame."""
+        levels = [40 + (index * 37) % 200 for index in range(90)]
+        video = str(tmp_path / 'clip.avi')
+        write_clip(video, levels, fourcc='XVID')
+        
+        OfflineLabeler(video, str(tmp_path / 'single.klmr'), workers=1,
+                       warmup_frames=0, detector_factory=BrightnessDetector).run()
+        OfflineLabeler(video, str(tmp_path / 'chunked.klmr'), workers=1, chunks=4,
+                       warmup_frames=3, detector_factory=BrightnessDetector).run()
+        
+        records = open_record_file(str(tmp_path / 'chunked.klmr'))
+        expected = open_record_file(str(tmp_path / 'single.klmr'))
+        assert records['sequence'].tolist() == list(range(len(levels)))
+        assert np.allclose(records['angle'], expected['angle'], equal_nan=True)
+        assert np.array_equal(records['control_state'], expected['control_state'])
+    
+    def test_keyframe_seek_is_numbered_from_actual_position(self, tmp_path, monkeypatch):
+        """Test a seek that lands early labels the right frames and skips the extra ones undetected."""
+        video_capture = cv2.VideoCapture
+        
+        class KeyframeCapture:
+            """Capture whose seeks land on every tenth frame, or fail past frame 50."""
+            
+            def __init__(self, path):
+                self._capture = video_capture(path)
+            
+            def set(self, prop, value):
+                if prop == cv2.CAP_PROP_POS_FRAMES and value > 50:
+                    self._capture.set(prop, value + 3)
+                    return True
+                if prop == cv2.CAP_PROP_POS_FRAMES:
+                    value -= value % 10
+                return self._capture.set(prop, value)
+            
+            def __getattr__(self, name):
+                return getattr(self._capture, name)
+        
+        levels = [40 + (index * 37) % 200 for index in range(90)]
+        video = str(tmp_path / 'clip.avi')
+        write_clip(video, levels)
+        monkeypatch.setattr(offline_labeler.cv2, 'VideoCapture', KeyframeCapture)
+        detected = [0]
+        
+        class CountingDetector(BrightnessDetector):
+            def detect_pose(self, frame):
+                detected[0] += 1
+                return super().detect_pose(frame)
+        
+        single = OfflineLabeler(video, str(tmp_path / 'single.klmr'), workers=1,
+                                warmup_frames=0, detector_factory=BrightnessDetector).run()
+        chunked = OfflineLabeler(video, str(tmp_path / 'chunked.klmr'), workers=1, chunks=3,
+                                 warmup_frames=4, detector_factory=CountingDetector).run()
+        
+        assert single['frames'] == chunked['frames'] == len(levels)
+        # Chunks warm up from 26 and 56; seeks land on keyframe 20, and on 0 after the overshoot
+        assert [result['warmup_frames'] for result in chunked['chunk_results']] == [0, 4, 4]
+        assert [result['skipped_frames'] for result in chunked['chunk_results']] == [0, 6, 56]
+        assert detected == [len(levels) + 8]
+        records = open_record_file(str(tmp_path / 'chunked.klmr'))
+        expected = open_record_file(str(tmp_path / 'single.klmr'))
+        assert records['sequence'].tolist() == list(range(len(levels)))
+        assert np.allclose(records['angle'], expected['angle'], equal_nan=True)
+    
+    def test_unreadable_video(self, tmp_path):
+        """Test a missing video fails cleanly."""
+        labeler = OfflineLabeler(str(tmp_path / 'missing.avi'), str(tmp_path / 'out.klmr'), workers=1)
+        assert labeler.run() is None
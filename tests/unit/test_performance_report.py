@@ -0,0 +1,155 @@
+"""
+Unit tests for performance measurement helpers.
+
+Tests hardware classification, latency percentiles, resource sampling and
+benchmark summary persistence.
+"""
+
+import time
+
+import pytest
+
+from src.utils import performance_report
+from src.utils.performance_report import (
+    USAGE_COUNTERS, ResourceSampler, StageProfiler, current_rss_mb, hardware_class,
+    latency_percentiles, load_summary, process_memory_mb, resource_usage, write_summary
+)
+
+
+class TestPerformanceReport:
+    """Test cases for performance report helpers."""
+    
+    def test_hardware_class_format(self):
+        """Test hardware class combines architecture and core count."""
+        label = hardware_class()
+        machine, _, cores = label.rpartition('-')
+        assert machine
+        assert cores.endswith('c') and cores[:-1].isdigit()
+    
+    def test_current_rss_positive(self):
+        """Test RSS is reported in megabytes."""
+        assert current_rss_mb() > 1.0
+    
+    def test_latency_percentiles(self):
+        """Test percentile summary of latencies."""
+        stats = latency_percentiles(list(range(1, 101)))
+        assert stats['mean'] == pytest.approx(50.5)
+        assert stats['p50'] == pytest.approx(50.5)
+        assert stats['p99'] == pytest.approx(99.01)
+    
+    def test_latency_percentiles_empty(self):
+        """Test empty input yields zeros."""
+        assert latency_percentiles([]) == {'mean': 0.0, 'p50': 0.0, 'p99': 0.0}
+    
+    def test_resource_sampler(self):
+        """Test sampler reports CPU and RSS for busy work."""
+        sampler = ResourceSampler()
+        sampler.start()
+        sum(i * i for i in range(200000))
+        result = sampler.stop()
+        
+        assert result['wall_s'] > 0
+        assert result['cpu_s'] > 0
+        assert result['cpu_percent'] > 0
+        assert result['rss_mb'] > 0
+        for counter in USAGE_COUNTERS:
+            assert result[counter] >= 0
+    
+    def test_resource_usage(self):
+        """Test getrusage counters are reported and cumulative."""
+        first = resource_usage()
+        second = resource_usage()
+        assert first['user_cpu_s'] + first['system_cpu_s'] > 0
+        assert first['peak_rss_mb'] > 0
+        for counter in USAGE_COUNTERS:
+            assert second[counter] >= first[counter]
+    
+    def test_process_memory(self):
+        """Test the shared and private memory breakdown where /proc is available."""
+        memory = process_memory_mb()
+        if not memory:
+            pytest.skip("smaps_rollup unavailable")
+        assert memory['rss_mb'] > 1.0
+        assert memory['private_mb'] + memory['shared_mb'] == pytest.approx(memory['rss_mb'], rel=0.05)
+        assert process_memory_mb(pid=2 ** 22 + 1) == {}
+    
+    def test_without_getrusage(self, monkeypatch):
+        """Test sampling degrades to empty figures where the resource module is missing."""
+        def no_proc(*args, **kwargs):
+            raise OSError("no /proc")
+        
+        monkeypatch.setattr(performance_report, 'resource', None)
+        monkeypatch.setattr(performance_report, 'open', no_proc, raising=False)
+        assert current_rss_mb() == 0.0
+        assert resource_usage() == {}
+        sampler = ResourceSampler()
+        sampler.start()
+        result = sampler.stop()
+        assert result['cpu_s'] >= 0
+        assert not set(USAGE_COUNTERS) & set(result)
+    
+    def test_summary_round_trip_and_merge(self, tmp_path):
+        """Test summaries are written, merged per hardware class and read back."""
+        path = str(tmp_path / 'report' / 'summary.json')
+        write_summary(path, {'a-4c': {'fps_by_model_complexity': {'0': 50.0}}})
+        write_summary(path, {'b-8c': {'fps_by_model_complexity': {'0': 90.0}}})
+        
+        summary = load_summary(path)
+        
+        assert set(summary) == {'a-4c', 'b-8c'}
+        assert summary['b-8c']['fps_by_model_complexity']['0'] == 90.0
+    
+    def test_load_summary_missing_or_invalid(self, tmp_path):
+        """Test unreadable summaries return None."""
+        assert load_summary(str(tmp_path / 'missing.json')) is None
+        invalid = tmp_path / 'invalid.json'
+        invalid.write_text('[1, 2')
+        assert load_summary(str(invalid)) is None
+
+
+class TestStageProfiler:
+    """Test cases for StageProfiler."""
+    
+    def setup_method(self):
+        """Set up a profiler with two declared stages."""
+        self.profiler = StageProfiler(('inference', 'display'))
+    
+    def test_declared_stages_reported_before_use(self):
+        """Test declared stages appear with zero counts."""
+        stats = self.profiler.get_stats()
+        assert set(stats['stages']) == {'inference', 'display'}
+        assert stats['stages']['display']['count'] == 0
+        assert stats['stages']['display']['cpu_share'] == 0.0
+    
+    def test_busy_stage_uses_cpu(self):
+        """Test a compute-bound stage has thread CPU close to its wall time."""
+        token = self.profiler.begin()
+        sum(i * i for i in range(300000))
+        wall_ms = self.profiler.end('inference', token)
+        
+        stats = self.profiler.get_stats()['stages']['inference']
+        assert wall_ms > 0
+        assert stats['count'] == 1
+        assert stats['wall_ms_mean'] == pytest.approx(wall_ms)
+        assert stats['cpu_ms_mean'] > 0.5 * wall_ms
+    
+    def test_waiting_stage_uses_little_cpu(self):
+        """Test a sleeping stage has wall time but almost no thread CPU."""
+        token = self.profiler.begin()
+        time.sleep(0.05)
+        self.profiler.end('display', token)
+        
+        stats = self.profiler.get_stats()['stages']['display']
+        assert stats['wall_ms_mean'] >= 45.0
+        assert stats['cpu_share'] < 0.2
+    
+    def test_undeclared_stage_and_reset(self):
+        """Test new stages are added on first use and reset clears totals."""
+        self.profiler.end('capture', self.profiler.begin())
+        assert self.profiler.get_stats()['stages']['capture']['count'] == 1
+        
+        self.profiler.reset()
+        stats = self.profiler.get_stats()
+        assert stats['stages']['capture']['count'] == 0
+        assert stats['stage_cpu_ms'] == 0.0
+        assert stats['other_threads_cpu_ms'] >= 0.0
\ No newline at end of file
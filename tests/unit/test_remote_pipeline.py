@@ -0,0 +1,318 @@
+"""
+Unit tests for the remote inference pipeline.
+
+Runs a RemoteInferenceServer and RemoteCaptureClient over loopback with a
+fake pose detector so no camera or MediaPipe model is needed.
+"""
+
+import time
+
+import pytest
+import numpy as np
+from unittest.mock import Mock, patch
+
+from src.controllers.application_controller import ApplicationController
+from src.controllers.pose_detector import PoseLandmarks
+from src.controllers.remote_pipeline import (
+    RemoteCaptureClient, RemoteInferenceServer, RemotePoseDetector, parse_address
+)
+from src.models.data_models import ArmKeypoints
+from src.models.enums import ControlState
+from src.utils.clock import VirtualClock
+
+
+class MockLandmark:
+    """Mock MediaPipe landmark for testing."""
+    def __init__(self, x: float, y: float, z: float, visibility: float):
+        self.x = x
+        self.y = y
+        self.z = z
+        self.visibility = visibility
+
+
+def make_landmarks():
+    """Create 33 landmarks with a straight left arm (180 degree elbow)."""
+    landmarks = [MockLandmark(0.5, 0.5, 0.0, 0.9) for _ in range(33)]
+    landmarks[11] = MockLandmark(0.2, 0.5, 0.0, 0.9)  # LEFT_SHOULDER
+    landmarks[13] = MockLandmark(0.4, 0.5, 0.0, 0.9)  # LEFT_ELBOW
+    landmarks[15] = MockLandmark(0.6, 0.5, 0.0, 0.9)  # LEFT_WRIST
+    return landmarks
+
+
+class FakeDetector:
+    """Pose detector stand-in returning fixed landmarks."""
+    def __init__(self, landmarks=None):
+        self.landmarks = landmarks
+        self.frames = []
+    
+    def detect_pose(self, frame):
+        self.frames.append(frame.shape)
+        if self.landmarks is None:
+            return None
+        return PoseLandmarks(landmarks=self.landmarks)
+    
+    def get_arm_keypoints(self, landmarks):
+        from src.controllers.pose_detector import PoseDetector
+        extractor = PoseDetector.__new__(PoseDetector)
+        extractor.confidence_threshold = 0.5
+        return extractor.get_arm_keypoints(landmarks)
+
+
+class TestParseAddress:
+    """Test cases for HOST:PORT parsing."""
+    
+    def test_parse_valid(self):
+        """Test parsing a valid address."""
+        assert parse_address('127.0.0.1:5555') == ('127.0.0.1', 5555)
+    
+    @pytest.mark.parametrize('address', ['localhost', ':5555', 'host:port', ''])
+    def test_parse_invalid(self, address):
+        """Test parsing malformed addresses."""
+        with pytest.raises(ValueError, match="HOST:PORT"):
+            parse_address(address)
+
+
+class TestRemotePipeline:
+    """Loopback tests for the remote client and server."""
+    
+    def setup_method(self):
+        """Set up test fixtures."""
+        self.frame = np.full((120, 160, 3), 128, dtype=np.uint8)
+        self.server = None
+        self.client = None
+    
+    def teardown_method(self):
+        """Tear down client and server."""
+        if self.client:
+            self.client.close()
+        if self.server:
+            self.server.stop()
+    
+    def _start(self, landmarks=None, reply_mode='landmarks', max_in_flight=3):
+        detector = FakeDetector(landmarks)
+        self.server = RemoteInferenceServer(
+            host='127.0.0.1', port=0, detector_factory=lambda: detector, reply_mode=reply_mode
+        )
+        self.server.start()
+        host, port = self.server.address
+        self.client = RemoteCaptureClient(host, port, max_in_flight=max_in_flight)
+        assert self.client.connect(timeout=2.0)
+        return detector
+    
+    def test_server_invalid_reply_mode(self):
+        """Test server rejects unknown reply modes."""
+        with pytest.raises(ValueError, match="reply_mode"):
+            RemoteInferenceServer(reply_mode='frames', detector_factory=Mock)
+    
+    def test_client_invalid_parameters(self):
+        """Test client parameter validation."""
+        with pytest.raises(ValueError, match="jpeg_quality"):
+            RemoteCaptureClient('127.0.0.1', 1, jpeg_quality=0)
+        with pytest.raises(ValueError, match="max_in_flight"):
+            RemoteCaptureClient('127.0.0.1', 1, max_in_flight=0)
+    
+    def test_connect_failure(self):
+        """Test connecting to a closed port fails cleanly."""
+        client = RemoteCaptureClient('127.0.0.1', 1)
+        assert client.connect(timeout=0.5) is False
+        assert not client.is_connected()
+    
+    def test_submit_copies_and_keeps_newest_frame(self):
+        """Test submitted frames are copied and only the newest one waits for encoding."""
+        client = RemoteCaptureClient('127.0.0.1', 1)
+        frame = np.zeros((8, 8, 3), dtype=np.uint8)
+        for value in range(4):
+            frame[:] = value
+            client.submit(frame)
+        frame[:] = 99
+        
+        pending = client._pending_frames.get()
+        assert pending.max() == 3 and client._pending_frames.meta['sequence'] == 3
+        assert client.get_latency_stats()['frames_dropped'] == 3
+    
+    def test_landmark_round_trip(self):
+        """Test landmarks and control state come back over loopback."""
+        detector = self._start(make_landmarks())
+        
+        sequence = self.client.submit(self.frame)
+        result = self.client.wait_for_result(sequence, timeout=5.0)
+        
+        assert result is not None
+        assert result.sequence == sequence
+        assert result.landmarks.shape == (33, 4)
+        assert result.landmarks[13, 0] == pytest.approx(0.4)
+        assert result.control_state == ControlState.LEFT_CLICK
+        assert result.angle == pytest.approx(180.0, abs=0.01)
+        assert detector.frames == [self.frame.shape]
+    
+    def test_state_only_reply(self):
+        """Test state reply mode omits landmarks."""
+        self._start(make_landmarks(), reply_mode='state')
+        
+        result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+        
+        assert result.landmarks is None
+        assert result.control_state == ControlState.LEFT_CLICK
+    
+    def test_compact_reply(self):
+        """Test compact reply mode delivers delta-coded landmarks across frames."""
+        self._start(make_landmarks(), reply_mode='compact')
+        
+        for _ in range(3):
+            result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+            assert result.landmarks.shape == (33, 4)
+            assert result.landmarks[13, 0] == pytest.approx(0.4, abs=1e-4)
+            assert result.control_state == ControlState.LEFT_CLICK
+    
+    def test_no_pose_detected(self):
+        """Test results without a detected pose."""
+        self._start(None)
+        
+        result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+        
+        assert result.landmarks is None
+        assert result.control_state is None
+        assert result.angle is None
+    
+    def test_undecodable_frame_gets_empty_reply(self):
+        """Test a corrupt JPEG is answered with no pose so in-flight slots are freed."""
+        detector = self._start(make_landmarks(), max_in_flight=1)
+        garbage = np.frombuffer(b'not a jpeg', dtype=np.uint8)
+        
+        with patch('src.controllers.remote_pipeline.cv2.imencode', return_value=(True, garbage)):
+            for _ in range(3):
+                result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+                assert result is not None
+                assert result.landmarks is None and result.control_state is None
+        
+        assert detector.frames == []
+        result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+        assert result.control_state == ControlState.LEFT_CLICK
+    
+    def test_pipelined_frames_and_latency_breakdown(self):
+        """Test several frames in flight and the latency breakdown."""
+        self._start(make_landmarks(), max_in_flight=4)
+        
+        last = None
+        for _ in range(20):
+            last = self.client.submit(self.frame)
+        result = self.client.wait_for_result(last, timeout=5.0)
+        
+        assert result is not None
+        stats = self.client.get_latency_stats()
+        assert stats['results_received'] >= 1
+        assert stats['frames_sent'] + stats['frames_dropped'] == 20
+        for stage in ('client_queue_ms', 'encode_ms', 'network_ms', 'decode_ms', 'inference_ms', 'total_ms'):
+            assert stats[stage]['p50'] >= 0.0
+            assert stats[stage]['p99'] >= stats[stage]['p50']
+        assert stats['total_ms']['p50'] > 0.0
+    
+    def test_in_flight_wait_is_not_network_time(self):
+        """Test waiting for an in-flight slot is reported as client queueing, not network."""
+        detector = self._start(make_landmarks(), max_in_flight=1)
+        detect_pose = detector.detect_pose
+        
+        def slow_detect_pose(frame):
+            time.sleep(0.15)
+            return detect_pose(frame)
+        
+        detector.detect_pose = slow_detect_pose
+        self.client.submit(self.frame)
+        time.sleep(0.03)
+        result = self.client.wait_for_result(self.client.submit(self.frame), timeout=5.0)
+        
+        assert result is not None
+        latency = result.latency
+        assert latency['client_queue_ms'] > 50.0
+        assert latency['network_ms'] < latency['client_queue_ms']
+        accounted = (latency['client_queue_ms'] + latency['encode_ms'] + latency['network_ms']
+                     + latency['server_queue_ms'] + latency['decode_ms'] + latency['inference_ms'])
+        assert accounted == pytest.approx(latency['total_ms'], abs=1.0)
+
+
+class TestRemoteController:
+    """Loopback tests driving ApplicationController through a remote server."""
+    
+    @pytest.mark.parametrize('reply_mode', ['landmarks', 'compact', 'state'])
+    @patch('src.controllers.application_controller.DisplayManager')
+    @patch('src.controllers.application_controller.MouseController')
+    @patch('src.controllers.application_controller.CameraManager')
+    def test_controller_clicks_in_every_reply_mode(self, mock_camera, mock_mouse, mock_display, reply_mode):
+        """Test the controller reaches the server's control state whatever the reply mode."""
+        server = RemoteInferenceServer(
+            host='127.0.0.1', port=0, detector_factory=lambda: FakeDetector(make_landmarks()), reply_mode=reply_mode
+        )
+        server.start()
+        host, port = server.address
+        mock_camera.return_value.start_capture.return_value = True
+        mock_camera.return_value.get_frame.return_value = np.full((120, 160, 3), 128, dtype=np.uint8)
+        display = mock_display.return_value
+        display.show_pose_overlay = False
+        display.show_angle_info = False
+        display.draw_control_state_indicator.side_effect = lambda frame, state: frame
+        mouse = mock_mouse.return_value
+        controller = ApplicationController(remote_address=f'{host}:{port}')
+        
+        try:
+            assert controller.initialize()
+            deadline = time.perf_counter() + 5.0
+            while controller.system_state.current_control_state != ControlState.LEFT_CLICK:
+                assert time.perf_counter() < deadline, "no LEFT_CLICK decision arrived"
+                assert controller._process_frame()
+                time.sleep(0.01)
+            mouse.set_state.assert_any_call(ControlState.LEFT_CLICK)
+            assert controller.last_valid_angle == pytest.approx(180.0, abs=0.01)
+        finally:
+            controller.cleanup()
+            server.stop()
+
+
+class TestRemotePoseDetector:
+    """Test cases for the RemotePoseDetector adapter."""
+    
+    def test_detect_pose_returns_latest_landmarks(self):
+        """Test adapter converts remote landmarks for keypoint extraction."""
+        from src.controllers.remote_pipeline import RemoteResult
+        
+        rows = np.array([(lm.x, lm.y, lm.z, lm.visibility) for lm in make_landmarks()], dtype=np.float32)
+        client = Mock()
+        client.get_latest_result.return_value = RemoteResult(
+            sequence=0, landmarks=rows, control_state=None, angle=None, latency={}
+        )
+        detector = RemotePoseDetector(client, confidence_threshold=0.5)
+        frame = np.zeros((10, 10, 3), dtype=np.uint8)
+        
+        landmarks = detector.detect_pose(frame)
+        
+        client.submit.assert_called_once_with(frame)
+        assert detector.is_pose_detected() is True
+        keypoints = detector.get_arm_keypoints(landmarks)
+        assert isinstance(keypoints, ArmKeypoints)
+        assert keypoints.elbow.x == pytest.approx(0.4)
+    
+    def test_detect_pose_no_result(self):
+        """Test adapter returns None before any result arrives."""
+        client = Mock()
+        client.get_latest_result.return_value = None
+        detector = RemotePoseDetector(client)
+        
+        assert detector.detect_pose(np.zeros((10, 10, 3), dtype=np.uint8)) is None
+        assert detector.is_pose_detected() is False
+    
+    def test_detect_pose_stale_result(self):
+        """Test adapter drops results older than max_result_age."""
+        from src.controllers.remote_pipeline import RemoteResult
+        
+        rows = np.zeros((33, 4), dtype=np.float32)
+        client = Mock()
+        client.get_latest_result.return_value = RemoteResult(0, rows, None, None, {})
+        clock = VirtualClock()
+        detector = RemotePoseDetector(client, max_result_age=0.5, clock=clock)
+        frame = np.zeros((10, 10, 3), dtype=np.uint8)
+        
+        assert detector.detect_pose(frame) is not None
+        clock.advance(0.4)
+        assert detector.detect_pose(frame) is not None
+        clock.advance(0.2)
+        
+        assert detector.detect_pose(frame) is None
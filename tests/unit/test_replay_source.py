@@ -0,0 +1,117 @@
+"""Unit tests for ReplaySource class."""
+
+import pytest
+import numpy as np
+import cv2
+
+from src.controllers.replay_source import ReplaySource
+from src.utils.clock import VirtualClock
+
+
+def write_clip(path, frame_count=5, size=(64, 48)):
+    """Write a short MJPG clip whose frames have increasing brightness."""
+    writer = cv2.VideoWriter(str(path), cv2.VideoWriter_fourcc(*'MJPG'), 30, size)
+    for index in range(frame_count):
+        writer.write(np.full((size[1], size[0], 3), index * 40, dtype=np.uint8))
+    writer.release()
+    return str(path)
+
+
+class TestReplaySource:
+    """Test cases for ReplaySource functionality."""
+    
+    def test_invalid_capture_mode(self):
+        """Test unknown capture modes are rejected."""
+        with pytest.raises(ValueError, match="capture_mode must be one of"):
+            ReplaySource('clip.avi', capture_mode='mmap')
+    
+    def test_invalid_max_frames(self):
+        """Test max_frames must be positive."""
+        with pytest.raises(ValueError, match="max_frames must be positive"):
+            ReplaySource('clip.avi', max_frames=0)
+    
+    def test_missing_file(self, tmp_path):
+        """Test opening a missing file fails cleanly."""
+        source = ReplaySource(str(tmp_path / 'missing.avi'))
+        assert source.start_capture() is False
+        assert source.is_available() is False
+        assert source.get_frame() is None
+    
+    @pytest.mark.parametrize('capture_mode', ReplaySource.CAPTURE_MODES)
+    def test_reads_all_frames(self, tmp_path, capture_mode):
+        """Test every frame is returned once, then None."""
+        source = ReplaySource(write_clip(tmp_path / 'clip.avi'), capture_mode=capture_mode)
+        assert source.start_capture() is True
+        
+        frames = []
+        while True:
+            frame = source.get_frame()
+            if frame is None:
+                break
+            frames.append(frame)
+        
+        assert len(frames) == 5
+        assert frames[0].shape == (48, 64, 3)
+        assert frames[4].mean() > frames[0].mean()
+        source.release()
+        assert source.is_available() is False
+    
+    @pytest.mark.parametrize('capture_mode', ReplaySource.CAPTURE_MODES)
+    def test_max_frames_and_loop(self, tmp_path, capture_mode):
+        """Test max_frames limits playback and loop restarts the clip."""
+        path = write_clip(tmp_path / 'clip.avi')
+        
+        limited = ReplaySource(path, capture_mode=capture_mode, max_frames=3)
+        assert limited.start_capture()
+        count = 0
+        while limited.get_frame() is not None:
+            count += 1
+        assert count == 3
+        
+        looping = ReplaySource(path, capture_mode=capture_mode, loop=True)
+        assert looping.start_capture()
+        frames = [looping.get_frame() for _ in range(12)]
+        assert all(frame is not None for frame in frames)
+        assert np.array_equal(frames[0], frames[5])
+    
+    def test_frame_timestamps_increase(self, tmp_path):
+        """Test media timestamps advance with each frame."""
+        source = ReplaySource(write_clip(tmp_path / 'clip.avi'), capture_mode='preload')
+        assert source.start_capture()
+        
+        timestamps = []
+        while source.get_frame() is not None:
+            timestamps.append(source.get_frame_timestamp())
+        
+        assert timestamps == sorted(timestamps)
+        assert timestamps[-1] > timestamps[0]
+    
+    @pytest.mark.parametrize('capture_mode', ReplaySource.CAPTURE_MODES)
+    def test_advances_virtual_clock(self, tmp_path, capture_mode):
+        """Test a virtual clock follows media time, continuing across loops."""
+        clock = VirtualClock(start=100.0)
+        source = ReplaySource(write_clip(tmp_path / 'clip.avi'), capture_mode=capture_mode,
+                              loop=True, clock=clock)
+        assert source.start_capture()
+        
+        times = []
+        for _ in range(10):
+            source.get_frame()
+            times.append(clock.now())
+        
+        assert times[0] == pytest.approx(100.0)
+        assert times[4] == pytest.approx(100.0 + 4 / 30)
+        assert times[5] == pytest.approx(100.0 + 5 / 30)
+        assert times[9] == pytest.approx(100.0 + 9 / 30)
+    
+    def test_get_camera_info(self, tmp_path):
+        """Test replay info mirrors CameraManager.get_camera_info()."""
+        source = ReplaySource(write_clip(tmp_path / 'clip.avi'), capture_mode='preload')
+        assert source.get_camera_info() == {}
+        assert source.start_capture()
+        
+        info = source.get_camera_info()
+        
+        assert info['width'] == 64
+        assert info['height'] == 48
+        assert info['is_available'] is True
@@ -0,0 +1,257 @@
+"""
+Unit tests for the warm session daemon.
+
+Runs a SessionDaemon on a temporary Unix socket with a fake detector and fake
+sessions, so no camera, window or MediaPipe model is needed.
+"""
+
+import os
+import socket
+import tempfile
+import threading
+import time
+
+import pytest
+
+from controller_client import send_command
+from src.controllers.session_daemon import SessionDaemon
+from src.utils.config_manager import ControllerConfig
+
+
+class FakeDetector:
+    """Pose detector stand-in counting inferences."""
+    def __init__(self):
+        self.calls = 0
+    
+    def detect_pose(self, frame):
+        self.calls += 1
+        return None
+
+
+class FakeSession:
+    """ApplicationController stand-in that processes frames until stopped."""
+    instances = []
+    
+    def __init__(self, pose_detector=None, config=None, camera_id=0, fail=False, init_delay=0.0):
+        self.pose_detector = pose_detector
+        self.config = config
+        self.camera_id = camera_id
+        self.fail = fail
+        self.init_delay = init_delay
+        self.actions = []
+        self.applied_configs = []
+        self.first_frame_event = threading.Event()
+        self.first_frame_time = None
+        self.cleaned_up = False
+        self._stop = threading.Event()
+        FakeSession.instances.append(self)
+    
+    def initialize(self):
+        time.sleep(self.init_delay)
+        return not self.fail
+    
+    def run(self):
+        self.first_frame_time = time.perf_counter()
+        self.first_frame_event.set()
+        self._stop.wait(5.0)
+    
+    def request_action(self, action):
+        self.actions.append(action)
+        if action == 'stop':
+            self._stop.set()
+    
+    def apply_config(self, config):
+        self.applied_configs.append(config)
+    
+    def get_system_status(self):
+        return {'frame_count': 1}
+    
+    def cleanup(self):
+        self.cleaned_up = True
+
+
+class TestSessionDaemon:
+    """Test cases for SessionDaemon over a real Unix socket."""
+    
+    def setup_method(self):
+        """Start a daemon serving sessions on a background thread."""
+        FakeSession.instances = []
+        self.temp_dir = tempfile.TemporaryDirectory()
+        self.socket_path = os.path.join(self.temp_dir.name, 'daemon.sock')
+        self.detector = FakeDetector()
+        self.daemon = SessionDaemon(
+            socket_path=self.socket_path,
+            detector_factory=lambda: self.detector,
+            session_factory=FakeSession,
+            start_timeout=5.0
+        )
+        self.daemon.start()
+        self.thread = threading.Thread(target=self.daemon.serve_forever, daemon=True)
+        self.thread.start()
+    
+    def teardown_method(self):
+        """Shut the daemon down and remove the socket directory."""
+        self.daemon.stop()
+        self.thread.join(timeout=5.0)
+        self.temp_dir.cleanup()
+    
+    def command(self, command, **fields):
+        return send_command(self.socket_path, {'command': command, **fields}, timeout=5.0)
+    
+    def wait_for_session_end(self):
+        for _ in range(100):
+            if not self.daemon.session_active:
+                return
+            time.sleep(0.02)
+        raise AssertionError("session did not end")
+    
+    def test_detector_warmed_before_listening(self):
+        """Test the detector runs once at startup and the status reports it."""
+        assert self.detector.calls == 1
+        status = self.command('status')
+        assert status['ok'] and status['detector_ready']
+        assert status['session_active'] is False
+    
+    def test_start_reuses_warm_detector_and_reports_timing(self):
+        """Test a session gets the loaded detector and the first frame time is reported."""
+        reply = self.command('start', options={'camera_id': 2})
+        
+        assert reply['ok'], reply
+        assert reply['time_to_first_frame_ms'] >= reply['initialize_ms'] >= 0.0
+        session = FakeSession.instances[0]
+        assert session.pose_detector is self.detector
+        assert session.camera_id == 2
+        assert self.command('status')['session'] == {'frame_count': 1}
+    
+    def test_second_start_rejected_while_running(self):
+        """Test only one session runs at a time."""
+        assert self.command('start')['ok']
+        reply = self.command('start')
+        assert not reply['ok']
+        assert 'already running' in reply['error']
+    
+    def test_concurrent_start_rejected_while_starting(self):
+        """Test a start arriving while another is still initializing is refused, not queued."""
+        replies = []
+        first = threading.Thread(target=lambda: replies.append(self.command('start', options={'init_delay': 0.3})))
+        first.start()
+        for _ in range(100):
+            if self.daemon._pending_start is not None:
+                break
+            time.sleep(0.01)
+        
+        reply = self.command('start')
+        first.join(timeout=5.0)
+        
+        assert not reply['ok'] and 'already starting' in reply['error']
+        assert replies[0]['ok']
+        assert len(FakeSession.instances) == 1
+    
+    def test_timed_out_start_never_runs(self):
+        """Test a start that times out is cancelled instead of running later."""
+        self.daemon.start_timeout = 0.1
+        
+        reply = self.command('start', options={'init_delay': 0.3})
+        
+        assert not reply['ok'] and 'in time' in reply['error']
+        for _ in range(100):
+            if FakeSession.instances and FakeSession.instances[0].cleaned_up:
+                break
+            time.sleep(0.01)
+        session = FakeSession.instances[0]
+        assert session.cleaned_up
+        assert not session.first_frame_event.is_set()
+        assert not self.daemon.session_active
+        self.daemon.start_timeout = 5.0
+        assert self.command('start')['ok']
+    
+    def test_stop_does_not_wait_for_accept(self):
+        """Test stop() wakes the accept loop promptly."""
+        start = time.perf_counter()
+        self.daemon.stop()
+        
+        assert time.perf_counter() - start < 1.0
+        assert not self.daemon._accept_thread.is_alive()
+    
+    def test_toggle_and_stop(self):
+        """Test session commands are forwarded and the detector outlives the session."""
+        assert not self.command('toggle')['ok']
+        assert self.command('start')['ok']
+        assert self.command('toggle')['ok']
+        assert self.command('stop')['ok']
+        self.wait_for_session_end()
+        
+        session = FakeSession.instances[0]
+        assert session.actions == ['toggle', 'stop']
+        assert session.cleaned_up
+        assert self.command('start')['ok']
+        assert FakeSession.instances[1].pose_detector is self.detector
+        assert self.command('status')['sessions_started'] == 2
+    
+    def test_configure(self):
+        """Test configurations are validated, applied live and kept for new sessions."""
+        assert not self.command('configure', config={'angle': {'hysteresis_margin': -1}})['ok']
+        assert self.command('start')['ok']
+        assert self.command('configure', config={'display': {'show_angle_info': False}})['ok']
+        
+        applied = FakeSession.instances[0].applied_configs
+        assert len(applied) == 1 and applied[0].display.show_angle_info is False
+        
+        self.command('stop')
+        self.wait_for_session_end()
+        self.command('start')
+        assert isinstance(FakeSession.instances[1].config, ControllerConfig)
+        assert FakeSession.instances[1].config.display.show_angle_info is False
+    
+    def test_failed_session(self):
+        """Test an initialization failure is reported and leaves the daemon idle."""
+        reply = self.command('start', options={'fail': True})
+        assert not reply['ok']
+        assert 'initialize' in reply['error']
+        assert not self.daemon.session_active
+    
+    def test_invalid_requests(self):
+        """Test unknown commands, bad options and malformed JSON are rejected."""
+        assert not self.command('explode')['ok']
+        assert 'invalid session options' in self.command('start', options={'bogus': 1})['error']
+        with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as connection:
+            connection.connect(self.socket_path)
+            connection.sendall(b'not json\n')
+            assert b'"ok": false' in connection.recv(4096)
+    
+    def test_second_daemon_refuses_live_socket(self):
+        """Test a second daemon does not steal the socket of a running one."""
+        other = SessionDaemon(socket_path=self.socket_path, detector_factory=FakeDetector)
+        with pytest.raises(OSError, match="already listening"):
+            other.start()
+    
+    def test_regular_file_is_not_deleted(self):
+        """Test a socket path naming a regular file is refused and the file kept."""
+        path = os.path.join(self.temp_dir.name, 'notes.txt')
+        with open(path, 'w') as notes:
+            notes.write('keep me')
+        other = SessionDaemon(socket_path=path, detector_factory=FakeDetector)
+        with pytest.raises(OSError, match="not a socket"):
+            other.start()
+        with open(path) as notes:
+            assert notes.read() == 'keep me'
+    
+    def test_stale_socket_is_replaced(self):
+        """Test a socket file left by a dead daemon is removed and rebound."""
+        path = os.path.join(self.temp_dir.name, 'stale.sock')
+        stale = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        stale.bind(path)
+        stale.close()
+        other = SessionDaemon(socket_path=path, detector_factory=FakeDetector)
+        other.start()
+        try:
+            assert send_command(path, {'command': 'status'}, timeout=5.0)['ok']
+        finally:
+            other.stop()
+    
+    def test_shutdown_removes_socket(self):
+        """Test the shutdown command stops serving and removes the socket file."""
+        assert self.command('shutdown')['ok']
+        self.thread.join(timeout=5.0)
+        assert not self.thread.is_alive()
+        assert not os.path.exists(self.socket_path)
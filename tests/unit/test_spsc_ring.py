@@ -0,0 +1,120 @@
+"""
+Unit tests for the single-producer/single-consumer ring buffer.
+"""
+
+import threading
+
+import numpy as np
+import pytest
+
+from src.utils.spsc_ring import SPSCRing
+
+
+META_DTYPE = np.dtype([('timestamp', '<f8')])
+
+
+class TestSPSCRing:
+    """Test cases for SPSCRing."""
+    
+    def test_invalid_arguments(self):
+        """Test mode, capacity and metadata dtype are validated."""
+        with pytest.raises(ValueError):
+            SPSCRing((4,), mode='newest')
+        with pytest.raises(ValueError):
+            SPSCRing((4,), capacity=1)
+        with pytest.raises(ValueError):
+            SPSCRing((4,), capacity=2, mode='latest')
+        with pytest.raises(ValueError):
+            SPSCRing((4,), meta_dtype=np.float64)
+    
+    def test_lossless_fifo(self):
+        """Test a lossless ring returns every item in order and rejects puts when full."""
+        ring = SPSCRing((2,), dtype=np.int32, capacity=3, meta_dtype=META_DTYPE)
+        
+        assert ring.get() is None
+        assert all(ring.put(np.array([value, -value]), meta=(value * 0.5,)) for value in range(3))
+        assert ring.put(np.array([9, 9])) is False
+        assert len(ring) == 3
+        
+        first = ring.get()
+        assert first.tolist() == [0, 0] and ring.sequence == 0
+        # The held slot is not reused until the consumer moves on
+        assert ring.put(np.array([9, 9])) is False
+        second = ring.get()
+        assert second.tolist() == [1, -1] and ring.meta['timestamp'] == 0.5
+        assert ring.put(np.array([3, -3]))
+        assert [ring.get().tolist() for _ in range(2)] == [[2, -2], [3, -3]]
+        assert ring.get() is None
+        
+        stats = ring.get_stats()
+        assert stats['put'] == 4 and stats['got'] == 4
+        assert stats['dropped'] == 2 and stats['skipped'] == 0
+    
+    def test_latest_wins(self):
+        """Test a latest ring returns the newest item and counts the skipped ones."""
+        ring = SPSCRing((3,), capacity=3, mode='latest')
+        
+        for value in range(5):
+            assert ring.put(np.full(3, value))
+        newest = ring.get()
+        assert newest.tolist() == [4, 4, 4] and ring.sequence == 4
+        assert ring.get() is None
+        
+        # Writes never land in the slot the consumer holds
+        for value in range(5, 20):
+            ring.put(np.full(3, value))
+            assert newest.tolist() == [4, 4, 4]
+        assert ring.get().tolist() == [19, 19, 19]
+        assert ring.get_stats()['skipped'] == 18
+    
+    def test_claim_and_commit_in_place(self):
+        """Test producers can fill a slot without an intermediate array."""
+        ring = SPSCRing((4,), dtype=np.float32, capacity=2)
+        
+        slot = ring.claim()
+        slot[:] = 1.5
+        ring.commit()
+        
+        assert ring.get().tolist() == [1.5] * 4
+        with pytest.raises(RuntimeError):
+            ring.commit()
+    
+    def test_timed_get_wakes_on_put(self):
+        """Test a waiting consumer is woken by the producer."""
+        ring = SPSCRing((1,), dtype=np.int64, capacity=2)
+        timer = threading.Timer(0.05, lambda: ring.put(np.array([7])))
+        timer.start()
+        
+        item = ring.get(timeout=2.0)
+        timer.join()
+        
+        assert item is not None and item[0] == 7
+        assert ring.get(timeout=0.01) is None
+    
+    @pytest.mark.parametrize('mode', ['lossless', 'latest'])
+    def test_threaded_handoff_is_consistent(self, mode):
+        """Test items crossing threads arrive whole, in order, and lossless loses none."""
+        ring = SPSCRing((64,), dtype=np.int64, capacity=4, mode=mode)
+        count = 5000
+        
+        def produce():
+            item = np.empty(64, dtype=np.int64)
+            for value in range(count):
+                item.fill(value)
+                ring.put(item, timeout=None)
+        
+        producer = threading.Thread(target=produce)
+        producer.start()
+        received = []
+        while not received or received[-1] != count - 1:
+            item = ring.get(timeout=2.0)
+            assert item is not None
+            assert (item == item[0]).all()
+            received.append(int(item[0]))
+        producer.join()
+        
+        assert received == sorted(set(received))
+        if mode == 'lossless':
+            assert received == list(range(count))
+        else:
+            assert len(received) + ring.get_stats()['skipped'] == count
@@ -0,0 +1,127 @@
+"""
+Unit tests for the real-time thread priority mode.
+
+Scheduler calls are replaced with fakes so the tests behave the same with
+or without the privileges to raise priorities.
+"""
+
+import logging
+import os
+import sys
+import threading
+
+import pytest
+
+from src.utils import thread_priority
+from src.utils.thread_priority import (
+    ROLE_BACKGROUND, ROLE_CAPTURE, ROLE_DECISION, ThreadPriority, apply_thread_role, configure_thread_priority
+)
+
+
+pytestmark = pytest.mark.skipif(not sys.platform.startswith('linux'), reason='per-thread priority needs Linux')
+
+
+class FakeScheduler:
+    """Records scheduler calls; policies or nice values in deny are refused."""
+    
+    def __init__(self, monkeypatch, deny=()):
+        self.deny = set(deny)
+        self.policy = os.SCHED_OTHER
+        self.nice = 0
+        self.calls = []
+        monkeypatch.setattr(os, 'sched_setscheduler', self.sched_setscheduler)
+        monkeypatch.setattr(os, 'sched_getscheduler', lambda thread_id: self.policy)
+        monkeypatch.setattr(os, 'setpriority', self.setpriority)
+        monkeypatch.setattr(os, 'getpriority', lambda which, thread_id: self.nice)
+    
+    def sched_setscheduler(self, thread_id, policy, param):
+        self.calls.append(('policy', policy, param.sched_priority))
+        if policy in self.deny:
+            raise PermissionError(1, 'Operation not permitted')
+        self.policy = policy
+    
+    def setpriority(self, which, thread_id, value):
+        self.calls.append(('nice', value))
+        if 'nice' in self.deny and value < self.nice:
+            raise PermissionError(1, 'Operation not permitted')
+        self.nice = value
+
+
+class TestThreadPriority:
+    """Test cases for ThreadPriority."""
+    
+    def test_invalid_arguments(self):
+        """Test mode, priorities and roles are validated."""
+        with pytest.raises(ValueError):
+            ThreadPriority('realtime')
+        with pytest.raises(ValueError):
+            ThreadPriority('fifo', realtime_priority=0)
+        with pytest.raises(ValueError):
+            ThreadPriority('nice', nice=5)
+        with pytest.raises(ValueError):
+            ThreadPriority('nice').apply('render')
+    
+    def test_off_makes_no_scheduler_calls(self, monkeypatch):
+        """Test the default mode leaves every thread alone."""
+        scheduler = FakeScheduler(monkeypatch)
+        priority = ThreadPriority()
+        
+        assert priority.apply(ROLE_CAPTURE) == 'normal'
+        assert priority.apply(ROLE_BACKGROUND) == 'normal'
+        assert scheduler.calls == []
+        assert priority.get_stats() == {'mode': 'off', 'threads': {}, 'degraded': None}
+    
+    def test_realtime_policy_when_permitted(self, monkeypatch):
+        """Test fifo and rr set the real-time policy and record each thread's level."""
+        scheduler = FakeScheduler(monkeypatch)
+        
+        assert ThreadPriority('rr', realtime_priority=20).apply(ROLE_DECISION) == 'rr:20'
+        priority = ThreadPriority('fifo')
+        assert priority.apply(ROLE_CAPTURE) == 'fifo:10'
+        
+        assert scheduler.calls[-1] == ('policy', os.SCHED_FIFO, 10)
+        assert priority.get_stats()['threads'] == {threading.current_thread().name: 'fifo:10'}
+        assert priority.get_stats()['degraded'] is None
+    
+    def test_degrades_without_privileges(self, monkeypatch, caplog):
+        """Test a refused policy falls back to nice, then to normal, warning once per reason."""
+        FakeScheduler(monkeypatch, deny={os.SCHED_FIFO})
+        priority = ThreadPriority('fifo', nice=-5)
+        assert priority.apply(ROLE_CAPTURE) == 'nice:-5'
+        assert 'SCHED_FIFO not permitted' in priority.get_stats()['degraded']
+        
+        caplog.clear()
+        FakeScheduler(monkeypatch, deny={os.SCHED_FIFO, 'nice'})
+        priority = ThreadPriority('fifo')
+        with caplog.at_level(logging.WARNING, logger=thread_priority.__name__):
+            assert priority.apply(ROLE_CAPTURE) == 'normal'
+            assert priority.apply(ROLE_DECISION) == 'normal'
+        assert len(caplog.records) == 2
+        assert 'normal priority' in priority.get_stats()['degraded']
+    
+    def test_background_resets_inherited_priority(self, monkeypatch):
+        """Test background threads drop a real-time policy and raised nice value."""
+        scheduler = FakeScheduler(monkeypatch)
+        priority = ThreadPriority('fifo')
+        scheduler.policy, scheduler.nice = os.SCHED_FIFO, -10
+        
+        assert priority.apply(ROLE_BACKGROUND) == 'normal'
+        
+        assert scheduler.policy == os.SCHED_OTHER
+        assert scheduler.nice == 0
+    
+    def test_process_wide_policy_applies_per_thread(self, monkeypatch):
+        """Test threads apply the configured policy to themselves only."""
+        FakeScheduler(monkeypatch)
+        previous = thread_priority.get_thread_priority()
+        configure_thread_priority(ThreadPriority('nice'))
+        try:
+            levels = []
+            thread = threading.Thread(target=lambda: levels.append(apply_thread_role(ROLE_CAPTURE)), name='capture-test')
+            thread.start()
+            thread.join()
+            
+            assert levels == ['nice:-10']
+            assert thread_priority.get_thread_priority().get_stats()['threads'] == {'capture-test': 'nice:-10'}
+        finally:
+            configure_thread_priority(previous)